@@ -14,11 +14,11 @@
 
 #pragma once
 
-#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
 #include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IThreadPool.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 
 namespace eprosima {
@@ -50,7 +50,7 @@ public:
     Bridge(
             const std::shared_ptr<ParticipantsDatabase>& participants_database,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool);
+            const std::shared_ptr<IThreadPool>& thread_pool);
 
     /**
      * Copy method not allowed
@@ -82,7 +82,7 @@ protected:
     const std::shared_ptr<PayloadPool> payload_pool_;
 
     //! Common shared thread pool
-    const std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+    const std::shared_ptr<IThreadPool> thread_pool_;
 
     //! Whether the Bridge is currently enabled
     std::atomic<bool> enabled_;
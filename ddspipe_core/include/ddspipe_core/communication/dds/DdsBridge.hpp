@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <mutex>
+#include <set>
+#include <vector>
 
 #include <ddspipe_core/communication/Bridge.hpp>
 #include <ddspipe_core/communication/dds/Track.hpp>
@@ -48,6 +52,9 @@ public:
      * @param payload_pool: Payload Pool that handles the reservation/release of payloads throughout the DDS Router
      * @param thread_pool: Shared pool of threads in charge of data transmission.
      * @param enable: Whether the Bridge should be initialized as enabled
+     * @param lazy_readers: Whether the Readers of the Participants that report their discovery are only created
+     *                      while the Participant has active remote Writers in the topic (see \c set_remote_writers )
+     * @param participants_with_writers: Participants with active remote Writers in the topic (only in lazy mode)
      *
      * @throw InitializationException in case \c IWriters or \c IReaders creation fails.
      */
@@ -56,9 +63,11 @@ public:
             const utils::Heritable<types::DistributedTopic>& topic,
             const std::shared_ptr<ParticipantsDatabase>& participants_database,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            const std::shared_ptr<IThreadPool>& thread_pool,
             const RoutesConfiguration& routes_config,
-            const bool remove_unused_entities);
+            const bool remove_unused_entities,
+            const bool lazy_readers = false,
+            const std::set<types::ParticipantId>& participants_with_writers = {});
 
     DDSPIPE_CORE_DllAPI
     ~DdsBridge();
@@ -107,6 +116,52 @@ public:
     void remove_writer(
             const types::ParticipantId& participant_id) noexcept;
 
+    /**
+     * Set whether a Participant has active remote Writers in the topic.
+     *
+     * In lazy mode, the Reader of the Track of the Participant is created once it has remote Writers.
+     * Once it has none, the Reader becomes idle and it is destroyed in \c remove_idle_readers .
+     * Otherwise, it does nothing.
+     *
+     * Thread safe
+     *
+     * @param participant_id: The id of the participant that discovered the remote Writers.
+     * @param has_writers: Whether the participant has active remote Writers in the topic.
+     */
+    DDSPIPE_CORE_DllAPI
+    void set_remote_writers(
+            const types::ParticipantId& participant_id,
+            bool has_writers) noexcept;
+
+    /**
+     * Destroy the Readers that have been idle (without remote Writers) for longer than \c idle_timeout .
+     * Their Tracks become dormant until their Participants have remote Writers again.
+     *
+     * Thread safe
+     *
+     * @param idle_timeout: Time a Reader is kept without remote Writers.
+     */
+    DDSPIPE_CORE_DllAPI
+    void remove_idle_readers(
+            const std::chrono::milliseconds& idle_timeout) noexcept;
+
+    /**
+     * Copy the current metrics of every Track in the bridge.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<TrackMetricsSnapshot> metrics() noexcept;
+
+    /**
+     * Add up the size of the histories of every Reader and Writer in the bridge.
+     * Each Writer is counted once, even if it is shared by several Tracks.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    HistoryMetricsSnapshot history_metrics() noexcept;
+
 protected:
 
     /**
@@ -150,6 +205,13 @@ protected:
     void add_writers_to_tracks_nts_(
             std::map<types::ParticipantId, std::shared_ptr<IWriter>>& writers);
 
+    /**
+     * Whether the Reader of a Participant must not be created yet, as it has no remote Writers in lazy mode.
+     */
+    bool is_reader_dormant_nts_(
+            const types::ParticipantId& participant_id,
+            const std::shared_ptr<IParticipant>& participant) const noexcept;
+
     utils::Heritable<types::DistributedTopic> topic_;
 
     RoutesConfiguration::RoutesMap routes_;
@@ -160,6 +222,15 @@ protected:
      */
     std::map<types::ParticipantId, std::unique_ptr<Track>> tracks_;
 
+    //! Whether the Readers are created lazily
+    const bool lazy_readers_;
+
+    //! Participants with active remote Writers in the topic (only in lazy mode)
+    std::set<types::ParticipantId> participants_with_writers_;
+
+    //! Time since each Participant without remote Writers has its Reader idle (only in lazy mode)
+    std::map<types::ParticipantId, std::chrono::steady_clock::time_point> idle_readers_;
+
     //! Mutex to prevent simultaneous calls to enable and/or disable
     std::mutex mutex_;
 
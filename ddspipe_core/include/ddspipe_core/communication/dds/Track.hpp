@@ -15,16 +15,22 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <vector>
 
-#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
 #include <ddspipe_core/interface/IParticipant.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IThreadPool.hpp>
 #include <ddspipe_core/interface/IWriter.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/TaskGuard.hpp>
+#include <ddspipe_core/metrics/TrackMetrics.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -44,8 +50,10 @@ public:
      * Track construction creates a new thread that manages the transmission between the reader and the writers.
      *
      * @param topic:    Topic that this Track manages communication
-     * @param reader:   Reader that will receive the remote data
+     * @param reader:   Reader that will receive the remote data, or nullptr to create the Track dormant
+     *                  (see \c wake_up )
      * @param writers:  Map of Writers that will send the data received by \c source indexed by Participant id
+     * @param thread_pool: Shared pool of threads in charge of data transmission.
      */
     DDSPIPE_CORE_DllAPI
     Track(
@@ -54,7 +62,7 @@ public:
             const std::shared_ptr<IReader>& reader,
             std::map<types::ParticipantId, std::shared_ptr<IWriter>>&& writers,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool) noexcept;
+            const std::shared_ptr<IThreadPool>& thread_pool) noexcept;
 
     /**
      * @brief Destructor
@@ -100,6 +108,8 @@ public:
      * Add a writer to the track.
      * It doesn't do anything if the writer is already in it.
      *
+     * It does not wait for a transmission in course, that keeps using the previous writers.
+     *
      * Tread safe
      */
     DDSPIPE_CORE_DllAPI
@@ -111,6 +121,8 @@ public:
      * Remove a writer from the track.
      * It doesn't do anything if the writer isn't in the track.
      *
+     * It does not wait for a transmission in course, so the writer may still write the data being transmitted.
+     *
      * Tread safe
      */
     DDSPIPE_CORE_DllAPI
@@ -134,6 +146,45 @@ public:
     DDSPIPE_CORE_DllAPI
     bool has_writers() noexcept;
 
+    /**
+     * Check if the Track has no Reader, so it does not receive any data.
+     *
+     * Tread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    bool is_dormant() noexcept;
+
+    /**
+     * Set the Reader of a dormant Track, so it starts receiving data (if enabled).
+     * It doesn't do anything if the Track already has a Reader.
+     *
+     * Tread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void wake_up(
+            const std::shared_ptr<IReader>& reader) noexcept;
+
+    /**
+     * Release the Reader of the Track, so it stops receiving data.
+     * The Reader is destroyed if nobody else holds it. The data not transmitted yet is discarded.
+     *
+     * It waits for a transmission in course, as \c disable .
+     *
+     * Tread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    void make_dormant() noexcept;
+
+    /**
+     * Copy the current values of the metrics of this Track.
+     *
+     * It does not interfere with the transmission, as every counter is lock-free.
+     *
+     * Tread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    TrackMetricsSnapshot metrics() noexcept;
+
 protected:
 
     /*
@@ -177,13 +228,143 @@ protected:
     /**
      * Take data from the Reader \c source and send this data through every writer in \c targets .
      *
+     * Data is taken and written in batches of up to \c batch_size_ samples, so the reader and every writer
+     * are locked once per batch.
+     *
+     * The list of writers is loaded once per batch, so writers added or removed meanwhile do not block it.
+     *
+     * In parallel fan-out ( \c fanout_queue_size_ > 0 ) the data is not written here, but pushed to the queue
+     * of every writer (see \c fanout_nts_ ).
+     *
      * When no more data is available, set \c data_available_status_ as \c no_more_data .
      *
+     * If the thread pool has a budget of messages per turn, once that many samples have been taken it emits
+     * its task again and returns, so other tasks of the pool are executed before it continues.
+     * \c data_available_status_ is not changed meanwhile, so no other transmission is emitted.
+     *
      * It could exit without having finished transmitting all the data if track should terminate or track becomes
      * disabled.
      */
     void transmit_() noexcept;
 
+    /**
+     * @brief Samples pending to be written by one Writer in parallel fan-out.
+     *
+     * Each queue is drained by its own task in the thread pool, so a slow Writer does not delay the rest.
+     */
+    struct WriterQueue
+    {
+        //! Writer that writes the samples of this queue
+        std::shared_ptr<IWriter> writer;
+
+        //! Counters of this Writer in \c metrics_
+        TrackMetrics::WriterCounters* counters;
+
+        //! Samples pending to be written (the same data is shared by the queues of every Writer)
+        std::deque<std::shared_ptr<IRoutingData>> samples;
+
+        //! Whether a task draining this queue has been emitted and has not finished yet
+        bool draining = false;
+
+        //! Guards \c samples and \c draining
+        std::mutex mutex;
+
+        //! Task of the thread pool that drains this queue
+        utils::TaskId task_id;
+    };
+
+    /**
+     * @brief Writer of the Track with everything needed to forward data to it.
+     */
+    struct WriterEntry
+    {
+        //! Id of the Participant of the Writer
+        types::ParticipantId id;
+
+        //! Writer that sends data forward
+        std::shared_ptr<IWriter> writer;
+
+        //! Counters of this Writer in \c metrics_
+        TrackMetrics::WriterCounters* counters;
+
+        //! Queue of this Writer in parallel fan-out ( \c nullptr otherwise)
+        std::shared_ptr<WriterQueue> queue;
+    };
+
+    //! Immutable list of Writers. A new one is created each time the Writers change.
+    using WriterList = std::vector<WriterEntry>;
+
+    //! Wrap \c task so it is only executed while \c task_guard_ is open
+    IThreadPool::Task guarded_task_(
+            IThreadPool::Task&& task) const noexcept;
+
+    /**
+     * @brief Create the entry of a Writer: add its counters and, in parallel fan-out, create its queue and
+     * register the task of the queue in the thread pool.
+     *
+     * Must be called with \c track_mutex_ taken (or from the constructor).
+     */
+    WriterEntry new_writer_entry_nts_(
+            const types::ParticipantId& id,
+            const std::shared_ptr<IWriter>& writer) noexcept;
+
+    //! Current list of Writers. The list returned is never modified, so it can be used without any mutex.
+    std::shared_ptr<const WriterList> current_writers_() const noexcept;
+
+    /**
+     * @brief Replace the current list of Writers by \c writers .
+     *
+     * Transmissions in course keep using the previous list, and the next ones load the new list.
+     * The tasks of the queues removed are removed from the thread pool.
+     * Must be called with \c track_mutex_ taken.
+     */
+    void publish_writers_nts_(
+            std::shared_ptr<const WriterList> writers) noexcept;
+
+    /**
+     * @brief Push every sample of \c batch_ to the queue of every Writer and emit the tasks of the idle queues.
+     *
+     * If a queue is full, its oldest sample is dropped (and counted) so the reader is never blocked
+     * by a slow Writer.
+     *
+     * Only called from \c transmit_ .
+     */
+    void fanout_nts_(
+            const WriterList& writers) noexcept;
+
+    /**
+     * @brief Write every sample in \c queue with its Writer until it is empty or the Track is disabled.
+     *
+     * Tasks of different queues run in parallel, as they only take \c on_transmission_mutex_ shared.
+     * As \c transmit_ , it yields its thread after the budget of messages per turn of the thread pool.
+     */
+    void drain_writer_queue_(
+            const std::shared_ptr<WriterQueue>& queue) noexcept;
+
+    /**
+     * @brief Charge the payloads of \c batch_ and, if a memory budget is exceeded, apply its policy.
+     *
+     * With the drop oldest policy, the oldest samples of \c writers are removed while this topic is over its
+     * budget (see \c topic_over_memory_budget_ ). It stops as soon as removing a sample from every Writer does not
+     * reduce the bytes reserved, as the payloads are still referenced somewhere else.
+     * With the reject and downsample policies, samples of \c batch_ are discarded, so it may be left empty.
+     *
+     * Only called from \c transmit_ , with a memory accountant.
+     */
+    void apply_memory_budget_nts_(
+            const WriterList& writers) noexcept;
+
+    //! Whether the payloads reserved exceed the global budget, or the ones of the topic exceed its budget
+    bool over_memory_budget_() const noexcept;
+
+    /**
+     * @brief Whether the payloads of this topic must be reduced to keep within budget.
+     *
+     * It is if the topic exceeds its own budget, or if the global budget is exceeded and the topic is charged
+     * with more than its share of it (see \c MemoryAccountant::topic_share ).
+     */
+    bool topic_over_memory_budget_() const noexcept;
+
     //! Topic that refers to this Bridge
     const utils::Heritable<ITopic> topic_;
 
@@ -194,15 +375,88 @@ protected:
      */
     types::ParticipantId reader_participant_id_;
 
-    //! Reader that will read data
+    /**
+     * @brief Reader that will read data, nullptr while the Track is dormant
+     *
+     * It is only replaced with \c track_mutex_ and \c on_transmission_mutex_ (exclusively) taken.
+     */
     std::shared_ptr<IReader> reader_;
 
-    //! Writers that will send data forward
-    std::map<types::ParticipantId, std::shared_ptr<IWriter>> writers_;
+    //! Whether \c make_dormant is waiting for the transmission in course to release the Reader
+    std::atomic<bool> releasing_reader_{false};
+
+    //! Samples rejected by the Readers released in \c make_dormant
+    uint64_t rejected_by_released_readers_{0};
+
+    /**
+     * @brief Writers that will send data forward
+     *
+     * It is only replaced (with \c track_mutex_ taken), never modified, and it is accessed atomically.
+     * This way, the transmission loads it without any mutex and iterates it in contiguous memory, and
+     * adding or removing a Writer never waits for a transmission in course.
+     */
+    std::shared_ptr<const WriterList> writers_;
 
     //! Common shared payload pool
     std::shared_ptr<PayloadPool> payload_pool_;
 
+    /**
+     * @brief Maximum number of samples taken from the Reader and forwarded to the Writers at once
+     *
+     * Taken from the topic QoS in case it is a \c DdsTopic , 1 otherwise.
+     */
+    unsigned int batch_size_;
+
+    /**
+     * @brief Samples of the batch currently being transmitted
+     *
+     * Only accessed from \c transmit_ (guarded by \c on_transmission_mutex_ ), it is kept as member to
+     * reuse its allocated capacity between batches.
+     */
+    std::vector<std::unique_ptr<IRoutingData>> batch_;
+
+    /**
+     * @brief Maximum number of samples waiting to be written in the queue of each Writer
+     *
+     * Taken from the topic QoS in case it is a \c DdsTopic , 0 otherwise.
+     * If 0, Writers are written one after another in \c transmit_ and there are no queues.
+     */
+    unsigned int fanout_queue_size_;
+
+    /**
+     * @brief Priority class of the tasks emitted by this Track
+     *
+     * Taken from the topic QoS in case it is a \c DdsTopic , 0 otherwise.
+     */
+    unsigned int priority_;
+
+    /**
+     * @brief Maximum bytes of payloads charged to the topic (0 for unlimited)
+     *
+     * Taken from the topic QoS in case it is a \c DdsTopic , 0 otherwise.
+     */
+    uint64_t memory_budget_;
+
+    //! Accountant of the payload pool (nullptr if the pool is not accounted)
+    std::shared_ptr<MemoryAccountant> memory_accountant_;
+
+    //! Account of the topic in \c memory_accountant_
+    std::shared_ptr<MemoryAccount> topic_memory_account_;
+
+    //! Account of the Participant of the Reader in \c memory_accountant_
+    std::shared_ptr<MemoryAccount> participant_memory_account_;
+
+    //! Samples received while over budget with the downsample policy (only accessed from \c transmit_ )
+    uint64_t memory_downsampling_idx_;
+
+    /**
+     * @brief Counters and latencies of the data transmitted
+     *
+     * Its Writers are only added with \c track_mutex_ taken. The transmission uses the counters referenced
+     * in \c writers_ , so it never accesses its map of Writers.
+     */
+    TrackMetrics metrics_;
+
     //! Whether the Track is currently enabled
     std::atomic<bool> enabled_;
 
@@ -239,14 +493,27 @@ protected:
 
     /**
      * Mutex to guard while the Track is sending a message so it could not be disabled.
+     *
+     * It is taken shared while transmitting (so the tasks of every writer queue may write in parallel)
+     * and exclusively to disable the Track.
+     */
+    std::shared_timed_mutex on_transmission_mutex_;
+
+    /**
+     * Mutex to serialize the executions of \c transmit_ .
+     *
+     * The task is only emitted once at a time, but an execution left behind by a \c disable and \c enable
+     * could overlap with a new one, and both would use \c batch_ .
      */
-    std::mutex on_transmission_mutex_;
+    std::mutex transmit_mutex_;
 
+    //! Task of the thread pool that executes \c transmit_ , removed in destruction
     utils::TaskId transmit_task_id_;
 
-    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+    std::shared_ptr<IThreadPool> thread_pool_;
 
-    static const unsigned int MAX_MESSAGES_TRANSMIT_LOOP_;
+    //! Token of the tasks registered in \c thread_pool_ , closed in destruction
+    std::shared_ptr<TaskGuard> task_guard_;
 
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
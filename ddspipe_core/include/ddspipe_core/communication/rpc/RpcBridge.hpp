@@ -15,15 +15,21 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
 
 #include <ddspipe_core/communication/Bridge.hpp>
 #include <ddspipe_core/communication/rpc/ServiceRegistry.hpp>
+#include <ddspipe_core/efficiency/thread_pool/TaskGuard.hpp>
 #include <ddspipe_core/interface/IWriter.hpp>
 #include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/metrics/RpcMetrics.hpp>
+#include <ddspipe_core/metrics/ServiceRegistryMetrics.hpp>
+#include <ddspipe_core/types/data/RpcPayloadData.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 
 namespace eprosima {
@@ -39,6 +45,9 @@ namespace core {
  * is available for processing a request (services use RELIABLE & VOLATILE qos by default, so if a request is sent
  * and no server is there to receive it, it will remain unanswered even if a new server appears later).
  *
+ * Requests are forwarded through each proxy client from its own queue and task of the thread pool, so a slow
+ * server (e.g. behind a WAN participant) does not delay the requests sent to the rest of servers.
+ *
  */
 class RpcBridge : public Bridge
 {
@@ -53,6 +62,7 @@ public:
      * @param participant_database: Collection of Participants to manage communication
      * @param payload_pool: Payload Pool that handles the reservation/release of payloads throughout the DDS Router
      * @param thread_pool: Shared pool of threads in charge of data transmission.
+     * @param request_expiry_ms: Milliseconds after which a request without reply is removed (0 for never)
      *
      * @note Always created disabled, manual enable required. First enable creates all endpoints.
      */
@@ -61,7 +71,8 @@ public:
             const types::RpcTopic& topic,
             const std::shared_ptr<ParticipantsDatabase>& participants_database,
             const std::shared_ptr<PayloadPool>& payload_pool,
-            const std::shared_ptr<utils::SlotThreadPool>& thread_pool);
+            const std::shared_ptr<IThreadPool>& thread_pool,
+            unsigned int request_expiry_ms = ServiceRegistry::DEFAULT_EXPIRY_MS);
 
     /**
      * @brief Destructor
@@ -102,6 +113,22 @@ public:
             const types::ParticipantId& server_participant_id,
             const types::GuidPrefix& server_guid_prefix) noexcept;
 
+    /**
+     * Counters of the requests and replies correlated by the registry of each proxy client.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    std::map<types::ParticipantId, ServiceRegistryMetricsSnapshot> registry_metrics() const noexcept;
+
+    /**
+     * Latencies of the service calls forwarded, timeouts and counters of every registry.
+     *
+     * Thread safe
+     */
+    DDSPIPE_CORE_DllAPI
+    RpcMetricsSnapshot metrics() const noexcept;
+
 protected:
 
     /**
@@ -143,24 +170,48 @@ protected:
             const types::Guid& reader_guid) noexcept;
 
     /**
-     * REQUEST: Take data from request \c reader and send this data through all proxy clients which are in contact
-     * with actual servers (service registry enabled).
+     * REQUEST: Take data from request \c reader and queue this data to be sent through all proxy clients which are in
+     * contact with actual servers (service registry enabled).
      *
      * REPLY: Take data from reply \c reader and send it through the proxy server which originally received the request
      * (information present in service registry).
      *
      * Finish execution when no more data is available, or bridge has been disabled (due to servers unavailability or
      * topic being blocked).
+     * It also yields the thread (emitting its task again) after the budget of messages per turn of the thread pool.
      */
     void transmit_(
             std::shared_ptr<IReader> reader) noexcept;
 
+    /**
+     * Queue a copy of request \c rpc_data (referencing the same payload) to be forwarded through the proxy client
+     * of \c participant_id , and emit the task of its queue if not emitted yet.
+     *
+     * @param reply_related_sample_identity: identity the reply must have to be received by the original client
+     */
+    void enqueue_request_(
+            const types::ParticipantId& participant_id,
+            const types::RpcPayloadData& rpc_data,
+            const SampleIdentity& reply_related_sample_identity) noexcept;
+
+    /**
+     * Forward the requests queued for the proxy client of \c participant_id and add them to its service registry.
+     *
+     * Finish execution when the queue is empty, or bridge has been disabled (dropping the requests left).
+     * It also yields the thread (emitting its task again) after the budget of messages per turn of the thread pool.
+     */
+    void forward_requests_(
+            const types::ParticipantId& participant_id) noexcept;
+
     //! Whether there are any servers in the database
     bool servers_available_() const noexcept;
 
     //! Flag set to true when proxy clients and servers are created, so it can only be done once
     bool init_;
 
+    //! Milliseconds after which a request without reply is removed from the service registries (0 for never)
+    const unsigned int request_expiry_ms_;
+
     //! Proxy servers endpoints
     std::map<types::ParticipantId, std::shared_ptr<IReader>> request_readers_;
     std::map<types::ParticipantId, std::shared_ptr<IWriter>> reply_writers_;
@@ -180,11 +231,33 @@ protected:
      */
     std::map<types::ParticipantId, std::shared_ptr<ServiceRegistry>> service_registries_;
 
+    //! Requests waiting to be forwarded through a proxy client
+    struct RequestQueue
+    {
+        //! Requests not forwarded yet, with the identity their replies must have
+        std::deque<std::pair<std::unique_ptr<types::RpcPayloadData>, SampleIdentity>> requests;
+
+        //! Whether the task of this queue has been emitted and has not finished yet
+        bool emitted{false};
+
+        //! Task of the thread pool that forwards the requests of this queue
+        utils::TaskId task_id{};
+
+        //! Guards \c requests and \c emitted
+        std::mutex mutex;
+    };
+
+    //! Queue of requests of each proxy client, created with it
+    std::map<types::ParticipantId, std::unique_ptr<RequestQueue>> request_queues_;
+
+    //! Latencies of the service calls forwarded
+    RpcMetrics metrics_;
+
     //! Database keeping track of the (actual) servers available at each participant.
     std::map<types::ParticipantId, std::set<types::GuidPrefix>> current_servers_;
 
     //! Mutex to prevent simultaneous calls to enable and/or disable
-    std::mutex mutex_;
+    mutable std::mutex mutex_;
 
     /**
      * Mutex to guard while the RpcBridge is sending a message so it could not be disabled.
@@ -193,6 +266,9 @@ protected:
 
     types::RpcTopic rpc_topic_;
 
+    //! Token of the tasks registered in \c thread_pool_ , closed in destruction
+    std::shared_ptr<TaskGuard> task_guard_;
+
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
             std::ostream&,
@@ -15,11 +15,17 @@
 #pragma once
 
 #include <atomic>
-#include <map>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 
 #include <fastdds/rtps/common/SampleIdentity.h>
 
+#include <ddspipe_core/metrics/PaddedCounter.hpp>
+#include <ddspipe_core/metrics/RpcMetrics.hpp>
+#include <ddspipe_core/metrics/ServiceRegistryMetrics.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
@@ -36,9 +42,14 @@ using SequenceNumber = eprosima::fastrtps::rtps::SequenceNumber_t;
  * Class used to store the information associated to a service request, so its reply can be forwarded through the
  * appropiate proxy server with the proper write parameters.
  *
- * This information is stored in a map, whose insertions and deletions are protected with a mutex.
+ * This information is stored in a ring of fixed capacity indexed by the sequence number of the request, so each
+ * request lands in its own entry. Each entry is guarded by its own atomic flag, so requests and replies of different
+ * entries never contend.
  * Insertions are performed every time a request is sent, and deletions after a reply has been received and forwarded.
  *
+ * A request without reply expires after \c expiry_ms , if set. If the ring wraps around before, the new request
+ * overwrites it. Both cases, and replies without request, are counted in \c metrics .
+ *
  * There exists a service registry per pipe participant.
  *
  */
@@ -51,13 +62,17 @@ public:
      *
      * @param topic: Topic (service) of which this ServiceRegistry manages communication
      * @param participant_id: Id of participant for which this registry is created
+     * @param capacity: Number of entries of the ring, rounded up to a power of 2
+     * @param expiry_ms: Milliseconds after which a request without reply is removed (0 for never)
      *
      * @note Always created disabled. It is first enabled when a server is discovered.
      */
     DDSPIPE_CORE_DllAPI
     ServiceRegistry(
             const types::RpcTopic& topic,
-            const types::ParticipantId& participant_id);
+            const types::ParticipantId& participant_id,
+            unsigned int capacity = DEFAULT_CAPACITY,
+            unsigned int expiry_ms = DEFAULT_EXPIRY_MS);
 
     //! Enable registry
     DDSPIPE_CORE_DllAPI
@@ -74,32 +89,136 @@ public:
     DDSPIPE_CORE_DllAPI
     SampleIdentity related_sample_identity_nts() const noexcept;
 
-    //! Add entry to the registry (if key not existing)
+    /**
+     * @brief Add entry to the registry (if key not existing)
+     *
+     * If the entry of the ring is used by an older request without reply, it is overwritten.
+     * Requests are expected to be added in the order of their sequence numbers (see \c wait_pending_request ).
+     *
+     * @param timestamps: times of the request, returned with it by \c get
+     */
     DDSPIPE_CORE_DllAPI
     void add(
             SequenceNumber idx,
-            std::pair<types::ParticipantId, SampleIdentity> new_entry) noexcept;
+            std::pair<types::ParticipantId, SampleIdentity> new_entry,
+            const RpcRequestTimestamps& timestamps = {}) noexcept;
 
-    //! Fetch entry from the registry. Returns dummy item if not present.
+    //! Fetch entry from the registry. Returns dummy item if not present or expired.
     DDSPIPE_CORE_DllAPI
     std::pair<types::ParticipantId, SampleIdentity> get(
-            SequenceNumber idx) const noexcept;
+            SequenceNumber idx) noexcept;
 
-    //! Remove entry from the registry (if present)
+    //! Fetch entry from the registry, and its times in \c timestamps (if present and not expired).
+    DDSPIPE_CORE_DllAPI
+    std::pair<types::ParticipantId, SampleIdentity> get(
+            SequenceNumber idx,
+            RpcRequestTimestamps& timestamps) noexcept;
+
+    //! Remove entry from the registry (if present), counting its reply as correlated
     DDSPIPE_CORE_DllAPI
     void erase(
             SequenceNumber idx) noexcept;
 
+    //! Count a reply whose request is not in the registry
+    DDSPIPE_CORE_DllAPI
+    void uncorrelated_reply() noexcept;
+
+    /**
+     * @brief Announce that a request is about to be sent and added.
+     *
+     * Until \c request_added , a reply not found in the registry may be the reply of this request, so the
+     * reply must be looked up again after \c wait_pending_request .
+     */
+    DDSPIPE_CORE_DllAPI
+    void request_sending() noexcept;
+
+    //! Announce that a request announced in \c request_sending has been added (or not sent)
+    DDSPIPE_CORE_DllAPI
+    void request_added() noexcept;
+
+    /**
+     * @brief Wait until request \c idx is added, or there is no request being sent.
+     *
+     * It does not wait if \c idx is not newer than the last request added, as that request is already in the
+     * registry (or has been replied, expired or overwritten).
+     *
+     * @return whether it waited (if not, a reply not found will not be found later)
+     */
+    DDSPIPE_CORE_DllAPI
+    bool wait_pending_request(
+            const SequenceNumber& idx) const noexcept;
+
     //! RpcTopic getter
     DDSPIPE_CORE_DllAPI
     types::RpcTopic topic() const noexcept;
 
-    //! Get \c mutex_
+    //! Current values of the counters of the registry
     DDSPIPE_CORE_DllAPI
-    std::recursive_mutex& get_mutex() noexcept;
+    ServiceRegistryMetricsSnapshot metrics() const noexcept;
+
+    //! Default number of entries of the ring
+    static constexpr unsigned int DEFAULT_CAPACITY = 8192;
+
+    /**
+     * @brief Default milliseconds after which a request without reply expires.
+     *
+     * Requests never expire by default, so a server may take as long as it needs to reply. They are only removed
+     * when the ring wraps around.
+     */
+    static constexpr unsigned int DEFAULT_EXPIRY_MS = 0;
 
 protected:
 
+    //! Entry of the ring, with the information of one request
+    struct Entry
+    {
+        //! Guards the rest of fields of the entry
+        std::atomic_flag busy = ATOMIC_FLAG_INIT;
+
+        //! Whether the entry holds a request waiting for its reply
+        bool used{false};
+
+        //! Sequence number of the request
+        SequenceNumber sequence_number{};
+
+        //! When the request was added
+        std::chrono::steady_clock::time_point added_time{};
+
+        //! Participant that received the request and its identity to reply
+        std::pair<types::ParticipantId, SampleIdentity> value{};
+
+        //! Times of the request, to measure the latency of the service call
+        RpcRequestTimestamps timestamps{};
+    };
+
+    //! Locks the \c busy flag of an entry while in scope
+    class EntryGuard
+    {
+    public:
+
+        EntryGuard(
+                Entry& entry) noexcept;
+
+        ~EntryGuard();
+
+    protected:
+
+        Entry& entry_;
+    };
+
+    //! Entry of the ring where request \c idx is stored
+    Entry& entry_(
+            const SequenceNumber& idx) noexcept;
+
+    //! Sequence number \c idx as an integer, so it can be stored and compared atomically
+    static uint64_t to_uint64_(
+            const SequenceNumber& idx) noexcept;
+
+    //! Whether an entry added at \c added_time has expired at \c now
+    bool expired_(
+            const std::chrono::steady_clock::time_point& added_time,
+            const std::chrono::steady_clock::time_point& now) const noexcept;
+
     //! RpcTopic (service) that this ServiceRegistry manages communication
     types::RpcTopic topic_;
 
@@ -109,14 +228,36 @@ protected:
     //! Whether the registry is activated
     std::atomic<bool> enabled_;
 
-    //! Database with an entry per received request, and the information required for forwarding replies
-    std::map<SequenceNumber, std::pair<types::ParticipantId, SampleIdentity>> registry_;
+    //! Number of entries of the ring (power of 2)
+    const unsigned int capacity_;
+
+    //! Time after which a request without reply expires (0 for never)
+    const std::chrono::milliseconds expiry_;
+
+    //! Ring with an entry per request sent, and the information required for forwarding its reply
+    std::unique_ptr<Entry[]> registry_;
+
+    //! Requests being sent and not added yet
+    std::atomic<uint32_t> sending_requests_;
+
+    //! Sequence number of the newest request added (as returned by \c to_uint64_ )
+    std::atomic<uint64_t> last_added_;
+
+    //! Replies waiting in \c wait_pending_request , so \c request_added only notifies when there are any
+    mutable std::atomic<uint32_t> waiting_replies_;
+
+    //! Guards the wait of \c pending_cv_
+    mutable std::mutex pending_mutex_;
 
-    //! Default maximum number of entries stored by \c registry_ map
-    static const unsigned int DEFAULT_MAX_ENTRIES_;
+    //! Notified when a request being sent is added
+    mutable std::condition_variable pending_cv_;
 
-    //! Mutex to protect concurrent access to \c registry_
-    mutable std::recursive_mutex mutex_;
+    //! Counters of \c metrics
+    PaddedCounter requests_;
+    PaddedCounter correlated_replies_;
+    PaddedCounter uncorrelated_replies_;
+    PaddedCounter expired_requests_;
+    PaddedCounter overwritten_requests_;
 };
 
 } /* namespace core */
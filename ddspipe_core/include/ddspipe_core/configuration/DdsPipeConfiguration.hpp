@@ -20,6 +20,7 @@
 #include <cpp_utils/Formatter.hpp>
 
 #include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/configuration/MemoryBudgetConfiguration.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
 #include <ddspipe_core/configuration/TopicRoutesConfiguration.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -85,6 +86,45 @@ struct DdsPipeConfiguration : public IConfiguration
 
     //! Whether entities should be removed when they have no writers connected to them.
     bool remove_unused_entities = false;
+
+    /**
+     * @brief Number of threads that create Bridges when several are created at once.
+     *
+     * It applies to the Bridges of the builtin topics at startup, and to the ones of the topics allowed by a reload.
+     * With more than 1 thread, the Bridges (and their Readers and Writers) are created concurrently, so the
+     * Participants must support creating entities from several threads at once.
+     * The Bridges are added to the DdsPipe once all of them are created.
+     */
+    unsigned int bridge_creation_threads = 1;
+
+    /**
+     * @brief Whether the Readers are only created while there are remote Writers to read from.
+     *
+     * It applies to the Participants that report their discovery (see \c IParticipant::reports_discovery ).
+     * Their Tracks are created dormant, and their Readers are created once the Participant discovers an active
+     * Writer in the topic.
+     */
+    bool lazy_readers = false;
+
+    /**
+     * @brief Time (in milliseconds) a lazy Reader is kept after its Participant has no active remote Writers.
+     *
+     * Once it expires, the Reader is destroyed and its Track becomes dormant again. 0 keeps the Readers forever.
+     */
+    unsigned int lazy_readers_idle_timeout = 10000;
+
+    /**
+     * @brief Time (in milliseconds) after which a forwarded service request without reply is forgotten.
+     *
+     * Its reply, if it ever arrives, is then discarded. 0 keeps the requests until newer ones take their place.
+     */
+    unsigned int rpc_request_expiry = 0;
+
+    /**
+     * @brief Global memory budget of the payloads, and the policy applied when it (or the budget of a topic) is
+     * exceeded.
+     */
+    MemoryBudgetConfiguration memory_budget{};
 };
 
 } /* namespace core */
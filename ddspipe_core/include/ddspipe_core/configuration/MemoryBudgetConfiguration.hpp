@@ -0,0 +1,79 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Reactions of a \c Track when the memory budget (global or of its topic) is exceeded
+enum class MemoryBudgetPolicy
+{
+    drop_oldest,    //! Remove the oldest samples from the Writers of the topics over their budget or share (default)
+    reject,         //! Discard the new samples received in the topic
+    downsample      //! Forward only 1 out of every \c downsampling new samples received in the topic
+};
+
+/**
+ * Configuration structure encapsulating the memory budget of the payloads held by a \c DdsPipe instance.
+ *
+ * The budget of each topic is set in its QoS (see \c TopicQoS::memory_budget ).
+ */
+struct MemoryBudgetConfiguration : public IConfiguration
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPIPE_CORE_DllAPI MemoryBudgetConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief Override \c is_valid method.
+     *
+     * It requires a downsampling factor greater than 0.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Maximum bytes of payloads reserved in the payload pool (0 for unlimited).
+    uint64_t max_bytes = 0;
+
+    //! Reaction when the global budget or the budget of a topic is exceeded.
+    MemoryBudgetPolicy policy = MemoryBudgetPolicy::drop_oldest;
+
+    //! Keep 1 out of every \c downsampling samples while a budget is exceeded (only with downsample policy).
+    unsigned int downsampling = 2;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Scheduling policies available for the thread pool of a \c DdsPipe
+enum class ThreadPoolKind
+{
+    fifo,           //! One queue of tasks shared by every thread (default)
+    work_stealing,  //! One queue of tasks per thread, idle threads steal tasks from the others
+    priority        //! One queue of tasks per priority class, higher classes first with a starvation guard
+};
+
+/**
+ * Configuration structure encapsulating the configuration of the thread pool of a \c DdsPipe instance.
+ */
+struct ThreadPoolConfiguration : public IConfiguration
+{
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSPIPE_CORE_DllAPI ThreadPoolConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief Override \c is_valid method.
+     *
+     * It requires at least one thread and one priority class, and CPU pinning only with the work stealing scheduler.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Scheduling policy of the thread pool.
+    ThreadPoolKind kind = ThreadPoolKind::fifo;
+
+    //! Number of threads of the thread pool.
+    unsigned int n_threads = 12;
+
+    //! Maximum number of messages a Track transmits before yielding its thread (0 for unlimited).
+    unsigned int messages_per_turn = 0;
+
+    //! Whether each thread is pinned to a CPU core.
+    bool cpu_pinning = false;
+
+    //! Number of priority classes of the priority scheduler.
+    unsigned int priority_classes = 3;
+
+    //! Time in milliseconds a task of the priority scheduler can wait before being executed ahead of higher classes.
+    unsigned int starvation_timeout = 100;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -14,7 +14,14 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
@@ -25,7 +32,13 @@
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
 #include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
 #include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+#include <ddspipe_core/efficiency/memory/MemoryAccountant.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IThreadPool.hpp>
+#include <ddspipe_core/metrics/MemoryUsage.hpp>
+#include <ddspipe_core/metrics/RpcMetrics.hpp>
+#include <ddspipe_core/metrics/ThreadPoolMetrics.hpp>
+#include <ddspipe_core/metrics/TrackMetrics.hpp>
 
 #include <ddspipe_core/library/library_dll.h>
 
@@ -56,8 +69,22 @@ public:
      *
      * @throw \c ConfigurationException in case the yaml inside allowlist is not well-formed
      * @throw \c InitializationException in case \c IParticipants , \c IWriters or \c IReaders creation fails.
+     */
+    DDSPIPE_CORE_DllAPI
+    DdsPipe(
+            const std::shared_ptr<AllowedTopicList>& allowed_topics,
+            const std::shared_ptr<DiscoveryDatabase>& discovery_database,
+            const std::shared_ptr<PayloadPool>& payload_pool,
+            const std::shared_ptr<ParticipantsDatabase>& participants_database,
+            const std::shared_ptr<IThreadPool>& thread_pool,
+            const std::set<utils::Heritable<types::DistributedTopic>>& builtin_topics = {},
+            bool start_enable = false,
+            const DdsPipeConfiguration& configuration = {});
+
+    /**
+     * @brief Construct a new DdsPipe object that schedules its tasks in a \c utils::SlotThreadPool .
      *
-     * @todo change SlotThreadPool for a IThreadPool when exist.
+     * The pool is used as a \c FifoThreadPool without budget of messages per turn.
      */
     DDSPIPE_CORE_DllAPI
     DdsPipe(
@@ -87,6 +114,10 @@ public:
     /**
      * @brief Reload the allowed topic configuration
      *
+     * Only the topics and services that match a filter added or removed are checked again, looked up by the
+     * prefixes of the topic names of those filters.
+     * The Bridges of the topics activated for the first time are created without blocking the discovery callbacks.
+     *
      * @param [in] configuration : new configuration
      *
      * @return \c RETCODE_OK if configuration has been updated correctly
@@ -99,6 +130,57 @@ public:
     utils::ReturnCode reload_allowed_topics(
             const std::shared_ptr<AllowedTopicList>& allowed_topics);
 
+    /**
+     * @brief Copy the current metrics of every Track of every topic Bridge
+     *
+     * Counters and latencies are read without stopping the transmission, so this method
+     * could be called periodically to monitor the DdsPipe.
+     *
+     * @return metrics of each Track, one per Reader of each topic
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<TrackMetricsSnapshot> metrics() const noexcept;
+
+    /**
+     * @brief Size of the histories of the Readers and Writers of every topic Bridge
+     *
+     * It reports the memory reserved for cache changes in each topic (payloads are stored in the PayloadPool).
+     *
+     * @return size of the histories of each topic, indexed by the serialized topic
+     */
+    DDSPIPE_CORE_DllAPI
+    std::map<std::string, HistoryMetricsSnapshot> history_metrics() const noexcept;
+
+    /**
+     * @brief Payload memory held in total, by each topic and by each Participant
+     *
+     * It also reports the samples discarded in each topic to keep within the memory budget.
+     * Values are read without stopping the transmission, so this method could be called periodically.
+     */
+    DDSPIPE_CORE_DllAPI
+    MemoryUsageSnapshot memory_usage() const;
+
+    /**
+     * @brief Copy the current metrics of every service Bridge
+     *
+     * It reports the latency added by the DdsPipe to each service call, the round trip time of the servers
+     * and the requests that timed out. Values are read without stopping the transmission.
+     *
+     * @return metrics of each service, one per RpcBridge
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<RpcMetricsSnapshot> rpc_metrics() const noexcept;
+
+    /**
+     * @brief Copy the current metrics of each priority class of the thread pool
+     *
+     * It reports the tasks executed and waiting in each class, and the time they wait until a thread executes them.
+     *
+     * @return metrics of each priority class, empty if the thread pool has no priority classes
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<PriorityClassMetricsSnapshot> thread_pool_metrics() const noexcept;
+
     /////////////////////////
     // ENABLING METHODS
     /////////////////////////
@@ -133,70 +215,69 @@ protected:
     // CALLBACK METHODS
     /////////////////////////
 
-    /**
-     * @brief Method called every time a new endpoint has been discovered
-     *
-     * This method calls \c discovered_endpoint_nts_ with a lock on the mutex to make it thread safe.
-     *
-     * @param [in] endpoint : endpoint discovered
-     */
-    void discovered_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    //! Topic unique name and discoverer participant of readers
+    using ReaderKey = std::pair<std::string, types::ParticipantId>;
 
-    /**
-     * @brief Method called every time a new endpoint has been updated
-     *
-     * This method calls \c updated_endpoint_nts_ with a lock on the mutex to make it thread safe.
-     *
-     * @param [in] endpoint : endpoint updated
-     */
-    void updated_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    //! Topic unique name and discoverer participant of writers
+    using WriterKey = std::pair<std::string, types::ParticipantId>;
 
     /**
-     * @brief Method called every time an endpoint has been removed/dropped
+     * @brief Method called once per batch of endpoints discovered, updated or removed
      *
-     * This method calls \c removed_endpoint_nts_ with a lock on the mutex to make it thread safe.
+     * This method calls \c endpoints_changed_nts_ with a lock on the mutex to make it thread safe.
      *
-     * @param [in] endpoint : endpoint removed/dropped
+     * @param [in] changes : operations applied to the discovery database, at most one per endpoint
      */
-    void removed_endpoint_(
-            const types::Endpoint& endpoint) noexcept;
+    void endpoints_changed_(
+            const std::vector<EndpointChange>& changes) noexcept;
 
     /**
-     * @brief Method called every time a new endpoint has been discovered
+     * @brief Method called once per batch of endpoints discovered, updated or removed
      *
-     * This method calls \c discovered_topic_ with the topic of \c endpoint as parameter.
+     * Service endpoints are handled one by one.
+     * Readers are grouped by topic and discoverer participant, and \c readers_changed_nts_ is called once per group.
      *
-     * @param [in] endpoint : endpoint discovered
+     * @param [in] changes : operations applied to the discovery database, at most one per endpoint
      */
-    void discovered_endpoint_nts_(
-            const types::Endpoint& endpoint) noexcept;
+    void endpoints_changed_nts_(
+            const std::vector<EndpointChange>& changes) noexcept;
 
     /**
-     * @brief Method called every time an endpoint has been removed/dropped
+     * @brief Method called every time an endpoint of a service topic has been discovered or removed/dropped
+     *
+     * Updates of service endpoints are ignored.
      *
-     * @param [in] endpoint : endpoint removed/dropped
+     * @param [in] operation : operation applied to the endpoint
+     * @param [in] endpoint : endpoint discovered or removed/dropped
      */
-    void removed_endpoint_nts_(
+    void service_endpoint_changed_nts_(
+            DatabaseOperation operation,
             const types::Endpoint& endpoint) noexcept;
 
     /**
-     * @brief Method called every time a new endpoint has been updated
+     * @brief Method called when readers of a topic discovered by a participant have changed
      *
-     * This method calls \c discovered_endpoint_nts_ or \c removed_endpoint_nts_.
+     * A topic is discovered when its first active reader appears (or a reader is added while there are no active
+     * ones), and its writer is removed (if \c remove_unused_entities ) when its last active reader disappears.
      *
-     * @param [in] endpoint : endpoint updated
+     * @param [in] key : topic and discoverer participant of the readers
+     * @param [in] operation : operation applied to the last reader changed
+     * @param [in] endpoint : last reader changed
      */
-    void updated_endpoint_nts_(
+    void readers_changed_nts_(
+            const ReaderKey& key,
+            DatabaseOperation operation,
             const types::Endpoint& endpoint) noexcept;
 
     /**
-     * @brief Method called every time a new endpoint has been discovered, removed, or updated.
+     * @brief Method called when writers of a topic discovered by a participant have changed
+     *
+     * With \c lazy_readers , the Reader of the participant in the Bridge of the topic is created when its first
+     * active writer appears, and it becomes idle when its last active writer disappears.
      *
-     * @param [in] endpoint : endpoint discovered, removed, or updated.
+     * @param [in] endpoint : last writer changed
      */
-    bool is_endpoint_relevant_(
+    void writers_changed_nts_(
             const types::Endpoint& endpoint) noexcept;
 
     /////////////////////////
@@ -205,6 +286,9 @@ protected:
 
     /**
      * @brief  Create a disabled bridge for every real topic
+     *
+     * The Bridges are created concurrently (see \c DdsPipeConfiguration::bridge_creation_threads ) and added
+     * once all of them are ready.
      */
     void init_bridges_nts_(
             const std::set<utils::Heritable<types::DistributedTopic>>& builtin_topics);
@@ -268,6 +352,70 @@ protected:
             const utils::Heritable<types::DistributedTopic>& topic,
             bool enabled = false) noexcept;
 
+    /**
+     * @brief Create a \c DdsBridge object without adding it to the DdsPipe
+     *
+     * It only uses data that does not change after construction, so it does not require to lock \c mutex_ .
+     *
+     * @param [in] topic : new topic
+     *
+     * @return the Bridge created, or nullptr if it could not be created
+     */
+    std::unique_ptr<DdsBridge> create_bridge_(
+            const utils::Heritable<types::DistributedTopic>& topic) noexcept;
+
+    /**
+     * @brief Create a \c DdsBridge object for each topic without adding them to the DdsPipe
+     *
+     * They are created concurrently by up to \c bridge_creation_threads threads of the configuration.
+     * It does not require to lock \c mutex_ , as \c create_bridge_ .
+     *
+     * @param [in] topics : topics of the Bridges
+     *
+     * @return the Bridge of each topic, in the same order, or nullptr if it could not be created
+     */
+    std::vector<std::unique_ptr<DdsBridge>> create_bridges_(
+            const std::vector<utils::Heritable<types::DistributedTopic>>& topics) noexcept;
+
+    /**
+     * @brief Get the topics discovered that may match \c filters
+     *
+     * @param [in] filters : filters to match
+     *
+     * @return topics discovered that match \c filters
+     */
+    std::vector<utils::Heritable<types::DistributedTopic>> topics_matching_nts_(
+            const types::TopicFilterMatcher& filters) const noexcept;
+
+    /**
+     * @brief Get the participants with active remote writers in \c topic
+     *
+     * It only queries the discovery database, so it does not require to lock \c mutex_ .
+     *
+     * @param [in] topic : topic of the writers
+     */
+    std::set<types::ParticipantId> participants_with_writers_(
+            const utils::Heritable<types::DistributedTopic>& topic) const noexcept;
+
+    /**
+     * @brief Update the remote writers of every participant in a Bridge added to the DdsPipe
+     *
+     * Writers could have been discovered or removed since the Bridge was created without \c mutex_ .
+     *
+     * @param [in] topic : topic of the Bridge
+     * @param [in] bridge : Bridge added
+     */
+    void update_remote_writers_nts_(
+            const utils::Heritable<types::DistributedTopic>& topic,
+            DdsBridge& bridge) noexcept;
+
+    /**
+     * @brief Routine of \c idle_readers_thread_
+     *
+     * Periodically destroys the lazy Readers that have been idle longer than \c lazy_readers_idle_timeout .
+     */
+    void remove_idle_readers_routine_() noexcept;
+
     /**
      * @brief Create a new \c RpcBridge object
      *
@@ -333,13 +481,21 @@ protected:
      */
     std::shared_ptr<PayloadPool> payload_pool_;
 
+    /**
+     * @brief Accounting of the memory of the payloads of \c payload_pool_
+     *
+     * It is set in the payload pool at construction. If the pool was already accounted by another DdsPipe,
+     * the accountant (and its budget) of that one is shared.
+     */
+    std::shared_ptr<MemoryAccountant> memory_accountant_;
+
     /**
      * @brief Object that stores every Participant running in the DdsPipe
      */
     std::shared_ptr<ParticipantsDatabase> participants_database_;
 
     //! Thread Pool for tracks
-    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+    std::shared_ptr<IThreadPool> thread_pool_;
 
     /////////////////////////
     // INTERNAL DATA STORAGE
@@ -348,6 +504,13 @@ protected:
     //! Map of bridges indexed by their topic
     std::map<utils::Heritable<types::DistributedTopic>, std::unique_ptr<DdsBridge>> bridges_;
 
+    /**
+     * @brief Topics whose Bridge is being created without the lock, and the participants that discovered them since
+     *
+     * The writers of these participants are created once the Bridge is added to \c bridges_ .
+     */
+    std::map<utils::Heritable<types::DistributedTopic>, std::set<types::ParticipantId>> bridges_in_creation_;
+
     //! Map of RPC bridges indexed by their topic
     std::map<types::RpcTopic, std::unique_ptr<RpcBridge>> rpc_bridges_;
 
@@ -359,6 +522,9 @@ protected:
      */
     std::map<utils::Heritable<types::DistributedTopic>, bool> current_topics_;
 
+    //! Topics of \c current_topics_ indexed by topic name, to look up the topics that a filter may match
+    std::multimap<std::string, utils::Heritable<types::DistributedTopic>> current_topics_by_name_;
+
     /**
      * @brief List of RPC topics discovered
      *
@@ -367,6 +533,13 @@ protected:
      */
     std::map<types::RpcTopic, bool> current_services_;
 
+    /**
+     * @brief Topics and discoverer participants with active readers
+     *
+     * Used to detect when the first reader of a topic appears, or the last one disappears, in a participant.
+     */
+    std::set<ReaderKey> readers_relevant_;
+
     /////////////////////
     // AUXILIAR VARIABLES
     /////////////////////
@@ -379,6 +552,22 @@ protected:
      */
     mutable std::mutex mutex_;
 
+    /**
+     * @brief Mutex to serialize reloads of the allowed topics
+     *
+     * A reload releases \c mutex_ while creating Bridges, so this mutex keeps other reloads from interleaving.
+     */
+    std::mutex reload_mutex_;
+
+    //! Thread that destroys idle lazy Readers (only running with \c lazy_readers and an idle timeout)
+    std::thread idle_readers_thread_;
+
+    //! Awakes \c idle_readers_thread_ to stop it (guarded by \c mutex_ )
+    std::condition_variable idle_readers_cv_;
+
+    //! Whether \c idle_readers_thread_ must stop (guarded by \c mutex_ )
+    bool stop_idle_readers_ = false;
+
     //////////////////////////
     // CONFIGURATION VARIABLES
     //////////////////////////
@@ -19,12 +19,15 @@
 #include <mutex>
 #include <string>
 #include <set>
+#include <utility>
 
 #include <cpp_utils/memory/Heritable.hpp>
 
 #include <ddspipe_core/types/topic/Topic.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
 #include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
+#include <ddspipe_core/types/topic/filter/TopicFilterMatcher.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
 
 namespace eprosima {
@@ -38,6 +41,10 @@ namespace core {
  *
  * In case of an empty allowlist, every topic is allowed except those in blocklist.
  * In case of both lists empty, every topic is allowed.
+ *
+ * Both lists are compiled in a \c TopicFilterMatcher when set, so each topic is checked against every filter in
+ * a single pass. The verdict of each DDS topic is cached by topic and type name, and the cache is read without
+ * taking any lock, so the topics already checked are not matched again.
  */
 class AllowedTopicList
 {
@@ -97,6 +104,24 @@ public:
     bool is_service_allowed(
             const types::RpcTopic& topic) const noexcept;
 
+    /**
+     * Get the filters that may give a different verdict for a topic in \c this and in \c other
+     *
+     * These are the filters added to or removed from any of the lists.
+     * A topic that matches none of them has the same verdict in both objects, so it does not need to be checked
+     * again when changing from one to the other.
+     *
+     * @param other: other \c AllowedTopicList object to compare with \c this
+     * @param [out] changed_filters: matcher of the filters added or removed
+     *
+     * @return False if the verdict of any topic may be different (the allowlist is empty only in one of them),
+     * true otherwise
+     */
+    DDSPIPE_CORE_DllAPI
+    bool changed_filters(
+            const AllowedTopicList& other,
+            types::TopicFilterMatcher& changed_filters) const noexcept;
+
     /**
      * Equal operator.
      *
@@ -130,9 +155,52 @@ protected:
     //! List of topics that are allowed
     std::set<utils::Heritable<types::IFilterTopic>> allowlist_;
 
-    //! Mutex to restrict access to the class
+    //! Verdicts of the topics already checked, indexed by topic and type name
+    using VerdictCache = std::map<std::pair<std::string, std::string>, bool>;
+
+    //! Lists compiled, replaced as a whole every time the lists change
+    struct CompiledLists
+    {
+        CompiledLists(
+                const std::set<utils::Heritable<types::IFilterTopic>>& allowlist,
+                const std::set<utils::Heritable<types::IFilterTopic>>& blocklist);
+
+        //! Compute whether \c topic is allowed, without using the cache
+        bool is_topic_allowed(
+                const ITopic& topic) const noexcept;
+
+        //! Whether the verdicts of \c filter only depend on the topic and type names
+        static bool is_wildcard_filter_(
+                const utils::Heritable<types::IFilterTopic>& filter) noexcept;
+
+        //! Matcher of the allowed topics
+        const types::TopicFilterMatcher allowed;
+
+        //! Matcher of the blocked topics
+        const types::TopicFilterMatcher blocked;
+
+        //! Whether the verdicts only depend on the topic and type names, so they can be cached
+        const bool cacheable;
+
+        //! Verdicts published, read (and replaced) with atomic operations
+        std::shared_ptr<const VerdictCache> verdicts;
+
+        //! Verdicts computed since \c verdicts was last published
+        VerdictCache pending_verdicts;
+
+        //! Guards \c pending_verdicts and the publication of \c verdicts
+        std::mutex pending_mutex;
+    };
+
+    //! Compile the current lists and replace \c compiled_lists_
+    void compile_lists_() noexcept;
+
+    //! Mutex to restrict modifications of the lists
     mutable std::recursive_mutex mutex_;
 
+    //! Lists compiled, read (and replaced) with atomic operations
+    std::shared_ptr<CompiledLists> compiled_lists_;
+
     // Allow operator << to use private variables
     DDSPIPE_CORE_DllAPI
     friend std::ostream& operator <<(
@@ -19,9 +19,12 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 #include <fastrtps/utils/DBQueue.h>
 
@@ -42,6 +45,9 @@ enum class DatabaseOperation
     erase
 };
 
+//! Operation on an Endpoint of a DiscoveryDatabase
+using EndpointChange = std::tuple<DatabaseOperation, types::Endpoint>;
+
 /**
  * Class that stores a collection of discovered remote (not belonging to this DdsPipe) Endpoints.
  */
@@ -158,6 +164,46 @@ public:
     std::map<types::Guid, types::Endpoint> get_endpoints(
             std::function<bool(const types::Endpoint&)> is_valid_endpoint) const noexcept;
 
+    /**
+     * @brief Number of endpoints (active or not) in \c topic
+     *
+     * It uses the topic index, so it does not iterate the database.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_endpoints(
+            const types::DdsTopic& topic) const noexcept;
+
+    /**
+     * @brief Number of endpoints (active or not) discovered by participant \c discoverer_participant_id
+     *
+     * It uses the participant index, so it does not iterate the database.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_endpoints(
+            const types::ParticipantId& discoverer_participant_id) const noexcept;
+
+    /**
+     * @brief Number of active endpoints of kind \c kind in \c topic discovered by \c discoverer_participant_id
+     *
+     * It uses the active endpoints index, so it does not iterate the database.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t count_active_endpoints(
+            types::EndpointKind kind,
+            const types::DdsTopic& topic,
+            const types::ParticipantId& discoverer_participant_id) const noexcept;
+
+    /**
+     * @brief Guids of the active endpoints of kind \c kind in \c topic discovered by \c discoverer_participant_id
+     *
+     * It uses the active endpoints index, and only copies the guids (not the endpoints).
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<types::Guid> get_active_endpoint_guids(
+            types::EndpointKind kind,
+            const types::DdsTopic& topic,
+            const types::ParticipantId& discoverer_participant_id) const noexcept;
+
     /**
      * @brief Add callback to be called when discovering an Endpoint
      *
@@ -186,7 +232,20 @@ public:
             std::function<void(types::Endpoint)> endpoint_erased_callback) noexcept;
 
     /**
-     * @brief Remove all callbacks from all types (endpoint discovered, updated and erased)
+     * @brief Add callback to be called once per batch of operations processed
+     *
+     * Operations queued together are coalesced per guid before being applied, so each endpoint appears at most
+     * once per batch, with the single operation that leads from its previous to its final state.
+     * It is called after the per-endpoint callbacks of the whole batch, so the database is already updated.
+     *
+     * @param [in] endpoints_changed_callback: callback to add
+     */
+    DDSPIPE_CORE_DllAPI
+    void add_endpoints_changed_callback(
+            std::function<void(const std::vector<EndpointChange>&)> endpoints_changed_callback) noexcept;
+
+    /**
+     * @brief Remove all callbacks from all types (endpoint discovered, updated, erased and batches)
      *
      */
     DDSPIPE_CORE_DllAPI
@@ -227,6 +286,29 @@ protected:
     utils::ReturnCode erase_endpoint_(
             const types::Endpoint& endpoint_to_erase);
 
+    //! Key of \c active_index_ : topic unique name, discoverer participant and endpoint kind
+    using ActiveEndpointsKey = std::tuple<std::string, types::ParticipantId, types::EndpointKind>;
+
+    //! Key of \c endpoint in \c active_index_
+    static ActiveEndpointsKey active_endpoints_key_(
+            const types::Endpoint& endpoint) noexcept;
+
+    /**
+     * @brief Add \c endpoint to the secondary indexes.
+     *
+     * @pre \c mutex_ is locked exclusively.
+     */
+    void index_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
+    /**
+     * @brief Remove \c endpoint from the secondary indexes.
+     *
+     * @pre \c mutex_ is locked exclusively and \c endpoint is the one stored in \c entities_ .
+     */
+    void unindex_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
     //! Routine performed by dedicated thread performing database operations
     DDSPIPE_CORE_DllAPI
     void queue_processing_thread_routine_() noexcept;
@@ -240,6 +322,23 @@ protected:
     void push_item_to_queue_(
             std::tuple<DatabaseOperation, types::Endpoint> item) noexcept;
 
+    /**
+     * @brief Fold the operations of each guid into a single one, keeping the order of their first appearance.
+     *
+     * The operation kept depends on whether the endpoint is in the database before and after the operations:
+     * - neither: it is discarded (e.g. an endpoint discovered and dropped in the same batch).
+     * - only before: erase.
+     * - only after: add.
+     * - both: add if it was inactive and it is added again, update otherwise.
+     *
+     * The endpoint kept is the last one received.
+     *
+     * @note Only called from the queue processing thread, the only one modifying the database.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::vector<EndpointChange> coalesce_(
+            const std::vector<EndpointChange>& operations) const noexcept;
+
     //! Process queue storing database operations
     DDSPIPE_CORE_DllAPI
     void process_queue_() noexcept;
@@ -247,7 +346,16 @@ protected:
     //! Database of endpoints indexed by guid
     std::map<types::Guid, types::Endpoint> entities_;
 
-    //! Mutex to guard queries to the database
+    //! Guids of the endpoints in \c entities_ indexed by topic unique name
+    std::map<std::string, std::set<types::Guid>> topic_index_;
+
+    //! Guids of the endpoints in \c entities_ indexed by discoverer participant
+    std::map<types::ParticipantId, std::set<types::Guid>> participant_index_;
+
+    //! Guids of the active endpoints in \c entities_ indexed by topic, discoverer participant and kind
+    std::map<ActiveEndpointsKey, std::set<types::Guid>> active_index_;
+
+    //! Mutex to guard queries to the database (and its indexes)
     mutable std::shared_timed_mutex mutex_;
 
     //! Vector of callbacks to be called when an Endpoint is added
@@ -259,6 +367,9 @@ protected:
     //! Vector of callbacks to be called when an Endpoint is erased
     std::vector<std::function<void(types::Endpoint)>> erased_endpoint_callbacks_;
 
+    //! Vector of callbacks to be called once per batch of operations processed
+    std::vector<std::function<void(const std::vector<EndpointChange>&)>> endpoints_changed_callbacks_;
+
     //! Mutex to guard callbacks vectors
     mutable std::mutex callbacks_mutex_;
 
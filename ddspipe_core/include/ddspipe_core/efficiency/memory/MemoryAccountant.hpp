@@ -0,0 +1,201 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <ddspipe_core/configuration/MemoryBudgetConfiguration.hpp>
+#include <ddspipe_core/metrics/MemoryUsage.hpp>
+#include <ddspipe_core/types/dds/Payload.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Lock-free counters of the payload bytes charged to a topic or Participant
+struct MemoryAccount
+{
+    //! Bytes of the payloads currently charged
+    std::atomic<uint64_t> bytes{0};
+
+    //! Samples removed from the histories of the Writers to keep within budget
+    std::atomic<uint64_t> dropped_oldest{0};
+
+    //! New samples discarded to keep within budget
+    std::atomic<uint64_t> rejected{0};
+
+    //! New samples not forwarded to keep within budget
+    std::atomic<uint64_t> downsampled{0};
+
+    //! Current values of the counters
+    DDSPIPE_CORE_DllAPI
+    MemoryAccountSnapshot snapshot() const noexcept;
+};
+
+/**
+ * @brief Accounting of the payload memory held by a \c DdsPipe .
+ *
+ * The \c PayloadPool notifies every payload it reserves or releases (see \c PayloadPool::set_memory_accountant ),
+ * so the accountant knows the bytes reserved in total.
+ * Each \c Track charges the payloads it takes to its topic and to the Participant of its Reader, and they are
+ * discharged when the pool releases them, once every history referencing them has removed them.
+ *
+ * The charges are indexed by the data of the payload in several shards, so Tracks of different topics and the
+ * threads releasing payloads rarely contend.
+ *
+ * @note Payloads are charged by their data, so with pools that copy the payload for each Writer
+ * (e.g. \c CopyPayloadPool ) only the copy taken by the Track is charged.
+ */
+class MemoryAccountant
+{
+public:
+
+    //! Construct a new MemoryAccountant with the budget to apply
+    DDSPIPE_CORE_DllAPI
+    MemoryAccountant(
+            const MemoryBudgetConfiguration& configuration = MemoryBudgetConfiguration());
+
+    //! Budget configuration to apply
+    DDSPIPE_CORE_DllAPI
+    const MemoryBudgetConfiguration& configuration() const noexcept;
+
+    //! Account of the topic \c topic , created if it does not exist
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<MemoryAccount> topic_account(
+            const std::string& topic);
+
+    //! Account of the Participant \c participant_id , created if it does not exist
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<MemoryAccount> participant_account(
+            const types::ParticipantId& participant_id);
+
+    /////
+    // PAYLOAD POOL HOOKS
+
+    //! Count the bytes of a payload just reserved by the pool
+    DDSPIPE_CORE_DllAPI
+    void payload_reserved(
+            const types::Payload& payload) noexcept;
+
+    //! Discount the bytes of a payload about to be freed by the pool, and discharge it if it was charged
+    DDSPIPE_CORE_DllAPI
+    void payload_released(
+            const types::Payload& payload) noexcept;
+
+    /////
+    // TRACK METHODS
+
+    /**
+     * @brief Charge \c payload to \c topic and \c participant until the pool releases it.
+     *
+     * A payload already charged is not charged again.
+     *
+     * @warning \c topic and \c participant must be accounts of this object.
+     */
+    DDSPIPE_CORE_DllAPI
+    void charge(
+            const types::Payload& payload,
+            MemoryAccount& topic,
+            MemoryAccount& participant) noexcept;
+
+    //! Bytes of every payload currently reserved in the pool
+    DDSPIPE_CORE_DllAPI
+    uint64_t reserved_bytes() const noexcept;
+
+    //! Whether the bytes reserved exceed the global budget
+    DDSPIPE_CORE_DllAPI
+    bool over_budget() const noexcept;
+
+    /**
+     * @brief Bytes of the global budget that correspond to each topic: the budget divided by the topics accounted.
+     *
+     * While the global budget is exceeded, only the topics charged with more than their share remove samples,
+     * so a topic with a few samples is not emptied because of another one.
+     *
+     * @return share of each topic, 0 if the budget is unlimited
+     */
+    DDSPIPE_CORE_DllAPI
+    uint64_t topic_share() const noexcept;
+
+    //! Current usage of the pool and of every account
+    DDSPIPE_CORE_DllAPI
+    MemoryUsageSnapshot usage() const;
+
+    //! Number of shards of the charges
+    static constexpr unsigned int N_SHARDS = 16;
+
+protected:
+
+    //! Accounts a payload is charged to
+    struct Charge
+    {
+        MemoryAccount* topic;
+        MemoryAccount* participant;
+        uint64_t bytes;
+    };
+
+    //! Charges of the payloads whose data falls in this shard
+    struct Shard
+    {
+        std::unordered_map<const void*, Charge> charges;
+        std::mutex mutex;
+    };
+
+    //! Shard of the charge of \c data
+    Shard& shard_(
+            const void* data) noexcept;
+
+    //! Budget configuration
+    const MemoryBudgetConfiguration configuration_;
+
+    /**
+     * @brief Bytes reserved in the pool.
+     *
+     * Signed, as payloads reserved before the accountant was set are released without being counted.
+     */
+    std::atomic<int64_t> reserved_bytes_;
+
+    //! Payloads currently charged, so releases skip the shards while nothing is charged
+    std::atomic<uint64_t> charged_payloads_;
+
+    //! Charges of the payloads, by data
+    std::array<Shard, N_SHARDS> shards_;
+
+    //! Accounts of the topics. Never removed, as charges reference them.
+    std::map<std::string, std::shared_ptr<MemoryAccount>> topics_;
+
+    //! Size of \c topics_ , read without taking \c accounts_mutex_
+    std::atomic<uint64_t> n_topics_;
+
+    //! Accounts of the Participants. Never removed, as charges reference them.
+    std::map<types::ParticipantId, std::shared_ptr<MemoryAccount>> participants_;
+
+    //! Guards \c topics_ and \c participants_
+    mutable std::mutex accounts_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,145 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Pool of memory blocks of \c BlockSize bytes that recycles released blocks in a per thread cache.
+ *
+ * It is meant to implement class specific \c operator \c new and \c operator \c delete of objects created and
+ * destroyed once per sample (e.g. the routing data forwarded by a \c Track ), so in steady state the memory of
+ * the object itself is reused instead of allocated and freed for every sample.
+ *
+ * @note Only the block of the object is recycled: objects are still constructed and destroyed, so members that
+ * allocate memory by themselves still do it for every object.
+ *
+ * Each thread keeps up to \c MaxCachedBlocks free blocks. Blocks are interchangeable, so a block allocated in one
+ * thread may be released in another one. When the cache is full, or the thread is finishing, blocks are freed.
+ *
+ * As every cache belongs to one thread, no synchronization is needed.
+ *
+ * @tparam BlockSize size in bytes of each block
+ * @tparam MaxCachedBlocks maximum number of free blocks kept by each thread
+ */
+template <std::size_t BlockSize, std::size_t MaxCachedBlocks = 1024>
+class ThreadLocalBlockPool
+{
+public:
+
+    //! Get a block, reusing a free one of this thread if any
+    static void* allocate()
+    {
+        Cache* cache = cache_();
+        if (cache != nullptr && !cache->blocks.empty())
+        {
+            void* block = cache->blocks.back();
+            cache->blocks.pop_back();
+            return block;
+        }
+
+        return ::operator new(BlockSize);
+    }
+
+    //! Return a block to the cache of this thread, or free it if the cache is full
+    static void release(
+            void* block) noexcept
+    {
+        if (block == nullptr)
+        {
+            return;
+        }
+
+        try
+        {
+            Cache* cache = cache_();
+            if (cache != nullptr && cache->blocks.size() < MaxCachedBlocks)
+            {
+                // Capacity is reserved when the cache is created, so this does not allocate
+                cache->blocks.push_back(block);
+                return;
+            }
+        }
+        catch (...)
+        {
+            // The cache of this thread could not be created: just free the block
+        }
+
+        ::operator delete(block);
+    }
+
+    //! Number of free blocks currently cached by this thread
+    static std::size_t cached_blocks()
+    {
+        Cache* cache = cache_();
+        return cache == nullptr ? 0 : cache->blocks.size();
+    }
+
+protected:
+
+    //! Free blocks of a thread
+    struct Cache
+    {
+        Cache()
+        {
+            blocks.reserve(MaxCachedBlocks);
+        }
+
+        ~Cache()
+        {
+            destroyed_() = true;
+            for (void* block : blocks)
+            {
+                ::operator delete(block);
+            }
+        }
+
+        std::vector<void*> blocks;
+    };
+
+    /**
+     * @brief Whether the cache of this thread has already been destroyed.
+     *
+     * It is trivially destructible, so it can be checked while the thread is destroying its thread local objects
+     * (e.g. a block released from the destructor of another thread local object).
+     */
+    static bool& destroyed_() noexcept
+    {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    //! Cache of this thread (created in first call). \c nullptr if it has already been destroyed.
+    static Cache* cache_()
+    {
+        if (destroyed_())
+        {
+            return nullptr;
+        }
+
+        static thread_local Cache cache;
+        return &cache;
+    }
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
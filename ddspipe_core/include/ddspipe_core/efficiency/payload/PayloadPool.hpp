@@ -15,11 +15,14 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 
+#include <ddspipe_core/efficiency/memory/MemoryAccountant.hpp>
 #include <ddspipe_core/types/dds/Payload.hpp>
 
 namespace eprosima {
@@ -201,6 +204,22 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual bool is_clean() const noexcept;
 
+    /**
+     * @brief Set the accountant notified of the memory of every payload reserved and released by this pool.
+     *
+     * It can only be set once, so it is never replaced while a payload is being reserved or released.
+     *
+     * @return true if it has been set
+     * @return false if another accountant was already set
+     */
+    DDSPIPE_CORE_DllAPI
+    bool set_memory_accountant(
+            const std::shared_ptr<MemoryAccountant>& accountant) noexcept;
+
+    //! Accountant of this pool (nullptr if not set)
+    DDSPIPE_CORE_DllAPI
+    std::shared_ptr<MemoryAccountant> memory_accountant() const noexcept;
+
 protected:
 
     /**
@@ -243,10 +262,37 @@ protected:
     DDSPIPE_CORE_DllAPI
     void add_release_payload_();
 
+    /**
+     * @brief Notify the accountant (if any) that the memory of \c payload has just been reserved.
+     *
+     * Every pool must call it once per memory block reserved (not per reference).
+     */
+    DDSPIPE_CORE_DllAPI
+    void payload_reserved_(
+            const types::Payload& payload) noexcept;
+
+    /**
+     * @brief Notify the accountant (if any) that the memory of \c payload is about to be freed.
+     *
+     * Every pool must call it once the last reference to the memory block is released, before freeing it.
+     */
+    DDSPIPE_CORE_DllAPI
+    void payload_released_(
+            const types::Payload& payload) noexcept;
+
     //! Count the number of reserved data from this pool
     std::atomic<uint64_t> reserve_count_;
     //! Count the number of released data from this pool
     std::atomic<uint64_t> release_count_;
+
+    //! Accountant notified in \c payload_reserved_ and \c payload_released_ (nullptr if not set)
+    std::atomic<MemoryAccountant*> memory_accountant_;
+
+    //! Keeps \c memory_accountant_ alive as long as this pool
+    std::shared_ptr<MemoryAccountant> memory_accountant_owner_;
+
+    //! Guards \c memory_accountant_owner_
+    mutable std::mutex memory_accountant_mutex_;
 };
 
 } /* namespace core */
@@ -0,0 +1,125 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief PayloadPool class with the same behaviour as \c MapPayloadPool but without a global lock.
+ *
+ * It implements zero copy data transmission for payloads get from this pool, and validates that every payload
+ * referenced or released as owned by this pool has been reserved from it.
+ *
+ * The reference counters are split in \c N_SHARDS independent hash tables indexed by the data pointer, each
+ * guarded by its own mutex, so threads working with different payloads rarely contend.
+ */
+class ShardedMapPayloadPool : public PayloadPool
+{
+public:
+
+    //! Use parent constructor
+    using PayloadPool::PayloadPool;
+
+    //! Destroy pool and show an error if any data has not been released yet.
+    DDSPIPE_CORE_DllAPI
+    ~ShardedMapPayloadPool();
+
+    /**
+     * @brief Reserve new memory of size \c size for this payload.
+     *
+     * Add a new entrance in the shard of the new data created and set the counter to 1.
+     *
+     * @param size size of the new chunk of data
+     * @param payload object to store the new data
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            uint32_t size,
+            types::Payload& payload) override;
+
+    /**
+     * @brief Reserve in \c target_payload the payload in \c src_payload .
+     *
+     * In case the src has been reserved from this object, the reference counter is increased and no data is copied.
+     * Otherwise, this pool alloc new memory and copy the data
+     *
+     * @param [in,out] src_payload     Payload to move to target
+     * @param [in,out] data_owner      Payload pool owning incoming data \c src_payload
+     * @param [in,out] target_payload  Payload to assign the payload to
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     *
+     * @throw utils::InconsistencyException if \c data_owner is \c this but the data in \c src_payload is not from this pool.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            const types::Payload& src_payload,
+            IPayloadPool*& data_owner,
+            types::Payload& target_payload) override;
+
+    /**
+     * @brief Release a payload that has been reserved from this pool.
+     *
+     * It decreases the reference counter of the data and if it reaches 0, the data is deleted.
+     *
+     * @param payload payload to release
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     *
+     * @throw utils::InconsistencyException if the data in \c payload is not from this pool.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool release_payload(
+            types::Payload& payload) override;
+
+    //! Number of independent shards the reference counters are split in
+    static constexpr unsigned int N_SHARDS = 64;
+
+protected:
+
+    //! Reference counters of the data whose pointer falls in this shard
+    struct Shard
+    {
+        //! Store every data reserved and the number of payloads that currently reference it.
+        std::unordered_map<types::PayloadUnit*, uint32_t> reserved_payloads;
+
+        //! Guards access to \c reserved_payloads
+        std::mutex mutex;
+    };
+
+    //! Shard where the counter of \c data is stored
+    Shard& shard_(
+            const types::PayloadUnit* data) noexcept;
+
+    //! Reference counters split by shards
+    std::array<Shard, N_SHARDS> shards_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,314 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * This class implements a PayloadPool whose payloads are allocated in a named POSIX shared memory segment,
+ * so processes in the same host that map the same segment can reference them without copying.
+ *
+ * The segment is divided in \c n_blocks blocks of \c block_size bytes, managed by a lock-free free list stored
+ * in the segment itself.
+ * Each block stores a \c MetaInfoType reference counter just before the data (same layout as \c FastPayloadPool).
+ * As it is an atomic in shared memory, references are counted across every process that maps the segment.
+ *
+ * Payloads are shared between processes by their offset in the segment (\c offset_of ), and referenced in
+ * a different process with \c get_payload_from_offset .
+ * Payloads bigger than \c block_size , or reserved when the segment is full, are allocated in local memory.
+ *
+ * The segment keeps a table of the processes attached to it, and each block counts the references of each of
+ * them, so the references of a process that crashes while others are still attached are released by them
+ * (\c reclaim_dead_processes ).
+ *
+ * The pid of the process initializing the segment is written in its header before initializing it, so the segment
+ * is only reinitialized when that process is dead (it crashed while initializing), or when none of the processes
+ * attached is alive (every previous user crashed or exited without detaching).
+ * The last process detaching from the segment marks it as closed before removing it, so processes opening it
+ * meanwhile wait for it to be removed and create a new one.
+ *
+ * @note Only available in POSIX systems. In other systems the constructor throws \c utils::UnsupportedException .
+ */
+class SharedMemoryPayloadPool : public PayloadPool
+{
+public:
+
+    /**
+     * @brief Create or open the shared memory segment \c segment_name .
+     *
+     * @param segment_name name of the POSIX shared memory segment (without leading slash)
+     * @param block_size   bytes of data of each block in the segment
+     * @param n_blocks     number of blocks in the segment
+     *
+     * @throw utils::InitializationException if the segment could not be created or mapped, or it already
+     * exists with a different layout.
+     */
+    DDSPIPE_CORE_DllAPI
+    SharedMemoryPayloadPool(
+            const std::string& segment_name,
+            uint32_t block_size = DEFAULT_BLOCK_SIZE,
+            uint32_t n_blocks = DEFAULT_N_BLOCKS);
+
+    //! Detach from the segment, and remove it if this was the last process attached.
+    DDSPIPE_CORE_DllAPI
+    virtual ~SharedMemoryPayloadPool();
+
+    /**
+     * Reserve a new space for the payload with the size given.
+     *
+     * It is reserved in the shared segment if it fits in a block and there are free blocks, in local memory otherwise.
+     *
+     * @param size size of the new chunk of data
+     * @param payload object to store the new data
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            uint32_t size,
+            types::Payload& payload) override;
+
+    /**
+     * Reserve in \c target_payload the payload in \c src_payload .
+     *
+     * In case the src has been reserved from this object, the reference counter is increased and no data is copied.
+     * Otherwise, this pool reserves new memory and copy the data.
+     *
+     * @param [in,out] src_payload     Payload to move to target
+     * @param [in,out] data_owner      Payload pool owning incoming data \c src_payload
+     * @param [in,out] target_payload  Payload to assign the payload to
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload(
+            const types::Payload& src_payload,
+            IPayloadPool*& data_owner,
+            types::Payload& target_payload) override;
+
+    /**
+     * Release a payload that has been reserved from this pool.
+     *
+     * It decreases the reference counter of the data and if it reaches 0, the data is freed
+     * (returned to the segment if it is a shared block).
+     *
+     * @param payload payload to release
+     *
+     * @return true if everything OK
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    bool release_payload(
+            types::Payload& payload) override;
+
+    //! Whether the data of \c payload is stored in the shared segment
+    DDSPIPE_CORE_DllAPI
+    bool is_shared(
+            const types::Payload& payload) const noexcept;
+
+    /**
+     * @brief Offset of the data of \c payload in the shared segment.
+     *
+     * This offset identifies the payload in every process that maps the segment.
+     *
+     * @throw utils::InconsistencyException if the payload is not stored in the shared segment.
+     */
+    DDSPIPE_CORE_DllAPI
+    uint64_t offset_of(
+            const types::Payload& payload) const;
+
+    /**
+     * @brief Reference in \c payload the shared data at \c offset , without copying it.
+     *
+     * The data must still be referenced by some process (normally the one that sent the offset).
+     *
+     * @param offset offset of the data in the segment, as returned by \c offset_of in any process
+     * @param length bytes of valid data
+     * @param payload object to store the data referenced
+     *
+     * @return true if everything OK
+     * @return false if the data at \c offset is not referenced anymore
+     *
+     * @throw utils::InconsistencyException if \c offset is not the offset of a block data in the segment.
+     */
+    DDSPIPE_CORE_DllAPI
+    bool get_payload_from_offset(
+            uint64_t offset,
+            uint32_t length,
+            types::Payload& payload);
+
+    /**
+     * @brief Release the references held by processes attached to the segment that are not alive anymore.
+     *
+     * It is called when this process attaches to the segment and when the segment is full.
+     *
+     * @return number of blocks freed
+     */
+    DDSPIPE_CORE_DllAPI
+    uint32_t reclaim_dead_processes() noexcept;
+
+    //! Number of blocks of the segment currently not referenced by any process
+    DDSPIPE_CORE_DllAPI
+    uint32_t free_blocks() const noexcept;
+
+    //! Whether the segment was found stale and reinitialized when creating this object
+    DDSPIPE_CORE_DllAPI
+    bool recovered_stale_segment() const noexcept;
+
+    //! Default bytes of data of each block
+    static constexpr uint32_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    //! Default number of blocks in the segment
+    static constexpr uint32_t DEFAULT_N_BLOCKS = 1024;
+
+    //! Maximum number of processes attached to the same segment at the same time
+    static constexpr uint32_t MAX_PROCESSES = 32;
+
+protected:
+
+    //! Phase of a segment just created
+    static constexpr uint32_t SEGMENT_UNINITIALIZED = 0;
+
+    //! Phase of a segment being initialized by the process in its control word
+    static constexpr uint32_t SEGMENT_INITIALIZING = 1;
+
+    //! Phase of a segment ready to be used
+    static constexpr uint32_t SEGMENT_READY = 2;
+
+    //! Phase of a segment being removed by the process in its control word
+    static constexpr uint32_t SEGMENT_CLOSED = 3;
+
+    //! Control structure at the beginning of the segment
+    struct SegmentHeader;
+
+    //! Header of each block, just before its data
+    struct BlockHeader;
+
+    //! Map the segment and attach this process to it, initializing it if needed
+    void open_segment_();
+
+    //! Open (creating it if needed) and map the segment. Returns its inode, to check later it is still linked.
+    uint64_t map_segment_();
+
+    //! Unmap the segment
+    void unmap_segment_() noexcept;
+
+    /**
+     * @brief Attach this process to the mapped segment, initializing it if it is new or stale.
+     *
+     * @return false if the segment is being removed by its last process, so it must be opened again.
+     *
+     * @throw utils::InitializationException if the segment has a different layout or too many processes.
+     */
+    bool join_segment_();
+
+    //! Whether the segment name still refers to the segment with inode \c inode
+    bool is_linked_(
+            uint64_t inode) const noexcept;
+
+    //! Current control word of the segment (owner pid, processes attached and phase)
+    uint64_t control_() const noexcept;
+
+    /**
+     * @brief Take the ownership of the segment to initialize it, if its control word is still \c expected_control .
+     *
+     * The pid of this process is stored in the control word, so others know whether the initializer is alive.
+     */
+    bool begin_initialization_(
+            uint64_t expected_control) noexcept;
+
+    //! Mark the segment as ready, with this process attached
+    void end_initialization_() noexcept;
+
+    //! Initialize every field of the segment header and the free list
+    void initialize_segment_() noexcept;
+
+    //! Register this process in a free slot of the segment process table. Returns false if there is none.
+    bool claim_process_slot_() noexcept;
+
+    //! Remove this process from the segment process table
+    void release_process_slot_() noexcept;
+
+    //! Unregister this process from the segment. Returns true if it was the last one, and the segment is closed.
+    bool detach_() noexcept;
+
+    //! Whether some process other than this one registered in the segment is still alive
+    bool other_process_alive_() const noexcept;
+
+    //! Pop a free block from the free list. \c nullptr if there is none.
+    BlockHeader* pop_free_block_() noexcept;
+
+    //! Push \c block to the free list
+    void push_free_block_(
+            BlockHeader* block) noexcept;
+
+    //! Bytes reserved for the segment header before the first block
+    static uint64_t header_space_() noexcept;
+
+    //! Block at index \c index
+    BlockHeader* block_(
+            uint32_t index) const noexcept;
+
+    //! Block header of the data \c data . \c nullptr if it does not belong to the segment.
+    BlockHeader* block_of_(
+            const types::PayloadUnit* data) const noexcept;
+
+    //! Reserve \c size bytes in local memory with the same layout as \c FastPayloadPool
+    bool reserve_local_(
+            uint32_t size,
+            types::Payload& payload) noexcept;
+
+    //! Name of the segment (with leading slash)
+    const std::string segment_name_;
+
+    //! Bytes of data of each block
+    const uint32_t block_size_;
+
+    //! Number of blocks in the segment
+    const uint32_t n_blocks_;
+
+    //! Bytes between the beginning of two consecutive blocks
+    const uint64_t block_stride_;
+
+    //! Total bytes of the segment
+    const uint64_t segment_size_;
+
+    //! Beginning of the segment mapped in this process
+    uint8_t* segment_;
+
+    //! Control structure of the segment (at its beginning)
+    SegmentHeader* header_;
+
+    //! Slot of this process in the segment process table
+    uint32_t process_slot_;
+
+    //! Whether the segment was found stale and reinitialized
+    bool recovered_stale_segment_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,199 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Type stored in every block of a \c SlabPayloadPool before the \c MetaInfoType reference counter.
+ *
+ * It stores the index of the size class the block belongs to, so it can be recycled in release.
+ */
+typedef uint32_t SizeClassType;
+
+/**
+ * This class implements a \c FastPayloadPool that recycles the memory of the payloads released instead of
+ * freeing it, so payloads copied from foreign pools do not cost a malloc/free pair each.
+ *
+ * Blocks are grouped in power of two size classes.
+ * Released blocks are stored first in a cache local to the thread that releases them.
+ * When a size class of this cache holds more than 2 * \c THREAD_CACHE_TRANSFER_BLOCKS blocks, or the cache is
+ * full, \c THREAD_CACHE_TRANSFER_BLOCKS blocks are moved at once to a global reservoir shared by every thread.
+ * A thread whose cache is empty takes up to \c THREAD_CACHE_TRANSFER_BLOCKS blocks at once from the reservoir.
+ * This way blocks reserved in one thread (e.g. reception) and released in another (e.g. transmission) go back
+ * to the reserving thread taking the reservoir lock once every batch of blocks.
+ * Both caches are bounded in bytes, and blocks that do not fit in them are freed.
+ * Payloads bigger than the greatest size class are allocated and freed directly.
+ *
+ * The reference counter layout is the same as in \c FastPayloadPool (a \c MetaInfoType just before the data),
+ * so zero-copy forwarding of payloads owned by this pool works the same way.
+ * A \c SizeClassType is stored just before the reference counter.
+ *
+ * Every thread cache is registered in the pool, so the pool frees the blocks cached in every thread when
+ * destroyed. The cache of a thread that finishes is moved to the reservoir.
+ */
+class SlabPayloadPool : public FastPayloadPool
+{
+public:
+
+    /**
+     * @brief Construct a new Slab Payload Pool
+     *
+     * @param thread_cache_max_bytes maximum bytes kept in the cache of each thread
+     * @param reservoir_max_bytes maximum bytes kept in the global reservoir
+     */
+    DDSPIPE_CORE_DllAPI
+    SlabPayloadPool(
+            uint64_t thread_cache_max_bytes = DEFAULT_THREAD_CACHE_MAX_BYTES,
+            uint64_t reservoir_max_bytes = DEFAULT_RESERVOIR_MAX_BYTES);
+
+    //! Free every block cached in the reservoir and in the cache of every thread
+    DDSPIPE_CORE_DllAPI
+    virtual ~SlabPayloadPool();
+
+    //! Log2 of the size in bytes of the smallest size class
+    static constexpr uint32_t MIN_SIZE_CLASS_SHIFT = 6;
+
+    //! Log2 of the size in bytes of the greatest size class (payloads bigger than it are not recycled)
+    static constexpr uint32_t MAX_SIZE_CLASS_SHIFT = 24;
+
+    //! Number of size classes
+    static constexpr uint32_t N_SIZE_CLASSES = MAX_SIZE_CLASS_SHIFT - MIN_SIZE_CLASS_SHIFT + 1;
+
+    //! Default maximum bytes kept in each thread cache
+    static constexpr uint64_t DEFAULT_THREAD_CACHE_MAX_BYTES = 32ull * 1024 * 1024;
+
+    //! Default maximum bytes kept in the global reservoir
+    static constexpr uint64_t DEFAULT_RESERVOIR_MAX_BYTES = 128ull * 1024 * 1024;
+
+    //! Blocks moved at once between a thread cache and the reservoir
+    static constexpr uint32_t THREAD_CACHE_TRANSFER_BLOCKS = 32;
+
+protected:
+
+    //! Free blocks cached by one thread for one pool
+    struct ThreadCache;
+
+    //! Caches of one thread for every pool, that give their blocks back when the thread finishes
+    struct ThreadCaches;
+
+    /**
+     * @brief Reimplement parent \c reserve_ method
+     *
+     * Get a block of the size class of \c size from the thread cache, the reservoir or allocating it,
+     * in this order.
+     *
+     * @param size size of memory chunk to reserve
+     * @param payload object where introduce the new data pointer
+     *
+     * @return true if everything ok
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool reserve_(
+            uint32_t size,
+            types::Payload& payload) override;
+
+    /**
+     * @brief Reimplement parent \c release_ method
+     *
+     * Store the block in the thread cache or the reservoir if they have room for it, or free it otherwise.
+     *
+     * @param payload object to free the data from
+     *
+     * @return true if everything ok
+     * @return false if something went wrong
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool release_(
+            types::Payload& payload) override;
+
+    //! Index of the size class required for \c size . \c N_SIZE_CLASSES if it is bigger than every class.
+    static SizeClassType size_class_(
+            uint32_t size) noexcept;
+
+    //! Bytes of the payload data in blocks of size class \c size_class
+    static uint64_t size_class_bytes_(
+            SizeClassType size_class) noexcept;
+
+    //! Cache of the calling thread for this pool (created and registered if it does not exist)
+    ThreadCache& thread_cache_();
+
+    //! Caches of the calling thread for every pool
+    static ThreadCaches& thread_caches_() noexcept;
+
+    /**
+     * @brief Move up to \c n_blocks blocks of \c size_class from \c cache to the reservoir.
+     *
+     * Blocks that do not fit in the reservoir are freed.
+     * The reservoir lock is taken once for all of them.
+     */
+    void flush_thread_cache_(
+            ThreadCache& cache,
+            SizeClassType size_class,
+            size_t n_blocks);
+
+    /**
+     * @brief Move up to \c THREAD_CACHE_TRANSFER_BLOCKS blocks of \c size_class from the reservoir to \c cache ,
+     * as long as they fit in it (at least 1 if the reservoir has any).
+     *
+     * The reservoir lock is taken once for all of them.
+     */
+    void refill_thread_cache_(
+            ThreadCache& cache,
+            SizeClassType size_class);
+
+    //! Unique id of this pool, used to index the thread caches
+    const uint64_t pool_id_;
+
+    //! Maximum bytes kept in each thread cache
+    const uint64_t thread_cache_max_bytes_;
+
+    //! Maximum bytes kept in \c reservoir_
+    const uint64_t reservoir_max_bytes_;
+
+    //! Free blocks shared by every thread, by size class
+    std::array<std::vector<void*>, N_SIZE_CLASSES> reservoir_;
+
+    //! Bytes currently stored in \c reservoir_
+    uint64_t reservoir_bytes_;
+
+    //! Mutex guarding \c reservoir_ and \c reservoir_bytes_
+    std::mutex reservoir_mutex_;
+
+    //! Caches of every thread that used this pool
+    std::vector<std::shared_ptr<ThreadCache>> thread_caches_registered_;
+
+    //! Mutex guarding \c thread_caches_registered_
+    std::mutex thread_caches_mutex_;
+
+    //! Source of \c pool_id_ values
+    static std::atomic<uint64_t> next_pool_id_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
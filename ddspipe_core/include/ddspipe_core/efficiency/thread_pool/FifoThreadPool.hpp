@@ -0,0 +1,110 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <ddspipe_core/interface/IThreadPool.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief IThreadPool with a single FIFO queue of tasks shared by every thread.
+ *
+ * It is the default scheduler of the DdsPipe: it forwards every call to a \c utils::SlotThreadPool .
+ */
+class FifoThreadPool : public IThreadPool
+{
+public:
+
+    /**
+     * @brief Construct a new FifoThreadPool with its own \c utils::SlotThreadPool .
+     *
+     * @param n_threads number of threads of the pool
+     * @param messages_per_turn budget of messages per task execution, 0 for unlimited
+     */
+    DDSPIPE_CORE_DllAPI
+    FifoThreadPool(
+            unsigned int n_threads,
+            unsigned int messages_per_turn = 0);
+
+    /**
+     * @brief Construct a new FifoThreadPool that uses an already existing \c utils::SlotThreadPool .
+     *
+     * @param thread_pool pool of threads to forward the calls to
+     * @param messages_per_turn budget of messages per task execution, 0 for unlimited
+     */
+    DDSPIPE_CORE_DllAPI
+    FifoThreadPool(
+            const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+            unsigned int messages_per_turn = 0);
+
+    //! Override \c enable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void enable() noexcept override;
+
+    //! Override \c disable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void disable() noexcept override;
+
+    //! Override \c slot method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void slot(
+            const utils::TaskId& task_id,
+            Task&& task) override;
+
+    /**
+     * @brief Override \c unslot method from \c IThreadPool
+     *
+     * \c utils::SlotThreadPool cannot remove a slot, so its task is replaced by an empty one.
+     * This releases everything the task holds, but the (empty) entry of the slot is kept in \c thread_pool_ .
+     */
+    DDSPIPE_CORE_DllAPI
+    void unslot(
+            const utils::TaskId& task_id) override;
+
+    //! Override \c emit method from \c IThreadPool (priority is ignored)
+    DDSPIPE_CORE_DllAPI
+    void emit(
+            const utils::TaskId& task_id,
+            unsigned int priority = 0) override;
+
+    //! Override \c messages_per_turn method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    unsigned int messages_per_turn() const noexcept override;
+
+    //! Override \c metrics method from \c IThreadPool (there are no priority classes, so it is empty)
+    DDSPIPE_CORE_DllAPI
+    std::vector<PriorityClassMetricsSnapshot> metrics() const noexcept override;
+
+protected:
+
+    //! Pool that actually executes the tasks
+    std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+
+    //! Budget of messages per task execution
+    const unsigned int messages_per_turn_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,199 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/interface/IThreadPool.hpp>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/ThreadPoolMetrics.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief IThreadPool that executes the tasks of higher priority classes first.
+ *
+ * Each task emission is queued in the class of its priority (priorities over the highest class are queued
+ * in the highest class). Tasks of the same class are executed in FIFO order.
+ *
+ * To prevent starvation, when the oldest task of a lower class has waited longer than the starvation timeout,
+ * it is executed before the tasks of higher classes.
+ *
+ * The queueing delay (time from emission until a thread starts executing the task) is measured per class.
+ */
+class PriorityThreadPool : public IThreadPool
+{
+public:
+
+    //! Number of priority classes by default
+    static constexpr const unsigned int DEFAULT_PRIORITY_CLASSES = 3;
+
+    //! Time a task can wait before being executed ahead of higher classes by default
+    static constexpr const unsigned int DEFAULT_STARVATION_TIMEOUT_MS = 100;
+
+    /**
+     * @brief Construct a new PriorityThreadPool.
+     *
+     * @param n_threads number of threads of the pool
+     * @param messages_per_turn budget of messages per task execution, 0 for unlimited
+     * @param n_priority_classes number of priority classes, from 0 (lowest) to \c n_priority_classes - 1
+     * @param starvation_timeout_ms time in milliseconds a task can wait before being executed ahead of higher classes
+     */
+    DDSPIPE_CORE_DllAPI
+    PriorityThreadPool(
+            unsigned int n_threads,
+            unsigned int messages_per_turn = 0,
+            unsigned int n_priority_classes = DEFAULT_PRIORITY_CLASSES,
+            unsigned int starvation_timeout_ms = DEFAULT_STARVATION_TIMEOUT_MS);
+
+    //! Disable the pool and wait for its threads to finish.
+    DDSPIPE_CORE_DllAPI
+    ~PriorityThreadPool();
+
+    //! Override \c enable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void enable() noexcept override;
+
+    //! Override \c disable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void disable() noexcept override;
+
+    //! Override \c slot method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void slot(
+            const utils::TaskId& task_id,
+            Task&& task) override;
+
+    //! Override \c unslot method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void unslot(
+            const utils::TaskId& task_id) override;
+
+    //! Override \c emit method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void emit(
+            const utils::TaskId& task_id,
+            unsigned int priority = 0) override;
+
+    //! Override \c messages_per_turn method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    unsigned int messages_per_turn() const noexcept override;
+
+    //! Number of priority classes
+    DDSPIPE_CORE_DllAPI
+    unsigned int priority_classes() const noexcept;
+
+    //! Override \c metrics method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    std::vector<PriorityClassMetricsSnapshot> metrics() const noexcept override;
+
+protected:
+
+    //! Task emission waiting to be executed
+    struct Emission
+    {
+        //! Task emitted
+        utils::TaskId task_id;
+
+        //! Time of the emission
+        std::chrono::steady_clock::time_point time;
+    };
+
+    //! Queue and metrics of a priority class
+    struct PriorityClass
+    {
+        //! Emissions not executed yet, oldest first
+        std::deque<Emission> emissions;
+
+        //! Tasks executed
+        uint64_t executed{0};
+
+        //! Tasks executed ahead of higher classes
+        uint64_t starvation_promotions{0};
+
+        //! Time from emission until execution
+        LatencyHistogram queueing_delay;
+    };
+
+    //! Routine of the threads of the pool
+    void run_() noexcept;
+
+    /**
+     * @brief Take the next emission to execute.
+     *
+     * It takes the oldest emission of the highest class, unless the oldest emission of a lower class has waited
+     * longer than the starvation timeout. In that case, the oldest of those starving emissions is taken.
+     *
+     * @pre \c mutex_ is locked and there is at least one emission queued.
+     */
+    utils::TaskId pop_nts_() noexcept;
+
+    //! Execute the task of slot \c task_id
+    void execute_(
+            const utils::TaskId& task_id) noexcept;
+
+    //! Number of threads of the pool
+    const unsigned int n_threads_;
+
+    //! Budget of messages per task execution
+    const unsigned int messages_per_turn_;
+
+    //! Time a task can wait before being executed ahead of higher classes
+    const std::chrono::milliseconds starvation_timeout_;
+
+    //! One queue per priority class, from the lowest to the highest
+    std::vector<std::unique_ptr<PriorityClass>> classes_;
+
+    //! Number of emissions in all the queues
+    uint64_t pending_tasks_;
+
+    //! Whether the threads should keep running
+    bool enabled_;
+
+    //! Guards \c classes_ (except histograms), \c pending_tasks_ and \c enabled_
+    mutable std::mutex mutex_;
+
+    //! Awakes threads when a task is emitted or the pool is disabled
+    std::condition_variable cv_;
+
+    //! Threads of the pool, running only while enabled
+    std::vector<std::thread> threads_;
+
+    //! Guards \c threads_ while enabling and disabling
+    std::mutex enabling_mutex_;
+
+    //! Tasks registered, copied while executing so they can be replaced meanwhile
+    std::map<utils::TaskId, std::shared_ptr<const Task>> slots_;
+
+    //! Guards \c slots_
+    std::shared_timed_mutex slots_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,78 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+#include <ddspipe_core/interface/IThreadPool.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Token held by the tasks that an object registers in the thread pool.
+ *
+ * The tasks only use their object while the token is open. The object closes it when destroyed, so an emission
+ * still pending in the thread pool never reaches a destroyed object.
+ */
+class TaskGuard
+{
+public:
+
+    //! Start an execution of a task. If it returns false the guard is closed and the task must not run.
+    DDSPIPE_CORE_DllAPI
+    bool enter() noexcept;
+
+    //! Finish an execution started by a successful \c enter
+    DDSPIPE_CORE_DllAPI
+    void leave() noexcept;
+
+    //! Forbid new executions and wait for the ones in course to finish
+    DDSPIPE_CORE_DllAPI
+    void close() noexcept;
+
+    /**
+     * @brief Wrap \c task so it is only executed while \c guard is open.
+     *
+     * The task returned holds the guard, not the object of \c task , so it can outlive it.
+     */
+    DDSPIPE_CORE_DllAPI
+    static IThreadPool::Task guarded_task(
+            const std::shared_ptr<TaskGuard>& guard,
+            IThreadPool::Task&& task) noexcept;
+
+protected:
+
+    //! Executions in course
+    unsigned int executions_ = 0;
+
+    //! Whether the object of the tasks is being destroyed
+    bool closed_ = false;
+
+    //! Guards \c executions_ and \c closed_
+    std::mutex mutex_;
+
+    //! Notified when an execution finishes
+    std::condition_variable executions_cv_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,183 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/interface/IThreadPool.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief IThreadPool where each thread has its own queue of tasks and steals from the others when idle.
+ *
+ * A task emitted from a thread of the pool (e.g. a Track that yields after its budget of messages) is queued
+ * in the queue of that thread, so it is not contended by the rest.
+ * A task emitted from outside the pool (e.g. a Reader callback) is queued in the queues in round robin.
+ *
+ * Each thread executes the tasks of its own queue in FIFO order.
+ * When it is empty, it takes the most recent task of the queue of another thread, so a few busy tasks cannot
+ * keep the rest of tasks waiting while other threads are idle.
+ *
+ * Optionally, each thread can be pinned to a CPU core (only supported in Linux).
+ */
+class WorkStealingThreadPool : public IThreadPool
+{
+public:
+
+    /**
+     * @brief Construct a new WorkStealingThreadPool.
+     *
+     * @param n_threads number of threads of the pool
+     * @param messages_per_turn budget of messages per task execution, 0 for unlimited
+     * @param cpu_pinning whether each thread \c i is pinned to the CPU core \c i (modulo number of cores)
+     */
+    DDSPIPE_CORE_DllAPI
+    WorkStealingThreadPool(
+            unsigned int n_threads,
+            unsigned int messages_per_turn = 0,
+            bool cpu_pinning = false);
+
+    //! Disable the pool and wait for its threads to finish.
+    DDSPIPE_CORE_DllAPI
+    ~WorkStealingThreadPool();
+
+    //! Override \c enable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void enable() noexcept override;
+
+    //! Override \c disable method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void disable() noexcept override;
+
+    //! Override \c slot method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void slot(
+            const utils::TaskId& task_id,
+            Task&& task) override;
+
+    //! Override \c unslot method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    void unslot(
+            const utils::TaskId& task_id) override;
+
+    //! Override \c emit method from \c IThreadPool (priority is ignored)
+    DDSPIPE_CORE_DllAPI
+    void emit(
+            const utils::TaskId& task_id,
+            unsigned int priority = 0) override;
+
+    //! Override \c messages_per_turn method from \c IThreadPool
+    DDSPIPE_CORE_DllAPI
+    unsigned int messages_per_turn() const noexcept override;
+
+    //! Override \c metrics method from \c IThreadPool (there are no priority classes, so it is empty)
+    DDSPIPE_CORE_DllAPI
+    std::vector<PriorityClassMetricsSnapshot> metrics() const noexcept override;
+
+protected:
+
+    //! Queue of tasks of a thread
+    struct Worker
+    {
+        //! Tasks emitted and not executed yet
+        std::deque<utils::TaskId> tasks;
+
+        //! Guards \c tasks
+        std::mutex mutex;
+    };
+
+    //! Routine of the thread \c index
+    void run_(
+            unsigned int index) noexcept;
+
+    /**
+     * @brief Take the next task to execute by thread \c index .
+     *
+     * It takes the oldest task of its own queue, or the most recent task of another queue if it is empty.
+     *
+     * @return whether a task has been taken
+     */
+    bool pop_(
+            unsigned int index,
+            utils::TaskId& task_id) noexcept;
+
+    //! Execute the task of slot \c task_id
+    void execute_(
+            const utils::TaskId& task_id) noexcept;
+
+    //! Pin the calling thread to the CPU core that corresponds to \c index
+    void pin_to_cpu_(
+            unsigned int index) noexcept;
+
+    //! Number of threads of the pool
+    const unsigned int n_threads_;
+
+    //! Budget of messages per task execution
+    const unsigned int messages_per_turn_;
+
+    //! Whether threads are pinned to CPU cores
+    const bool cpu_pinning_;
+
+    //! One queue per thread
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    //! Threads of the pool, running only while enabled
+    std::vector<std::thread> threads_;
+
+    //! Guards \c threads_ while enabling and disabling
+    std::mutex enabling_mutex_;
+
+    //! Tasks registered, copied while executing so they can be replaced meanwhile
+    std::map<utils::TaskId, std::shared_ptr<const Task>> slots_;
+
+    //! Guards \c slots_
+    std::shared_timed_mutex slots_mutex_;
+
+    //! Number of tasks in all the queues (it may be lower than the actual number while a task is being queued)
+    std::atomic<int64_t> pending_tasks_;
+
+    //! Number of threads waiting for new tasks
+    std::atomic<unsigned int> idle_threads_;
+
+    //! Queue where the next task emitted from outside the pool is queued
+    std::atomic<unsigned int> next_worker_;
+
+    //! Whether the threads should keep running
+    std::atomic<bool> enabled_;
+
+    //! Mutex for idle threads to wait for new tasks
+    std::mutex idle_mutex_;
+
+    //! Awakes idle threads when a task is emitted
+    std::condition_variable idle_cv_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,43 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file thread_pool_factory.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/configuration/ThreadPoolConfiguration.hpp>
+#include <ddspipe_core/interface/IThreadPool.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Create the thread pool described by \c configuration .
+ *
+ * @throw \c ConfigurationException in case the configuration is not valid.
+ */
+DDSPIPE_CORE_DllAPI
+std::shared_ptr<IThreadPool> create_thread_pool(
+        const ThreadPoolConfiguration& configuration);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -61,6 +61,17 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual bool is_repeater() const noexcept = 0;
 
+    /**
+     * @brief Whether this Participant adds the remote endpoints it discovers to the \c DiscoveryDatabase .
+     *
+     * Its Readers are only created lazily (once a remote Writer is discovered) if it does.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool reports_discovery() const noexcept
+    {
+        return false;
+    }
+
     /**
      * @brief Return a new Writer
      *
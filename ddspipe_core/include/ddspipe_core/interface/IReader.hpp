@@ -15,12 +15,15 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <vector>
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
 #include <cpp_utils/ReturnCode.hpp>
 
 #include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/metrics/HistoryMetrics.hpp>
 #include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -110,6 +113,47 @@ public:
     virtual utils::ReturnCode take(
             std::unique_ptr<IRoutingData>& data) noexcept = 0;
 
+    /**
+     * @brief Take up to \c max_samples of the oldest received messages from the Reader
+     *
+     * This method behaves as calling \c take up to \c max_samples times, but it allows the implementation
+     * to take every sample in the batch under a single lock.
+     * Every sample taken is appended at the end of \c data in reception order.
+     *
+     * @param [in] max_samples : maximum number of samples to take
+     * @param [out] data : vector where the samples taken are appended
+     *
+     * @return \c RETCODE_OK if at least one data has been taken correctly
+     * @return \c RETCODE_NO_DATA if there is no data to take
+     * @return \c RETCODE_ERROR if there has been any error while taking the first sample
+     * @return \c RETCODE_NOT_ENABLED if the reader is not enabled (this should not happen)
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual utils::ReturnCode take_batch(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<IRoutingData>>& data) noexcept = 0;
+
+    /**
+     * @brief Number of samples received by the Reader that have been discarded before being taken
+     *
+     * (e.g. data filtered out or coming from this same DdsPipe).
+     * It must be lock-free, as it could be read at any time to collect metrics.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual uint64_t rejected_samples() const noexcept = 0;
+
+    /**
+     * @brief Current size of the history of the Reader
+     *
+     * It could be read at any time to collect metrics.
+     * By default, the Reader has no history to report.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual HistoryMetricsSnapshot history_metrics() const noexcept
+    {
+        return HistoryMetricsSnapshot();
+    }
+
     /////////////////////////
     // RPC REQUIRED METHODS
     /////////////////////////
@@ -0,0 +1,117 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/ThreadPoolMetrics.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * Interface that represents the pool of threads that executes the transmission tasks of a DdsPipe.
+ *
+ * Tasks are registered once in a slot with an unique \c utils::TaskId , and executed each time the slot
+ * is emitted (once per emission) by any of the threads of the pool.
+ *
+ * @note In order to implement new scheduling policies, create a subclass of this Interface and implement
+ * every method.
+ */
+class IThreadPool
+{
+public:
+
+    //! Task executed when a slot is emitted
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Virtual dtor to allow inheritance.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual ~IThreadPool() = default;
+
+    /**
+     * @brief Start the threads of the pool.
+     *
+     * Tasks emitted before enabling are executed once it is enabled.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void enable() noexcept = 0;
+
+    /**
+     * @brief Stop the threads of the pool, waiting for the tasks being executed.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void disable() noexcept = 0;
+
+    /**
+     * @brief Register \c task to be executed each time \c task_id is emitted.
+     *
+     * It replaces the previous task of the slot, if any.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void slot(
+            const utils::TaskId& task_id,
+            Task&& task) = 0;
+
+    /**
+     * @brief Remove the slot \c task_id , releasing its task.
+     *
+     * Emissions of \c task_id still pending (or done afterwards) are skipped.
+     * A task being executed at the moment is not waited for.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void unslot(
+            const utils::TaskId& task_id) = 0;
+
+    /**
+     * @brief Schedule one execution of the task of slot \c task_id .
+     *
+     * @param priority priority class of this execution (higher first). Schedulers without priorities ignore it.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual void emit(
+            const utils::TaskId& task_id,
+            unsigned int priority = 0) = 0;
+
+    /**
+     * @brief Maximum number of messages a task should transmit before yielding its thread.
+     *
+     * A task that reaches this budget and still has messages to transmit should emit its own slot again
+     * and return, so other tasks waiting in the pool are executed before it continues.
+     *
+     * @return budget of messages per turn, 0 if tasks may run until they have no more messages.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual unsigned int messages_per_turn() const noexcept = 0;
+
+    /**
+     * @brief Current metrics of each priority class, from the lowest to the highest.
+     *
+     * @return metrics of each priority class, empty if the scheduler has no priority classes.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual std::vector<PriorityClassMetricsSnapshot> metrics() const noexcept = 0;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
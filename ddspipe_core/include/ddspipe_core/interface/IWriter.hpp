@@ -14,9 +14,13 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include <cpp_utils/ReturnCode.hpp>
 
 #include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/metrics/HistoryMetrics.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -82,6 +86,50 @@ public:
     DDSPIPE_CORE_DllAPI
     virtual utils::ReturnCode write(
             IRoutingData& data) noexcept = 0;
+
+    /**
+     * @brief Asynchronously write a batch of messages for remote endpoints
+     *
+     * This method behaves as calling \c write for every element of \c data in order, but it allows the
+     * implementation to write the whole batch under a single lock.
+     * A failure writing one of the samples does not prevent the rest from being written.
+     *
+     * @param [in] data : objects containing the payloads to be sent
+     *
+     * @return \c RETCODE_OK if every data has been written correctly
+     * @return \c RETCODE_ERROR if there has been any error while writing any of the samples
+     * @return \c RETCODE_NOT_ENABLED if the writer is not enabled (this should not happen)
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual utils::ReturnCode write_batch(
+            const std::vector<std::unique_ptr<IRoutingData>>& data) noexcept = 0;
+
+    /**
+     * @brief Current size of the history of the Writer
+     *
+     * It could be read at any time to collect metrics.
+     * By default, the Writer has no history to report.
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual HistoryMetricsSnapshot history_metrics() const noexcept
+    {
+        return HistoryMetricsSnapshot();
+    }
+
+    /**
+     * @brief Remove the oldest sample from the history of the Writer, releasing its payload
+     *
+     * It is called to keep the payloads held within the memory budget, so the sample may not reach some
+     * remote Readers.
+     * By default, the Writer has no history to remove samples from.
+     *
+     * @return whether a sample has been removed
+     */
+    DDSPIPE_CORE_DllAPI
+    virtual bool drop_oldest() noexcept
+    {
+        return false;
+    }
 };
 
 } /* namespace core */
@@ -0,0 +1,61 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Size of the history of a Reader or Writer at a given moment.
+ *
+ * The payloads are not included, as they are stored in the \c PayloadPool .
+ * Values of several histories can be added up to get the footprint of a whole topic.
+ */
+struct HistoryMetricsSnapshot
+{
+    //! Cache changes reserved by the history (used or ready to be reused)
+    uint64_t reserved_caches{0};
+
+    //! Maximum number of cache changes the history may hold (0 if unknown or unlimited)
+    uint64_t max_caches{0};
+
+    //! Samples currently in the history (not taken in Readers, not acknowledged in reliable Writers)
+    uint64_t backlog{0};
+
+    //! Bytes of the cache changes reserved by the history
+    uint64_t footprint_bytes{0};
+
+    //! Add the values of \c other to these ones
+    DDSPIPE_CORE_DllAPI
+    HistoryMetricsSnapshot& operator +=(
+            const HistoryMetricsSnapshot& other) noexcept;
+};
+
+//! \c HistoryMetricsSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const HistoryMetricsSnapshot& metrics);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
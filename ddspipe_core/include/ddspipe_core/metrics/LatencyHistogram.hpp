@@ -0,0 +1,136 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Values of a \c LatencyHistogram at a given moment.
+ *
+ * Every value is in nanoseconds.
+ */
+struct LatencyHistogramSnapshot
+{
+    //! Number of values recorded
+    uint64_t count{0};
+
+    //! Sum of the values recorded
+    uint64_t sum{0};
+
+    //! Minimum value recorded (0 if none)
+    uint64_t min{0};
+
+    //! Maximum value recorded (0 if none)
+    uint64_t max{0};
+
+    //! Number of values recorded in each bucket (see \c LatencyHistogram::bucket_lower_bound )
+    std::vector<uint64_t> buckets;
+
+    //! Mean of the values recorded (0 if none)
+    DDSPIPE_CORE_DllAPI
+    double mean() const noexcept;
+
+    /**
+     * @brief Value below which a \c percentile (in [0,100]) of the recorded values are.
+     *
+     * The value returned is the upper bound of the bucket where the percentile falls (bounded by \c max ),
+     * so its relative error is at most the precision of the histogram.
+     */
+    DDSPIPE_CORE_DllAPI
+    uint64_t percentile(
+            double percentile) const noexcept;
+};
+
+/**
+ * @brief Lock-free histogram of latencies in nanoseconds with bounded relative error (HDR style).
+ *
+ * Values are stored in buckets with logarithmic ranges (powers of 2), each divided in \c SUB_BUCKETS linear
+ * sub-buckets, so every value is counted with a relative error lower than 1 / \c SUB_BUCKETS ,
+ * using a fixed amount of memory regardless of the range of values.
+ *
+ * Recording a value costs a few relaxed atomic operations and never allocates or locks.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Number of bits of the linear sub-buckets of each power of 2
+    static constexpr unsigned int SUB_BUCKET_BITS = 4;
+
+    //! Number of linear sub-buckets of each power of 2
+    static constexpr unsigned int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+
+    //! Highest power of 2 with its own buckets (values over it are counted in the last bucket, ~39 hours)
+    static constexpr unsigned int MAX_EXPONENT = 47;
+
+    //! Total number of buckets
+    static constexpr unsigned int N_BUCKETS = SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    //! Add a value in nanoseconds
+    DDSPIPE_CORE_DllAPI
+    void record(
+            uint64_t value_ns) noexcept;
+
+    //! Copy the current values of the histogram
+    DDSPIPE_CORE_DllAPI
+    LatencyHistogramSnapshot snapshot() const noexcept;
+
+    //! Index of the bucket where \c value_ns is counted
+    DDSPIPE_CORE_DllAPI
+    static unsigned int bucket_index(
+            uint64_t value_ns) noexcept;
+
+    //! Lowest value counted in bucket \c index
+    DDSPIPE_CORE_DllAPI
+    static uint64_t bucket_lower_bound(
+            unsigned int index) noexcept;
+
+protected:
+
+    //! Number of values recorded in each bucket
+    std::array<std::atomic<uint64_t>, N_BUCKETS> buckets_{};
+
+    //! Number of values recorded
+    std::atomic<uint64_t> count_{0};
+
+    //! Sum of the values recorded
+    std::atomic<uint64_t> sum_{0};
+
+    //! Minimum value recorded
+    std::atomic<uint64_t> min_{UINT64_MAX};
+
+    //! Maximum value recorded
+    std::atomic<uint64_t> max_{0};
+};
+
+//! \c LatencyHistogramSnapshot to stream serialization (count, mean and main percentiles)
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const LatencyHistogramSnapshot& histogram);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,82 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Payload bytes charged to a topic or Participant, and the samples discarded to keep them within budget
+struct MemoryAccountSnapshot
+{
+    //! Bytes of the payloads currently charged
+    uint64_t bytes{0};
+
+    //! Samples removed from the histories of the Writers (drop oldest policy)
+    uint64_t dropped_oldest{0};
+
+    //! New samples discarded (reject policy)
+    uint64_t rejected{0};
+
+    //! New samples not forwarded (downsample policy)
+    uint64_t downsampled{0};
+};
+
+/**
+ * @brief Payload memory held by a \c DdsPipe at a given moment.
+ *
+ * Payloads are charged to the topic and the Participant they are received from when their Track takes them,
+ * and discharged when the payload pool releases them (i.e. once no Reader or Writer history references them).
+ * Payloads received but not taken yet are only counted in \c reserved_bytes .
+ */
+struct MemoryUsageSnapshot
+{
+    //! Bytes of every payload currently reserved in the payload pool
+    uint64_t reserved_bytes{0};
+
+    //! Global budget (0 for unlimited)
+    uint64_t max_bytes{0};
+
+    //! Usage of each topic, indexed by its serialization
+    std::map<std::string, MemoryAccountSnapshot> topics;
+
+    //! Usage of each Participant as source of the payloads
+    std::map<types::ParticipantId, MemoryAccountSnapshot> participants;
+};
+
+//! \c MemoryAccountSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryAccountSnapshot& account);
+
+//! \c MemoryUsageSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryUsageSnapshot& usage);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
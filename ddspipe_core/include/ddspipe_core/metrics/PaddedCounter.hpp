@@ -0,0 +1,64 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Size assumed for a cache line
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Lock-free monotonic counter that fills a whole cache line.
+ *
+ * Counters updated from different threads (or next to data written by other threads) are padded so two of them
+ * never share a cache line, and updating one does not invalidate the others (false sharing).
+ *
+ * Increments are relaxed: the counter only guarantees that no increment is lost, not any order with other memory.
+ */
+class PaddedCounter
+{
+public:
+
+    //! Add \c n to the counter
+    void increment(
+            uint64_t n = 1) noexcept
+    {
+        value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    //! Current value of the counter
+    uint64_t load() const noexcept
+    {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+protected:
+
+    //! Value of the counter
+    std::atomic<uint64_t> value_{0};
+
+    //! Padding up to a cache line
+    char padding_[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,106 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/ServiceRegistryMetrics.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Times of a request forwarded by a \c RpcBridge , stored with it in the \c ServiceRegistry .
+ *
+ * Every time is in nanoseconds since epoch (as data timestamps), 0 if not set.
+ */
+struct RpcRequestTimestamps
+{
+    //! When the request was received by the proxy server
+    int64_t received_ns{0};
+
+    //! When the request was written by the proxy client
+    int64_t sent_ns{0};
+};
+
+//! Values of the metrics of a \c RpcBridge at a given moment
+struct RpcMetricsSnapshot
+{
+    //! Service name
+    std::string service;
+
+    //! Time spent in the bridge by each request and its reply (from reception until written, both added)
+    LatencyHistogramSnapshot bridge_latency;
+
+    //! Time from each request written until its reply is received (time spent by the server and the network)
+    LatencyHistogramSnapshot server_round_trip;
+
+    //! Requests removed without reply after the expiry time, in every registry
+    uint64_t timeouts{0};
+
+    //! Counters of the registry of each proxy client
+    std::map<types::ParticipantId, ServiceRegistryMetricsSnapshot> registries;
+};
+
+/**
+ * @brief Latency histograms of the service calls forwarded by a \c RpcBridge .
+ *
+ * Recording is lock-free and never allocates (see \c LatencyHistogram ), so it is done in the transmission path.
+ */
+class RpcMetrics
+{
+public:
+
+    /**
+     * @brief Record the latencies of a reply written at \c reply_sent_ns and received at \c reply_received_ns ,
+     * whose request has times \c request .
+     *
+     * Latencies whose times are not set or not ordered (e.g. clock adjusted meanwhile) are ignored.
+     */
+    DDSPIPE_CORE_DllAPI
+    void record_reply(
+            const RpcRequestTimestamps& request,
+            int64_t reply_received_ns,
+            int64_t reply_sent_ns) noexcept;
+
+    //! Copy the current values of the histograms (service, timeouts and registries are not filled)
+    DDSPIPE_CORE_DllAPI
+    RpcMetricsSnapshot snapshot() const;
+
+protected:
+
+    //! Histogram of \c RpcMetricsSnapshot::bridge_latency
+    LatencyHistogram bridge_latency_;
+
+    //! Histogram of \c RpcMetricsSnapshot::server_round_trip
+    LatencyHistogram server_round_trip_;
+};
+
+//! \c RpcMetricsSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const RpcMetricsSnapshot& metrics);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,56 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include <ddspipe_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Counters of the requests correlated (or not) by a \c ServiceRegistry at a given moment
+struct ServiceRegistryMetricsSnapshot
+{
+    //! Requests added to the registry
+    uint64_t requests{0};
+
+    //! Replies correlated with their request
+    uint64_t correlated_replies{0};
+
+    //! Replies without a request in the registry (already replied by another server, expired or overwritten)
+    uint64_t uncorrelated_replies{0};
+
+    //! Requests removed without reply after the expiry time
+    uint64_t expired{0};
+
+    //! Requests overwritten without reply by a newer request, as the registry was full
+    uint64_t overwritten{0};
+
+    //! Requests currently waiting for their reply
+    uint64_t pending{0};
+};
+
+//! \c ServiceRegistryMetricsSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const ServiceRegistryMetricsSnapshot& metrics);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
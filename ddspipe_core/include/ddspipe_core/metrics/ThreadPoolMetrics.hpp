@@ -0,0 +1,54 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Values of the metrics of a priority class of a thread pool at a given moment
+struct PriorityClassMetricsSnapshot
+{
+    //! Priority class (higher is served first)
+    unsigned int priority{0};
+
+    //! Tasks of this class executed
+    uint64_t executed{0};
+
+    //! Tasks of this class executed before tasks of higher classes because they had waited too long
+    uint64_t starvation_promotions{0};
+
+    //! Tasks of this class currently waiting to be executed
+    uint64_t queue_depth{0};
+
+    //! Time from the emission of each task of this class until a thread starts executing it
+    LatencyHistogramSnapshot queueing_delay;
+};
+
+//! \c PriorityClassMetricsSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const PriorityClassMetricsSnapshot& metrics);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
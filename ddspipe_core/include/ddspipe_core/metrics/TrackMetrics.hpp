@@ -0,0 +1,171 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/metrics/HistoryMetrics.hpp>
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+#include <ddspipe_core/metrics/PaddedCounter.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+//! Values of the counters of a Writer of a \c Track at a given moment
+struct WriterMetricsSnapshot
+{
+    //! Samples written correctly
+    uint64_t written{0};
+
+    //! Samples whose write failed
+    uint64_t write_errors{0};
+
+    //! Samples discarded because the writer queue was full (only in parallel fan-out)
+    uint64_t dropped{0};
+
+    //! Samples currently waiting in the writer queue (only in parallel fan-out)
+    uint64_t queue_depth{0};
+
+    //! Size of the history of the Writer (only for Writers currently in the Track)
+    HistoryMetricsSnapshot history;
+};
+
+//! Values of the metrics of a \c Track at a given moment
+struct TrackMetricsSnapshot
+{
+    //! Topic of the Track (serialized)
+    std::string topic;
+
+    //! Id of the Participant of the Reader of the Track
+    types::ParticipantId reader_participant_id;
+
+    //! Samples taken from the Reader
+    uint64_t taken{0};
+
+    //! Samples received by the Reader but rejected before being taken
+    uint64_t rejected{0};
+
+    //! Size of the history of the Reader (empty while the Track is dormant)
+    HistoryMetricsSnapshot reader_history;
+
+    //! Counters of each Writer that has been in the Track
+    std::map<types::ParticipantId, WriterMetricsSnapshot> writers;
+
+    /**
+     * @brief Time from the source timestamp of each sample until it has been written by every Writer
+     *
+     * In parallel fan-out, each write is recorded independently (until it has been written by each Writer).
+     */
+    LatencyHistogramSnapshot source_latency;
+
+    //! Time from the reception of each sample in the Reader until it has been written (as \c source_latency )
+    LatencyHistogramSnapshot pipe_latency;
+};
+
+/**
+ * @brief Counters and latency histograms of the samples forwarded by a \c Track .
+ *
+ * Every counter is lock-free and cache line padded, so updating it in the transmission path has no measurable
+ * cost and can be read at any time from other threads.
+ *
+ * The map of Writers is not guarded: the owner must add Writers exclusively from any other access to the map
+ * (the \c Track does it with its mutex taken), while counters may be updated and read concurrently.
+ * References returned by \c writer remain valid while this object exists.
+ */
+class TrackMetrics
+{
+public:
+
+    //! Counters of each Writer
+    struct WriterCounters
+    {
+        //! Samples written correctly
+        PaddedCounter written;
+
+        //! Samples whose write failed
+        PaddedCounter write_errors;
+
+        //! Samples discarded because the writer queue was full
+        PaddedCounter dropped;
+    };
+
+    /**
+     * @brief Add the counters of a Writer.
+     *
+     * It does nothing if the Writer already has counters (they are kept when a Writer is removed and added again).
+     */
+    DDSPIPE_CORE_DllAPI
+    void add_writer(
+            const types::ParticipantId& id);
+
+    //! Counters of Writer \c id . It must have been added before.
+    DDSPIPE_CORE_DllAPI
+    WriterCounters& writer(
+            const types::ParticipantId& id);
+
+    //! Count \c n samples taken from the Reader
+    DDSPIPE_CORE_DllAPI
+    void taken(
+            uint64_t n) noexcept;
+
+    /**
+     * @brief Record the latencies of \c data at time \c now_ns (nanoseconds since epoch).
+     *
+     * Only data with timestamps (\c RtpsPayloadData ) is recorded; timestamps not set are ignored.
+     */
+    DDSPIPE_CORE_DllAPI
+    void record_latency(
+            const IRoutingData& data,
+            int64_t now_ns) noexcept;
+
+    //! Copy the current values of the metrics (topic, reader, rejected and histories are not filled)
+    DDSPIPE_CORE_DllAPI
+    TrackMetricsSnapshot snapshot() const;
+
+    //! Current time in nanoseconds since epoch, in the same clock as data timestamps
+    DDSPIPE_CORE_DllAPI
+    static int64_t now_ns() noexcept;
+
+protected:
+
+    //! Samples taken from the Reader
+    PaddedCounter taken_;
+
+    //! Counters of each Writer (stored in pointers so they do not move)
+    std::map<types::ParticipantId, std::unique_ptr<WriterCounters>> writers_;
+
+    //! Latency from the source timestamp
+    LatencyHistogram source_latency_;
+
+    //! Latency from the reception in the Reader
+    LatencyHistogram pipe_latency_;
+};
+
+//! \c TrackMetricsSnapshot to stream serialization
+DDSPIPE_CORE_DllAPI
+std::ostream& operator <<(
+        std::ostream& os,
+        const TrackMetricsSnapshot& metrics);
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -44,6 +44,17 @@ struct RpcPayloadData : public RtpsPayloadData
     DDSPIPE_CORE_DllAPI
     virtual types::TopicInternalTypeDiscriminator internal_type_discriminator() const noexcept override;
 
+    //! Allocate the object reusing the memory of objects already destroyed in this thread (see \c RtpsPayloadData )
+    DDSPIPE_CORE_DllAPI
+    static void* operator new(
+            std::size_t size);
+
+    //! Return the memory of a destroyed object to be reused by \c operator \c new
+    DDSPIPE_CORE_DllAPI
+    static void operator delete(
+            void* ptr,
+            std::size_t size) noexcept;
+
     //! Write params associated to the received cache change
     utils::Fuzzy<eprosima::fastrtps::rtps::WriteParams> write_params{};
 
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <fastdds/rtps/common/SerializedPayload.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 
@@ -58,6 +60,28 @@ struct RtpsPayloadData : public core::IRoutingData
     DDSPIPE_CORE_DllAPI
     virtual types::TopicInternalTypeDiscriminator internal_type_discriminator() const noexcept override;
 
+    /**
+     * @brief Allocate memory for a new object reusing the memory of objects already destroyed in this thread.
+     *
+     * A data is created and destroyed for each sample forwarded (destroyed by the default deleter of the
+     * \c std::unique_ptr<IRoutingData> that holds it), so recycling its memory avoids the allocation of the object
+     * itself per sample.
+     *
+     * @note The object is still constructed and destroyed for each sample, so \c writer_qos partitions copied from
+     * the source and \c participant_receiver ids longer than the small string buffer are still allocated per sample.
+     * Reusing constructed objects would require a custom deleter in the \c std::unique_ptr<IRoutingData> used by
+     * every \c IReader and \c IWriter .
+     */
+    DDSPIPE_CORE_DllAPI
+    static void* operator new(
+            std::size_t size);
+
+    //! Return the memory of a destroyed object to be reused by \c operator \c new
+    DDSPIPE_CORE_DllAPI
+    static void operator delete(
+            void* ptr,
+            std::size_t size) noexcept;
+
     //! Payload of the data received. The data in this payload must belong to the PayloadPool.
     core::types::Payload payload{};
 
@@ -71,6 +95,9 @@ struct RtpsPayloadData : public core::IRoutingData
     //! Specific Writer QoS of the Data
     core::types::SpecificEndpointQoS writer_qos{};
 
+    //! Hash of \c writer_qos , computed once when received so every Writer can use it (0 if not computed)
+    std::size_t writer_qos_hash{0};
+
     //! Instance of the message (default no instance)
     core::types::InstanceHandle instanceHandle{};
 
@@ -80,6 +107,9 @@ struct RtpsPayloadData : public core::IRoutingData
     //! Source time stamp of the message
     core::types::DataTime source_timestamp{};
 
+    //! Time stamp of the reception of the message in the Reader
+    core::types::DataTime reception_timestamp{};
+
     //! Guid of the source entity that has transmit the data
     core::types::Guid source_guid{};
 
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/common/InstanceHandle.h>
 #include <fastdds/rtps/common/Types.h>
@@ -61,6 +64,18 @@ SpecificEndpointQoS
     bool operator == (
             const SpecificEndpointQoS& other) const noexcept;
 
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief Hash of the partitions and ownership strength.
+     *
+     * Equal QoS have equal hashes. It is never 0, so 0 can be used as a hash not computed yet.
+     */
+    DDSPIPE_CORE_DllAPI
+    std::size_t hash() const noexcept;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
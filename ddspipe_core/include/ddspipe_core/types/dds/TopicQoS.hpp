@@ -122,6 +122,42 @@ TopicQoS
     DDSPIPE_CORE_DllAPI
     static std::atomic<float> default_max_reception_rate;
 
+    /**
+     * @brief Global value to store the default size of the writer queues in parallel fan-out in this execution.
+     *
+     * This value can change along the execution.
+     * Every new TopicQoS object will use this value as \c fanout_queue_size default.
+     */
+    DDSPIPE_CORE_DllAPI
+    static std::atomic<unsigned int> default_fanout_queue_size;
+
+    /**
+     * @brief Global value to store the default priority class of the topics in this execution.
+     *
+     * This value can change along the execution.
+     * Every new TopicQoS object will use this value as \c priority default.
+     */
+    DDSPIPE_CORE_DllAPI
+    static std::atomic<unsigned int> default_priority;
+
+    /**
+     * @brief Global value to store whether the histories are sized adaptively by default in this execution.
+     *
+     * This value can change along the execution.
+     * Every new TopicQoS object will use this value as \c adaptive_history default.
+     */
+    DDSPIPE_CORE_DllAPI
+    static std::atomic<bool> default_adaptive_history;
+
+    /**
+     * @brief Global value to store the default memory budget of the topics in this execution.
+     *
+     * This value can change along the execution.
+     * Every new TopicQoS object will use this value as \c memory_budget default.
+     */
+    DDSPIPE_CORE_DllAPI
+    static std::atomic<uint64_t> default_memory_budget;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
@@ -155,7 +191,33 @@ TopicQoS
     //! Discard msgs if less than 1/rate seconds elapsed since the last sample was processed [Hz]. Default: 0 (no limit)
     float max_reception_rate = 0;
 
+    //! Maximum number of samples taken from the reader and forwarded to the writers at once (batch_size=1 <=> no batching)
+    unsigned int batch_size = 1;
+
+    //! Samples queued for each writer when writers are written in parallel (fanout_queue_size=0 <=> writers written one after another)
+    unsigned int fanout_queue_size = 0;
+
+    //! Priority class of the transmission tasks of the topic, higher first (only honored by a priority thread pool)
+    unsigned int priority = 0;
+
+    /**
+     * @brief Whether the histories start with a few cache changes reserved and grow (and shrink) with the backlog
+     *
+     * Otherwise, they preallocate their cache changes (up to \c history_depth ) at creation.
+     */
+    bool adaptive_history = false;
+
+    /**
+     * @brief Maximum bytes of the payloads received in the topic held at once (memory_budget=0 <=> no limit)
+     *
+     * When exceeded, the policy of the memory budget of the DdsPipe applies (see \c MemoryBudgetConfiguration ).
+     */
+    uint64_t memory_budget = 0;
+
     static constexpr HistoryDepthType HISTORY_DEPTH_DEFAULT = 5000;
+
+    //! Cache changes reserved at creation by an adaptive history
+    static constexpr HistoryDepthType ADAPTIVE_HISTORY_INITIAL_CACHES = 16;
 };
 
 /**
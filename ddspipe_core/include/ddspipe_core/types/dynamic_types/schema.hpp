@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <fastrtps/types/DynamicTypePtr.h>
 
 #include <ddspipe_core/library/library_dll.h>
@@ -27,10 +29,23 @@ namespace ddspipe {
 namespace core {
 namespace types {
 
+/**
+ * @brief Generate the IDL schema of \c dynamic_type, preceded by the definitions of the types it depends on.
+ *
+ * The definition of each struct, enum and union is cached by type name and TypeIdentifier hash, so types
+ * shared by several schemas (or schemas generated again) are only rendered once.
+ * Types not registered in the TypeObjectFactory are regenerated on every call.
+ */
 DDSPIPE_CORE_DllAPI
 std::string generate_idl_schema(
         const fastrtps::types::DynamicType_ptr& dynamic_type);
 
+/**
+ * @brief Remove every cached type definition used by \c generate_idl_schema .
+ */
+DDSPIPE_CORE_DllAPI
+void clear_idl_schema_cache();
+
 } /* namespace types */
 } /* namespace core */
 } /* namespace ddspipe */
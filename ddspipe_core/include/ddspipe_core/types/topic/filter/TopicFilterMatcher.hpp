@@ -0,0 +1,177 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/memory/Heritable.hpp>
+
+#include <ddspipe_core/library/library_dll.h>
+#include <ddspipe_core/types/topic/filter/IFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+/**
+ * @brief Set of filters compiled to check whether a topic matches any of them in a single pass.
+ *
+ * The topic name and type name patterns of every \c WildcardDdsFilterTopic are compiled in two automatons
+ * (one for topic names and one for type names):
+ * - Patterns without wildcards are stored in a map, so they are checked with a single lookup.
+ * - Patterns with wildcards (* and ?) are merged in a single NFA, simulated once per name for all of them.
+ *
+ * A topic matches the set if any filter matches both its topic name and its type name.
+ *
+ * Filters that cannot be compiled (other kinds of filters, or patterns with bracket expressions or escapes)
+ * are checked one by one with their own \c matches method.
+ *
+ * @note In Windows, filters match names case insensitively (as \c utils::match_pattern ), which the automatons do
+ * not support. Thus, no filter is compiled and topic names are never looked up by prefix.
+ */
+class TopicFilterMatcher
+{
+public:
+
+    //! Construct a matcher that matches no topic
+    DDSPIPE_CORE_DllAPI
+    TopicFilterMatcher() = default;
+
+    //! Compile \c filters
+    DDSPIPE_CORE_DllAPI
+    TopicFilterMatcher(
+            const std::set<utils::Heritable<IFilterTopic>>& filters);
+
+    //! Whether there are no filters
+    DDSPIPE_CORE_DllAPI
+    bool empty() const noexcept;
+
+    //! Whether \c topic matches any of the filters
+    DDSPIPE_CORE_DllAPI
+    bool matches(
+            const ITopic& topic) const noexcept;
+
+    /**
+     * @brief Get the prefixes that every topic name matched by the filters starts with.
+     *
+     * It allows to look up the topics that may match the filters in an index sorted by topic name,
+     * instead of checking every topic.
+     * A prefix that starts with another prefix of the set is not added, as it would give repeated topics.
+     *
+     * @param [out] prefixes prefixes of the topic names that may match
+     *
+     * @return false if the filters may match topic names with any prefix (\c prefixes is not filled)
+     */
+    DDSPIPE_CORE_DllAPI
+    bool topic_name_prefixes(
+            std::set<std::string>& prefixes) const noexcept;
+
+protected:
+
+    /**
+     * @brief Automaton that matches a string against several glob patterns at once.
+     *
+     * Each pattern is identified by the index of its filter.
+     */
+    class GlobAutomaton
+    {
+    public:
+
+        /**
+         * @brief Add \c pattern of filter \c filter_index .
+         *
+         * @pre \c pattern has no bracket expressions nor escapes ( see \c is_compilable ).
+         */
+        void add(
+                const std::string& pattern,
+                std::size_t filter_index);
+
+        //! Set to true the element of \c matched of each filter whose pattern matches \c value
+        void match(
+                const std::string& value,
+                std::vector<bool>& matched) const noexcept;
+
+        //! Whether \c pattern can be added to an automaton (never in Windows)
+        static bool is_compilable(
+                const std::string& pattern) noexcept;
+
+    protected:
+
+        //! Kinds of transitions from a state
+        enum class Transition
+        {
+            literal,    //! Consumes the character of the state
+            any,        //! Consumes any character ( ? )
+            star,       //! Consumes any sequence of characters, including an empty one ( * )
+            accept      //! Final state of a pattern
+        };
+
+        //! Add \c state and the states reachable from it without consuming characters to \c states
+        void add_with_closure_(
+                std::size_t state,
+                std::vector<std::size_t>& states,
+                std::vector<std::size_t>& visited,
+                std::size_t step) const noexcept;
+
+        //! Filters of each pattern without wildcards
+        std::map<std::string, std::vector<std::size_t>> literals_;
+
+        //! Transition from each state
+        std::vector<Transition> transitions_;
+
+        //! Character consumed from each state (only for \c Transition::literal )
+        std::vector<char> characters_;
+
+        //! Filter of each state (only for \c Transition::accept )
+        std::vector<std::size_t> filters_;
+
+        //! Initial state of each pattern with wildcards
+        std::vector<std::size_t> initial_states_;
+    };
+
+    //! Number of filters compiled
+    std::size_t n_filters_{0};
+
+    //! Topic name patterns
+    GlobAutomaton topic_names_;
+
+    //! Type name patterns
+    GlobAutomaton type_names_;
+
+    //! Filters without topic name pattern (they match every topic name)
+    std::vector<bool> any_topic_name_;
+
+    //! Filters without type name pattern (they match every type name)
+    std::vector<bool> any_type_name_;
+
+    //! Filters that are not compiled
+    std::vector<utils::Heritable<IFilterTopic>> uncompiled_filters_;
+
+    //! Prefixes of the topic name patterns
+    std::set<std::string> topic_name_prefixes_;
+
+    //! Whether any filter matches topic names with any prefix
+    bool any_topic_name_prefix_{false};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -34,5 +34,6 @@ set(fastrtps_MINIMUM_VERSION "2.8")
 
 set(MODULE_DEPENDENCIES
     $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi>
+    $<$<PLATFORM_ID:Linux>:rt>
     ${MODULE_FIND_PACKAGES}
 )
@@ -24,7 +24,7 @@ namespace core {
 Bridge::Bridge(
         const std::shared_ptr<ParticipantsDatabase>& participants_database,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool)
+        const std::shared_ptr<IThreadPool>& thread_pool)
     : participants_(participants_database)
     , payload_pool_(payload_pool)
     , thread_pool_(thread_pool)
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
 
@@ -27,11 +28,15 @@ DdsBridge::DdsBridge(
         const utils::Heritable<DistributedTopic>& topic,
         const std::shared_ptr<ParticipantsDatabase>& participants_database,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const std::shared_ptr<IThreadPool>& thread_pool,
         const RoutesConfiguration& routes_config,
-        const bool remove_unused_entities)
+        const bool remove_unused_entities,
+        const bool lazy_readers /* = false */,
+        const std::set<ParticipantId>& participants_with_writers /* = {} */)
     : Bridge(participants_database, payload_pool, thread_pool)
     , topic_(topic)
+    , lazy_readers_(lazy_readers)
+    , participants_with_writers_(participants_with_writers)
 {
     logDebug(DDSPIPE_DDSBRIDGE, "Creating DdsBridge " << *this << ".");
 
@@ -179,11 +184,131 @@ void DdsBridge::remove_writer(
         if (!track->has_writers())
         {
             // The track doesn't have any writers. Remove it.
+            idle_readers_.erase(it->first);
             tracks_.erase(it);
         }
     }
 }
 
+void DdsBridge::set_remote_writers(
+        const ParticipantId& participant_id,
+        bool has_writers) noexcept
+{
+    if (!lazy_readers_)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto track_it = tracks_.find(participant_id);
+
+    if (!has_writers)
+    {
+        participants_with_writers_.erase(participant_id);
+
+        if (track_it != tracks_.end() && !track_it->second->is_dormant())
+        {
+            idle_readers_.emplace(participant_id, std::chrono::steady_clock::now());
+        }
+
+        return;
+    }
+
+    participants_with_writers_.insert(participant_id);
+    idle_readers_.erase(participant_id);
+
+    if (track_it == tracks_.end() || !track_it->second->is_dormant())
+    {
+        return;
+    }
+
+    try
+    {
+        std::shared_ptr<IParticipant> participant = participants_->get_participant(participant_id);
+        track_it->second->wake_up(participant->create_reader(*topic_));
+    }
+    catch (const utils::InitializationException& e)
+    {
+        logError(DDSPIPE_DDSBRIDGE,
+                "Error creating Reader in " << participant_id << " for topic " << topic_ <<
+                ". Error code:" << e.what() << ".");
+    }
+}
+
+void DdsBridge::remove_idle_readers(
+        const std::chrono::milliseconds& idle_timeout) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto it = idle_readers_.begin(); it != idle_readers_.end();)
+    {
+        if (now - it->second < idle_timeout)
+        {
+            ++it;
+            continue;
+        }
+
+        auto track_it = tracks_.find(it->first);
+
+        if (track_it != tracks_.end())
+        {
+            track_it->second->make_dormant();
+        }
+
+        it = idle_readers_.erase(it);
+    }
+}
+
+std::vector<TrackMetricsSnapshot> DdsBridge::metrics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<TrackMetricsSnapshot> result;
+    result.reserve(tracks_.size());
+
+    for (const auto& track_it : tracks_)
+    {
+        result.push_back(track_it.second->metrics());
+    }
+
+    return result;
+}
+
+HistoryMetricsSnapshot DdsBridge::history_metrics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    HistoryMetricsSnapshot result;
+
+    // The same Writer is in several Tracks, and the Tracks it has been removed from report an empty history
+    std::map<ParticipantId, HistoryMetricsSnapshot> writers_history;
+
+    for (const auto& track_it : tracks_)
+    {
+        TrackMetricsSnapshot track_metrics = track_it.second->metrics();
+        result += track_metrics.reader_history;
+
+        for (const auto& writer_it : track_metrics.writers)
+        {
+            HistoryMetricsSnapshot& writer_history = writers_history[writer_it.first];
+            if (writer_it.second.history.reserved_caches > writer_history.reserved_caches)
+            {
+                writer_history = writer_it.second.history;
+            }
+        }
+    }
+
+    for (const auto& writer_it : writers_history)
+    {
+        result += writer_it.second;
+    }
+
+    return result;
+}
+
 void DdsBridge::add_writer_to_tracks_nts_(
         const ParticipantId& participant_id,
         std::shared_ptr<IWriter>& writer)
@@ -257,9 +382,14 @@ void DdsBridge::add_writers_to_tracks_nts_(
         }
         else
         {
-            // The track doesn't exist. Create it.
+            // The track doesn't exist. Create it (dormant if its Reader is created lazily).
             std::shared_ptr<IParticipant> participant = participants_->get_participant(id);
-            auto reader = participant->create_reader(*topic_);
+
+            std::shared_ptr<IReader> reader;
+            if (!is_reader_dormant_nts_(id, participant))
+            {
+                reader = participant->create_reader(*topic_);
+            }
 
             tracks_[id] = std::make_unique<Track>(
                 topic_,
@@ -277,6 +407,15 @@ void DdsBridge::add_writers_to_tracks_nts_(
     }
 }
 
+bool DdsBridge::is_reader_dormant_nts_(
+        const ParticipantId& participant_id,
+        const std::shared_ptr<IParticipant>& participant) const noexcept
+{
+    return lazy_readers_ &&
+           participant->reports_discovery() &&
+           participants_with_writers_.count(participant_id) == 0;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const DdsBridge& bridge)
@@ -17,12 +17,15 @@
  *
  */
 
+#include <algorithm>
+
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
-#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/thread_pool/task/TaskId.hpp>
+#include <cpp_utils/types/cast.hpp>
 
 #include <ddspipe_core/communication/dds/Track.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -30,7 +33,54 @@ namespace core {
 
 using namespace eprosima::ddspipe::core::types;
 
-const unsigned int Track::MAX_MESSAGES_TRANSMIT_LOOP_ = 100;
+namespace {
+
+//! Batch size of the topic if it is a DdsTopic (with QoS), 1 otherwise
+unsigned int topic_batch_size(
+        const ITopic& topic) noexcept
+{
+    if (utils::can_cast<DdsTopic>(topic))
+    {
+        unsigned int batch_size = dynamic_cast<const DdsTopic&>(topic).topic_qos.batch_size;
+        return batch_size > 0 ? batch_size : 1;
+    }
+    return 1;
+}
+
+//! Fan-out queue size of the topic if it is a DdsTopic (with QoS), 0 otherwise
+unsigned int topic_fanout_queue_size(
+        const ITopic& topic) noexcept
+{
+    if (utils::can_cast<DdsTopic>(topic))
+    {
+        return dynamic_cast<const DdsTopic&>(topic).topic_qos.fanout_queue_size;
+    }
+    return 0;
+}
+
+//! Priority class of the topic if it is a DdsTopic (with QoS), 0 otherwise
+unsigned int topic_priority(
+        const ITopic& topic) noexcept
+{
+    if (utils::can_cast<DdsTopic>(topic))
+    {
+        return dynamic_cast<const DdsTopic&>(topic).topic_qos.priority;
+    }
+    return 0;
+}
+
+//! Memory budget of the topic if it is a DdsTopic (with QoS), 0 (unlimited) otherwise
+uint64_t topic_memory_budget(
+        const ITopic& topic) noexcept
+{
+    if (utils::can_cast<DdsTopic>(topic))
+    {
+        return dynamic_cast<const DdsTopic&>(topic).topic_qos.memory_budget;
+    }
+    return 0;
+}
+
+} /* namespace */
 
 Track::Track(
         const utils::Heritable<DistributedTopic>& topic,
@@ -38,27 +88,59 @@ Track::Track(
         const std::shared_ptr<IReader>& reader,
         std::map<ParticipantId, std::shared_ptr<IWriter>>&& writers,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool) noexcept
+        const std::shared_ptr<IThreadPool>& thread_pool) noexcept
     : topic_(topic)
     , reader_participant_id_(reader_participant_id)
     , reader_(std::move(reader))
-    , writers_(std::move(writers))
+    , writers_(std::make_shared<const WriterList>())
     , payload_pool_(payload_pool)
+    , batch_size_(topic_batch_size(*topic))
+    , fanout_queue_size_(topic_fanout_queue_size(*topic))
+    , priority_(topic_priority(*topic))
+    , memory_budget_(topic_memory_budget(*topic))
+    , memory_downsampling_idx_(0)
     , enabled_(false)
     , exit_(false)
     , data_available_status_(DataAvailableStatus::no_more_data)
     , transmit_task_id_(utils::new_unique_task_id())
     , thread_pool_(thread_pool)
+    , task_guard_(std::make_shared<TaskGuard>())
 {
-    logDebug(DDSPIPE_TRACK, "Creating Track " << *this << ".");
+    logDebug(DDSPIPE_TRACK, "Creating Track " << *this << " with batch size " << batch_size_
+                                              << " and fan-out queue size " << fanout_queue_size_ << ".");
+
+    batch_.reserve(batch_size_);
+
+    // Charge the payloads taken to this topic and to the Participant of the Reader
+    if (payload_pool_)
+    {
+        memory_accountant_ = payload_pool_->memory_accountant();
+    }
+    if (memory_accountant_)
+    {
+        topic_memory_account_ = memory_accountant_->topic_account(topic_->serialize());
+        participant_memory_account_ = memory_accountant_->participant_account(reader_participant_id_);
+    }
+
+    auto initial_writers = std::make_shared<WriterList>();
+    initial_writers->reserve(writers.size());
+    for (const auto& writer_it : writers)
+    {
+        initial_writers->push_back(new_writer_entry_nts_(writer_it.first, writer_it.second));
+    }
+    writers_ = std::move(initial_writers);
 
     // Set this track to on_data_available lambda call
-    reader_->set_on_data_available_callback(std::bind(&Track::data_available_, this));
+    if (reader_)
+    {
+        reader_->set_on_data_available_callback(std::bind(&Track::data_available_, this));
+    }
 
     // Set slot in thread pool
+    // The transmission emits its own task to yield its thread, so an emission may be pending when destroyed
     thread_pool_->slot(
         transmit_task_id_,
-        std::bind(&Track::transmit_, this));
+        guarded_task_(std::bind(&Track::transmit_, this)));
 
     logDebug(DDSPIPE_TRACK, "Track " << *this << " created.");
 }
@@ -71,12 +153,28 @@ Track::~Track()
     disable();
 
     // Unset callback on the Reader (this is needed as Reader will live longer than Track)
-    reader_->unset_on_data_available_callback();
+    if (reader_)
+    {
+        reader_->unset_on_data_available_callback();
+    }
 
     // It does need to guard the mutex to avoid notifying Track thread while it is checking variable condition
     // Set exit status and call transmit thread to awake and terminate. Then wait for it.
     exit_.store(true);
 
+    // Wait for the transmission and the writer queues in course, and skip the tasks still emitted in the thread pool
+    task_guard_->close();
+
+    thread_pool_->unslot(transmit_task_id_);
+
+    for (const auto& entry : *writers_)
+    {
+        if (entry.queue)
+        {
+            thread_pool_->unslot(entry.queue->task_id);
+        }
+    }
+
     logDebug(DDSPIPE_TRACK, "Track " << *this << " destroyed.");
 }
 
@@ -100,13 +198,16 @@ void Track::enable() noexcept
         // attempt to write with a yet disabled writer
 
         // Enabling writers
-        for (auto& writer_it : writers_)
+        for (const auto& entry : *writers_)
         {
-            writer_it.second->enable();
+            entry.writer->enable();
         }
 
         // Enabling reader
-        reader_->enable();
+        if (reader_)
+        {
+            reader_->enable();
+        }
     }
 }
 
@@ -124,16 +225,29 @@ void Track::disable() noexcept
         enabled_ = false;
         {
             // Stop if there is a transmission in course till the data is sent
-            std::unique_lock<std::mutex> lock(on_transmission_mutex_);
+            std::unique_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+
+            // Samples not written yet are discarded, as in a disabled reader
+            for (const auto& entry : *writers_)
+            {
+                if (entry.queue)
+                {
+                    std::lock_guard<std::mutex> queue_lock(entry.queue->mutex);
+                    entry.queue->samples.clear();
+                }
+            }
         }
 
         // Disabling Reader
-        reader_->disable();
+        if (reader_)
+        {
+            reader_->disable();
+        }
 
         // Disabling Writers
-        for (auto& writer_it : writers_)
+        for (const auto& entry : *writers_)
         {
-            writer_it.second->disable();
+            entry.writer->disable();
         }
     }
 }
@@ -142,36 +256,168 @@ void Track::add_writer(
         const ParticipantId& id,
         const std::shared_ptr<IWriter>& writer) noexcept
 {
+    // The transmission is not stopped: it keeps the previous Writers until it loads them again
     std::lock_guard<std::mutex> track_lock(track_mutex_);
-    std::lock_guard<std::mutex> transmission_lock(on_transmission_mutex_);
 
     if (enabled_)
     {
         writer->enable();
     }
 
-    writers_[id] = writer;
+    auto new_writers = std::make_shared<WriterList>(*writers_);
+    WriterEntry entry = new_writer_entry_nts_(id, writer);
+
+    auto entry_it = std::find_if(new_writers->begin(), new_writers->end(),
+                    [&id](const WriterEntry& other)
+                    {
+                        return other.id == id;
+                    });
+
+    if (entry_it != new_writers->end())
+    {
+        *entry_it = std::move(entry);
+    }
+    else
+    {
+        new_writers->push_back(std::move(entry));
+    }
+
+    publish_writers_nts_(std::move(new_writers));
 }
 
 void Track::remove_writer(
         const ParticipantId& id) noexcept
 {
+    // The transmission is not stopped: it keeps the previous Writers until it loads them again
     std::lock_guard<std::mutex> track_lock(track_mutex_);
-    std::lock_guard<std::mutex> transmission_lock(on_transmission_mutex_);
-    writers_.erase(id);
+
+    auto new_writers = std::make_shared<WriterList>();
+    new_writers->reserve(writers_->size());
+
+    for (const auto& entry : *writers_)
+    {
+        if (entry.id != id)
+        {
+            new_writers->push_back(entry);
+        }
+    }
+
+    publish_writers_nts_(std::move(new_writers));
 }
 
 bool Track::has_writer(
         const ParticipantId& id) noexcept
 {
     std::lock_guard<std::mutex> lock(track_mutex_);
-    return writers_.count(id) != 0;
+
+    for (const auto& entry : *writers_)
+    {
+        if (entry.id == id)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool Track::has_writers() noexcept
 {
     std::lock_guard<std::mutex> lock(track_mutex_);
-    return writers_.size() > 0;
+    return writers_->size() > 0;
+}
+
+bool Track::is_dormant() noexcept
+{
+    std::lock_guard<std::mutex> lock(track_mutex_);
+    return !reader_;
+}
+
+void Track::wake_up(
+        const std::shared_ptr<IReader>& reader) noexcept
+{
+    std::lock_guard<std::mutex> track_lock(track_mutex_);
+
+    if (reader_)
+    {
+        return;
+    }
+
+    logInfo(DDSPIPE_TRACK,
+            "Waking up Track " << reader_participant_id_ << " for topic " << topic_->serialize() << ".");
+
+    {
+        // A transmission left behind must not see the Reader being set
+        std::unique_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+        reader_ = reader;
+        data_available_status_.store(DataAvailableStatus::no_more_data);
+    }
+
+    reader_->set_on_data_available_callback(std::bind(&Track::data_available_, this));
+
+    if (enabled_)
+    {
+        reader_->enable();
+    }
+}
+
+void Track::make_dormant() noexcept
+{
+    std::lock_guard<std::mutex> track_lock(track_mutex_);
+
+    if (!reader_)
+    {
+        return;
+    }
+
+    logInfo(DDSPIPE_TRACK,
+            "Track " << reader_participant_id_ << " for topic " << topic_->serialize() << " becomes dormant.");
+
+    std::shared_ptr<IReader> reader;
+
+    // Set before taking the mutex so a transmission in course finishes after current iteration
+    releasing_reader_ = true;
+    {
+        // Stop if there is a transmission in course till the data is sent
+        std::unique_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+
+        reader = std::move(reader_);
+        reader_.reset();
+        releasing_reader_ = false;
+    }
+
+    reader->disable();
+    reader->unset_on_data_available_callback();
+    rejected_by_released_readers_ += reader->rejected_samples();
+}
+
+TrackMetricsSnapshot Track::metrics() noexcept
+{
+    // Writers of the metrics are only added with this mutex taken
+    std::lock_guard<std::mutex> lock(track_mutex_);
+
+    TrackMetricsSnapshot result = metrics_.snapshot();
+    result.topic = topic_->serialize();
+    result.reader_participant_id = reader_participant_id_;
+    result.rejected = rejected_by_released_readers_ + (reader_ ? reader_->rejected_samples() : 0);
+
+    if (reader_)
+    {
+        result.reader_history = reader_->history_metrics();
+    }
+
+    // Writers are only replaced with this mutex taken
+    for (const auto& entry : *writers_)
+    {
+        result.writers[entry.id].history = entry.writer->history_metrics();
+
+        if (entry.queue)
+        {
+            std::lock_guard<std::mutex> queue_lock(entry.queue->mutex);
+            result.writers[entry.id].queue_depth = entry.queue->samples.size();
+        }
+    }
+
+    return result;
 }
 
 bool Track::should_transmit_() noexcept
@@ -193,7 +439,7 @@ void Track::data_available_() noexcept
         {
             // no_more_data was set as current status, so no thread was running
             // (and will not start as 2 is set as new current status)
-            thread_pool_->emit(transmit_task_id_);
+            thread_pool_->emit(transmit_task_id_, priority_);
             logDebug(DDSPIPE_TRACK, "Track " << *this << " send callback to queue.");
         }
     }
@@ -207,18 +453,39 @@ void Track::transmit_() noexcept
     // Lock Mutex on_transmition while a data is being transmitted
     // This prevents the Track to be disabled (and disable writers and readers) while sending a data
     // enabled_ will be set to false before taking the mutex, so the track will finish after current iteration
-    std::unique_lock<std::mutex> lock(on_transmission_mutex_);
+    // It is taken shared, so the writer queues can be drained at the same time
+    std::shared_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+    std::lock_guard<std::mutex> transmit_lock(transmit_mutex_);
+
+    // Samples taken in this turn, to yield the thread after the budget of the thread pool (if any)
+    const unsigned int messages_per_turn = thread_pool_->messages_per_turn();
+    unsigned int messages_taken = 0;
 
-    // TODO: Count the times it loops to break it at some point if needed
     while (should_transmit_())
     {
+        if (messages_per_turn > 0 && messages_taken >= messages_per_turn)
+        {
+            // Status is kept >= 1, so the task emitted here is the only one that continues the transmission
+            logDebug(DDSPIPE_TRACK, "Track " << *this << " yields its thread after " << messages_taken << " messages.");
+            thread_pool_->emit(transmit_task_id_, priority_);
+            break;
+        }
+
+        if (!reader_ || releasing_reader_)
+        {
+            // The Track became (or is becoming) dormant after this task was emitted
+            data_available_status_.store(DataAvailableStatus::no_more_data);
+            break;
+        }
+
         // It starts transmitting, so it sets the data available status as transmitting
         // This will erase every previous value added in on_data_available and set 1
         data_available_status_.store(DataAvailableStatus::transmitting_data);
 
         // Get data received (send empty data to be created(allocated) in reader)
-        std::unique_ptr<IRoutingData> data;
-        utils::ReturnCode ret = reader_->take(data);
+        // Clearing the batch releases the data already sent
+        batch_.clear();
+        utils::ReturnCode ret = reader_->take_batch(batch_size_, batch_);
 
         if (ret == utils::ReturnCode::RETCODE_NO_DATA)
         {
@@ -248,30 +515,345 @@ void Track::transmit_() noexcept
 
         logDebug(DDSPIPE_TRACK,
                 "Track " << reader_participant_id_ << " for topic " << topic_->serialize() <<
-                " transmitting data from remote endpoint.");
+                " transmitting " << batch_.size() << " data from remote endpoint.");
+
+        metrics_.taken(batch_.size());
+        messages_taken += batch_.size();
+
+        // Writers added or removed from now on are used from the next batch
+        std::shared_ptr<const WriterList> writers = current_writers_();
+
+        if (memory_accountant_)
+        {
+            apply_memory_budget_nts_(*writers);
+
+            if (batch_.empty())
+            {
+                // Every sample has been discarded to keep within the memory budget
+                continue;
+            }
+        }
+
+        if (fanout_queue_size_ > 0)
+        {
+            // Writers write the data in parallel in their own tasks
+            fanout_nts_(*writers);
+            continue;
+        }
 
         // Send data through writers
-        for (auto& writer_it : writers_)
+        for (const auto& entry : *writers)
         {
             logDebug(
                 DDSPIPE_TRACK,
-                "Forwarding data to writer " << writer_it.first << ".");
+                "Forwarding data to writer " << entry.id << ".");
 
-            ret = writer_it.second->write(*data);
+            ret = entry.writer->write_batch(batch_);
 
-            if (!ret)
+            if (ret)
+            {
+                entry.counters->written.increment(batch_.size());
+            }
+            else
             {
+                // The failed sample of the batch is not known, so the whole batch is counted as failed
+                entry.counters->write_errors.increment(batch_.size());
+
                 logWarning(
                     DDSPIPE_TRACK,
                     "Error writting data in Track " << topic_->serialize()
-                                                    << " for writer " << writer_it.second.get()
+                                                    << " for writer " << entry.writer.get()
                                                     << ". Error code " << ret
                                                     << ". Skipping data for this writer and continue.");
-                continue;
             }
         }
 
-        // Let the data to be removed by itself
+        // Data has been written by every writer: record its latency
+        int64_t now_ns = TrackMetrics::now_ns();
+        for (const auto& data : batch_)
+        {
+            metrics_.record_latency(*data, now_ns);
+        }
+
+        // Let the data to be removed by itself when the batch is cleared
+    }
+
+    // Release the data of the last batch before leaving the transmission
+    batch_.clear();
+}
+
+void Track::apply_memory_budget_nts_(
+        const WriterList& writers) noexcept
+{
+    for (const auto& data : batch_)
+    {
+        const RtpsPayloadData* rtps_data = dynamic_cast<const RtpsPayloadData*>(data.get());
+        if (rtps_data != nullptr)
+        {
+            memory_accountant_->charge(rtps_data->payload, *topic_memory_account_, *participant_memory_account_);
+        }
+    }
+
+    if (!over_memory_budget_())
+    {
+        return;
+    }
+
+    const MemoryBudgetConfiguration& configuration = memory_accountant_->configuration();
+
+    switch (configuration.policy)
+    {
+        case MemoryBudgetPolicy::drop_oldest:
+        {
+            // Remove the oldest samples of the Writers of this topic while it is over its budget.
+            // A payload shared by several Writers is only released once every Writer has removed it, so each
+            // round removes one sample of every Writer.
+            uint64_t reserved_bytes = memory_accountant_->reserved_bytes();
+            while (topic_over_memory_budget_())
+            {
+                bool dropped = false;
+                for (const auto& entry : writers)
+                {
+                    if (entry.writer->drop_oldest())
+                    {
+                        topic_memory_account_->dropped_oldest++;
+                        dropped = true;
+                    }
+                }
+
+                // Stop if the samples removed are still referenced elsewhere (e.g. by other histories)
+                uint64_t new_reserved_bytes = memory_accountant_->reserved_bytes();
+                if (!dropped || new_reserved_bytes >= reserved_bytes)
+                {
+                    break;
+                }
+                reserved_bytes = new_reserved_bytes;
+            }
+            break;
+        }
+
+        case MemoryBudgetPolicy::reject:
+        {
+            topic_memory_account_->rejected += batch_.size();
+            batch_.clear();
+            break;
+        }
+
+        case MemoryBudgetPolicy::downsample:
+        {
+            // Keep 1 out of every N samples, counting from the previous batches
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < batch_.size(); i++)
+            {
+                if (memory_downsampling_idx_++ % configuration.downsampling == 0)
+                {
+                    batch_[kept++] = std::move(batch_[i]);
+                }
+                else
+                {
+                    topic_memory_account_->downsampled++;
+                }
+            }
+            batch_.resize(kept);
+            break;
+        }
+    }
+
+    logDebug(DDSPIPE_TRACK, "Track " << *this << " over memory budget: "
+                                     << topic_memory_account_->bytes << " bytes in topic, "
+                                     << memory_accountant_->reserved_bytes() << " bytes reserved in total.");
+}
+
+bool Track::over_memory_budget_() const noexcept
+{
+    return memory_accountant_->over_budget() ||
+           (memory_budget_ > 0 && topic_memory_account_->bytes > memory_budget_);
+}
+
+bool Track::topic_over_memory_budget_() const noexcept
+{
+    uint64_t topic_bytes = topic_memory_account_->bytes;
+
+    if (memory_budget_ > 0 && topic_bytes > memory_budget_)
+    {
+        return true;
+    }
+
+    return memory_accountant_->over_budget() && topic_bytes > memory_accountant_->topic_share();
+}
+
+IThreadPool::Task Track::guarded_task_(
+        IThreadPool::Task&& task) const noexcept
+{
+    return TaskGuard::guarded_task(task_guard_, std::move(task));
+}
+
+Track::WriterEntry Track::new_writer_entry_nts_(
+        const ParticipantId& id,
+        const std::shared_ptr<IWriter>& writer) noexcept
+{
+    metrics_.add_writer(id);
+
+    WriterEntry entry;
+    entry.id = id;
+    entry.writer = writer;
+    entry.counters = &metrics_.writer(id);
+
+    if (fanout_queue_size_ > 0)
+    {
+        entry.queue = std::make_shared<WriterQueue>();
+        entry.queue->writer = writer;
+        entry.queue->counters = entry.counters;
+        entry.queue->task_id = utils::new_unique_task_id();
+
+        // The slot keeps its own reference to the queue, so a task emitted before the queue is removed is harmless
+        thread_pool_->slot(
+            entry.queue->task_id,
+            guarded_task_(std::bind(&Track::drain_writer_queue_, this, entry.queue)));
+    }
+
+    return entry;
+}
+
+std::shared_ptr<const Track::WriterList> Track::current_writers_() const noexcept
+{
+    return std::atomic_load(&writers_);
+}
+
+void Track::publish_writers_nts_(
+        std::shared_ptr<const WriterList> writers) noexcept
+{
+    std::shared_ptr<const WriterList> old_writers = std::atomic_exchange(&writers_, writers);
+
+    // Queues of the Writers removed (or replaced) are left empty, so a task already emitted finishes without writing
+    for (const auto& old_entry : *old_writers)
+    {
+        if (!old_entry.queue)
+        {
+            continue;
+        }
+
+        bool kept = false;
+        for (const auto& entry : *writers)
+        {
+            if (entry.queue == old_entry.queue)
+            {
+                kept = true;
+                break;
+            }
+        }
+
+        if (!kept)
+        {
+            thread_pool_->unslot(old_entry.queue->task_id);
+
+            std::lock_guard<std::mutex> queue_lock(old_entry.queue->mutex);
+            old_entry.queue->samples.clear();
+        }
+    }
+}
+
+void Track::fanout_nts_(
+        const WriterList& writers) noexcept
+{
+    for (auto& data : batch_)
+    {
+        // Every queue references the same data, that is released when the last Writer has written it
+        std::shared_ptr<IRoutingData> shared_data(std::move(data));
+
+        for (const auto& entry : writers)
+        {
+            WriterQueue& queue = *entry.queue;
+            bool emit = false;
+
+            {
+                std::lock_guard<std::mutex> queue_lock(queue.mutex);
+
+                if (queue.samples.size() >= fanout_queue_size_)
+                {
+                    // Writer too slow: drop the oldest sample rather than blocking the rest of Writers
+                    queue.samples.pop_front();
+                    queue.counters->dropped.increment();
+
+                    logDebug(
+                        DDSPIPE_TRACK,
+                        "Queue of writer " << entry.id << " in Track " << *this
+                                           << " full. Dropping oldest sample.");
+                }
+
+                queue.samples.push_back(shared_data);
+
+                if (!queue.draining)
+                {
+                    queue.draining = true;
+                    emit = true;
+                }
+            }
+
+            if (emit)
+            {
+                thread_pool_->emit(queue.task_id, priority_);
+            }
+        }
+    }
+}
+
+void Track::drain_writer_queue_(
+        const std::shared_ptr<WriterQueue>& queue) noexcept
+{
+    // Shared with transmit_ and the rest of queues, so the Track cannot be disabled while writing
+    std::shared_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+
+    const unsigned int messages_per_turn = thread_pool_->messages_per_turn();
+    unsigned int messages_written = 0;
+
+    while (true)
+    {
+        std::shared_ptr<IRoutingData> data;
+
+        {
+            std::lock_guard<std::mutex> queue_lock(queue->mutex);
+
+            if (!should_transmit_() || queue->samples.empty())
+            {
+                // Set it inside the queue mutex, so a sample pushed after this emits the task again
+                queue->draining = false;
+                return;
+            }
+
+            if (messages_per_turn > 0 && messages_written >= messages_per_turn)
+            {
+                // Keep draining set, so the task emitted here is the only one that continues with the queue
+                thread_pool_->emit(queue->task_id, priority_);
+                return;
+            }
+
+            messages_written++;
+
+            data = std::move(queue->samples.front());
+            queue->samples.pop_front();
+        }
+
+        utils::ReturnCode ret = queue->writer->write(*data);
+
+        if (ret)
+        {
+            queue->counters->written.increment();
+
+            // Each Writer records the latency of its own write
+            metrics_.record_latency(*data, TrackMetrics::now_ns());
+        }
+        else
+        {
+            queue->counters->write_errors.increment();
+
+            logWarning(
+                DDSPIPE_TRACK,
+                "Error writting data in Track " << topic_->serialize()
+                                                << " for writer " << queue->writer.get()
+                                                << ". Error code " << ret
+                                                << ". Skipping data for this writer and continue.");
+        }
     }
 }
 
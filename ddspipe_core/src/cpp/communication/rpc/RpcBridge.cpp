@@ -26,6 +26,7 @@
 
 #include <ddspipe_core/types/data/RpcPayloadData.hpp>
 #include <ddspipe_core/communication/rpc/RpcBridge.hpp>
+#include <ddspipe_core/metrics/TrackMetrics.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -37,10 +38,13 @@ RpcBridge::RpcBridge(
         const RpcTopic& topic,
         const std::shared_ptr<ParticipantsDatabase>& participants_database,
         const std::shared_ptr<PayloadPool>& payload_pool,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool)
+        const std::shared_ptr<IThreadPool>& thread_pool,
+        unsigned int request_expiry_ms /* = ServiceRegistry::DEFAULT_EXPIRY_MS */)
     : Bridge(participants_database, payload_pool, thread_pool)
     , init_(false)
+    , request_expiry_ms_(request_expiry_ms)
     , rpc_topic_(topic)
+    , task_guard_(std::make_shared<TaskGuard>())
 {
     logDebug(DDSPIPE_RPCBRIDGE, "Creating RpcBridge " << *this << ".");
 
@@ -54,6 +58,19 @@ RpcBridge::~RpcBridge()
     // Disable all entities before destruction
     disable();
 
+    // Wait for the transmissions and forwardings in course, and skip the tasks still emitted in the thread pool
+    task_guard_->close();
+
+    for (const auto& task_it : tasks_map_)
+    {
+        thread_pool_->unslot(task_it.second.second);
+    }
+
+    for (const auto& queue_it : request_queues_)
+    {
+        thread_pool_->unslot(queue_it.second->task_id);
+    }
+
     logDebug(DDSPIPE_RPCBRIDGE, "RpcBridge " << *this << " destroyed.");
 }
 
@@ -104,7 +121,21 @@ void RpcBridge::create_proxy_client_nts_(
     create_slot_(reply_readers_[participant_id]);
 
     // Create service registry associated to this proxy client
-    service_registries_[participant_id] = std::make_shared<ServiceRegistry>(rpc_topic_, participant_id);
+    service_registries_[participant_id] = std::make_shared<ServiceRegistry>(
+        rpc_topic_, participant_id, ServiceRegistry::DEFAULT_CAPACITY, request_expiry_ms_);
+
+    // Create the queue of requests to forward through this proxy client, with its slot in the thread pool
+    std::unique_ptr<RequestQueue> queue = std::make_unique<RequestQueue>();
+    queue->task_id = utils::new_unique_task_id();
+    thread_pool_->slot(
+        queue->task_id,
+        TaskGuard::guarded_task(
+            task_guard_,
+            [this, participant_id]()
+            {
+                forward_requests_(participant_id);
+            }));
+    request_queues_[participant_id] = std::move(queue);
 }
 
 void RpcBridge::enable() noexcept
@@ -172,6 +203,13 @@ void RpcBridge::disable() noexcept
             std::unique_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
         }
 
+        // Requests not forwarded yet would not be replied to the clients any sooner than new ones, so drop them
+        for (auto& queue_it : request_queues_)
+        {
+            std::lock_guard<std::mutex> queue_lock(queue_it.second->mutex);
+            queue_it.second->requests.clear();
+        }
+
         for (auto& reader_it : request_readers_)
         {
             reader_it.second->disable();
@@ -268,6 +306,10 @@ void RpcBridge::transmit_(
     logDebug(DDSPIPE_RPCBRIDGE, "RpcBridge " << *this <<
             " transmitting for reader " << reader->guid() << " .");
 
+    // Samples taken in this turn, to yield the thread after the budget of the thread pool (if any)
+    const unsigned int messages_per_turn = thread_pool_->messages_per_turn();
+    unsigned int messages_taken = 0;
+
     while (true)
     {
         {
@@ -291,11 +333,23 @@ void RpcBridge::transmit_(
 
                 return;
             }
+
+            if (messages_per_turn > 0 && messages_taken >= messages_per_turn)
+            {
+                logDebug(DDSPIPE_RPCBRIDGE,
+                        "RpcBridge service " << *this << " yields its thread after " << messages_taken << " messages.");
+
+                // Task is kept as queued, so the task emitted here is the only one that continues the transmission
+                thread_pool_->emit(tasks_map_[reader->guid()].second);
+
+                return;
+            }
         }
 
         // Get data received
         std::unique_ptr<IRoutingData> data;
         utils::ReturnCode ret = reader->take(data);
+        messages_taken++;
 
         RpcPayloadData& rpc_data = dynamic_cast<RpcPayloadData&>(*data);
 
@@ -340,32 +394,8 @@ void RpcBridge::transmit_(
                         continue;
                     }
 
-                    // Perform write + add entry to registry atomically -> avoid reply processed before entry added to registry
-                    std::lock_guard<std::recursive_mutex> lock(service_registry.second->get_mutex());
-
-                    // Attach the information the server needs in order to reply to the appropiate proxy client.
-                    rpc_data.write_params.set_level();
-                    rpc_data.write_params.get_reference().related_sample_identity().writer_guid(
-                        reply_readers_[service_registry.first]->guid());
-
-
-                    ret = request_writers_[service_registry.first]->write(*data);
-
-                    if (!ret)
-                    {
-                        logWarning(DDSPIPE_RPCBRIDGE, "Error writting request in RpcBridge for service "
-                                << rpc_topic_ << ". Error code " << ret <<
-                                ". Skipping data for this writer and continue.");
-                        continue;
-                    }
-
-                    eprosima::fastrtps::rtps::SequenceNumber_t sequence_number =
-                            rpc_data.sent_sequence_number;
-                    // Add entry to registry associated to the transmission of this request through this proxy client.
-                    service_registry.second->add(
-                        sequence_number,
-                        {rpc_data.participant_receiver, reply_related_sample_identity});
-
+                    // Forwarded from the queue of this proxy client, so slow servers do not delay the rest
+                    enqueue_request_(service_registry.first, rpc_data, reply_related_sample_identity);
                 }
             }
         }
@@ -386,22 +416,31 @@ void RpcBridge::transmit_(
             }
             else
             {
-                std::pair<ParticipantId, SampleIdentity> registry_entry;
-                {
-                    // Wait for request transmission to be finished (entry added to registry)
-                    std::lock_guard<std::recursive_mutex> lock(
-                        service_registries_[reader->participant_id()]->get_mutex());
+                auto& service_registry = service_registries_[reader->participant_id()];
+                SequenceNumber sequence_number =
+                        rpc_data.write_params.get_reference().sample_identity().sequence_number();
+
+                // Fetch information required for transmission; which proxy server should send it and with what parameters
+                RpcRequestTimestamps request_timestamps;
+                std::pair<ParticipantId, SampleIdentity> registry_entry =
+                        service_registry->get(sequence_number, request_timestamps);
 
-                    // Fetch information required for transmission; which proxy server should send it and with what parameters
-                    registry_entry = service_registries_[reader->participant_id()]->get(
-                        rpc_data.write_params.get_reference().sample_identity().sequence_number());
+                // The reply may arrive before its request has been added to the registry; wait for it if being sent
+                if (registry_entry.first.empty() && service_registry->wait_pending_request(sequence_number))
+                {
+                    registry_entry = service_registry->get(sequence_number, request_timestamps);
                 }
 
                 // Not valid means:
                 //   Case 1: (SimpleParticipant) Request already replied by another server connected to the same participant as this one.
                 //   Case 2: (WAN Participant repeater) Request already replied by another PROXY server connected to the same participant as this one.
+                //   Case 3: Request expired or overwritten in the registry before being replied.
                 // TODO: recheck ParticipantId non valid
-                if (!registry_entry.first.empty())
+                if (registry_entry.first.empty())
+                {
+                    service_registry->uncorrelated_reply();
+                }
+                else
                 {
                     rpc_data.write_params.set_level();
                     rpc_data.write_params.get_reference().related_sample_identity(registry_entry.second);
@@ -415,8 +454,12 @@ void RpcBridge::transmit_(
                     }
                     else
                     {
-                        service_registries_[reader->participant_id()]->erase(
-                            rpc_data.write_params.get_reference().sample_identity().sequence_number());
+                        metrics_.record_reply(
+                            request_timestamps,
+                            rpc_data.reception_timestamp.to_ns(),
+                            TrackMetrics::now_ns());
+
+                        service_registry->erase(sequence_number);
                     }
                 }
             }
@@ -431,6 +474,162 @@ void RpcBridge::transmit_(
     }/*  */
 }
 
+void RpcBridge::enqueue_request_(
+        const ParticipantId& participant_id,
+        const RpcPayloadData& rpc_data,
+        const SampleIdentity& reply_related_sample_identity) noexcept
+{
+    // Copy of the request for this proxy client, referencing the payload instead of copying it
+    std::unique_ptr<RpcPayloadData> request = std::make_unique<RpcPayloadData>();
+
+    eprosima::fastrtps::rtps::IPayloadPool* payload_owner = payload_pool_.get();
+    if (!payload_pool_->get_payload(rpc_data.payload, payload_owner, request->payload))
+    {
+        logWarning(DDSPIPE_RPCBRIDGE, "Error referencing request payload in RpcBridge for service "
+                << rpc_topic_ << ". Skipping data for participant " << participant_id << ".");
+        return;
+    }
+    request->payload_owner = payload_pool_.get();
+
+    request->writer_qos = rpc_data.writer_qos;
+    request->writer_qos_hash = rpc_data.writer_qos_hash;
+    request->instanceHandle = rpc_data.instanceHandle;
+    request->kind = rpc_data.kind;
+    request->source_timestamp = rpc_data.source_timestamp;
+    request->reception_timestamp = rpc_data.reception_timestamp;
+    request->source_guid = rpc_data.source_guid;
+    request->participant_receiver = rpc_data.participant_receiver;
+    request->origin_sequence_number = rpc_data.origin_sequence_number;
+    request->write_params = rpc_data.write_params;
+
+    // Attach the information the server needs in order to reply to the appropiate proxy client.
+    request->write_params.set_level();
+    request->write_params.get_reference().related_sample_identity().writer_guid(
+        reply_readers_.at(participant_id)->guid());
+
+    RequestQueue& queue = *request_queues_.at(participant_id);
+    bool emit = false;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.requests.emplace_back(std::move(request), reply_related_sample_identity);
+
+        if (!queue.emitted)
+        {
+            queue.emitted = true;
+            emit = true;
+        }
+    }
+
+    if (emit)
+    {
+        thread_pool_->emit(queue.task_id);
+    }
+}
+
+void RpcBridge::forward_requests_(
+        const ParticipantId& participant_id) noexcept
+{
+    // Avoid being disabled while transmitting
+    std::shared_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
+
+    // Maps only modified in init, before any task is emitted
+    RequestQueue& queue = *request_queues_.at(participant_id);
+    const std::shared_ptr<ServiceRegistry>& service_registry = service_registries_.at(participant_id);
+    const std::shared_ptr<IWriter>& request_writer = request_writers_.at(participant_id);
+
+    // Requests forwarded in this turn, to yield the thread after the budget of the thread pool (if any)
+    const unsigned int messages_per_turn = thread_pool_->messages_per_turn();
+    unsigned int messages_forwarded = 0;
+
+    while (true)
+    {
+        std::unique_ptr<RpcPayloadData> request;
+        SampleIdentity reply_related_sample_identity;
+
+        {
+            std::lock_guard<std::mutex> queue_lock(queue.mutex);
+
+            if (!enabled_ || queue.requests.empty())
+            {
+                logDebug(DDSPIPE_RPCBRIDGE,
+                        "RpcBridge service " << *this << " finishing forwarding requests to participant " <<
+                        participant_id << ".");
+
+                queue.requests.clear();
+                queue.emitted = false;
+                return;
+            }
+
+            if (messages_per_turn > 0 && messages_forwarded >= messages_per_turn)
+            {
+                // Task is kept as emitted, so the task emitted here is the only one that continues forwarding
+                thread_pool_->emit(queue.task_id);
+                return;
+            }
+
+            request = std::move(queue.requests.front().first);
+            reply_related_sample_identity = queue.requests.front().second;
+            queue.requests.pop_front();
+        }
+
+        messages_forwarded++;
+
+        // Replies processed while the request is being sent wait for its entry to be added to the registry
+        service_registry->request_sending();
+
+        utils::ReturnCode ret = request_writer->write(*request);
+
+        if (!ret)
+        {
+            logWarning(DDSPIPE_RPCBRIDGE, "Error writting request in RpcBridge for service "
+                    << rpc_topic_ << ". Error code " << ret <<
+                    ". Skipping data for this writer and continue.");
+        }
+        else
+        {
+            // Times of the request, so the latency of the call is recorded when its reply is forwarded
+            RpcRequestTimestamps timestamps;
+            timestamps.received_ns = request->reception_timestamp.to_ns();
+            timestamps.sent_ns = TrackMetrics::now_ns();
+
+            // Add entry to registry associated to the transmission of this request through this proxy client.
+            service_registry->add(
+                request->sent_sequence_number,
+                {request->participant_receiver, reply_related_sample_identity},
+                timestamps);
+        }
+
+        service_registry->request_added();
+    }
+}
+
+std::map<ParticipantId, ServiceRegistryMetricsSnapshot> RpcBridge::registry_metrics() const noexcept
+{
+    // Registries are only created in init, guarded by mutex_
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::map<ParticipantId, ServiceRegistryMetricsSnapshot> result;
+    for (const auto& service_registry : service_registries_)
+    {
+        result[service_registry.first] = service_registry.second->metrics();
+    }
+    return result;
+}
+
+RpcMetricsSnapshot RpcBridge::metrics() const noexcept
+{
+    RpcMetricsSnapshot result = metrics_.snapshot();
+    result.service = rpc_topic_.service_name();
+    result.registries = registry_metrics();
+
+    for (const auto& registry_it : result.registries)
+    {
+        result.timeouts += registry_it.second.expired;
+    }
+
+    return result;
+}
+
 void RpcBridge::create_slot_(
         std::shared_ptr<IReader> reader) noexcept
 {
@@ -446,10 +645,12 @@ void RpcBridge::create_slot_(
     utils::TaskId task_id = utils::new_unique_task_id();
     thread_pool_->slot(
         task_id,
-        [=]()
-        {
-            transmit_(reader);
-        });
+        TaskGuard::guarded_task(
+            task_guard_,
+            [this, reader]()
+            {
+                transmit_(reader);
+            }));
     tasks_map_[reader_guid] = {false, task_id};
 }
 
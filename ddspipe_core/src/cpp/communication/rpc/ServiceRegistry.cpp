@@ -17,8 +17,7 @@
  *
  */
 
-#include <regex>
-#include <string>
+#include <thread>
 
 #include <cpp_utils/Log.hpp>
 
@@ -30,18 +29,60 @@ namespace core {
 
 using namespace eprosima::ddspipe::core::types;
 
-const unsigned int ServiceRegistry::DEFAULT_MAX_ENTRIES_ = 5000;
+constexpr unsigned int ServiceRegistry::DEFAULT_CAPACITY;
+constexpr unsigned int ServiceRegistry::DEFAULT_EXPIRY_MS;
+
+namespace {
+
+//! Smallest power of 2 not lower than \c value
+unsigned int next_power_of_two(
+        unsigned int value) noexcept
+{
+    unsigned int result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+} /* namespace */
+
+ServiceRegistry::EntryGuard::EntryGuard(
+        Entry& entry) noexcept
+    : entry_(entry)
+{
+    // Only requests whose sequence numbers differ in a multiple of the capacity share an entry, so it is
+    // almost never contended
+    while (entry_.busy.test_and_set(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+ServiceRegistry::EntryGuard::~EntryGuard()
+{
+    entry_.busy.clear(std::memory_order_release);
+}
 
 ServiceRegistry::ServiceRegistry(
         const RpcTopic& topic,
-        const ParticipantId& participant_id)
+        const ParticipantId& participant_id,
+        unsigned int capacity /* = DEFAULT_CAPACITY */,
+        unsigned int expiry_ms /* = DEFAULT_EXPIRY_MS */)
     : topic_(topic)
     , participant_id_(participant_id)
     , enabled_(false)
+    , capacity_(next_power_of_two(capacity > 0 ? capacity : 1))
+    , expiry_(expiry_ms)
+    , registry_(new Entry[capacity_])
+    , sending_requests_(0)
+    , last_added_(0)
+    , waiting_replies_(0)
 {
     logDebug(DDSPIPE_SERVICEREGISTRY,
             "ServiceRegistry created for service " << topic <<
-            " in participant " << participant_id << ".");
+            " in participant " << participant_id << " with " << capacity_ << " entries.");
 }
 
 void ServiceRegistry::enable() noexcept
@@ -61,66 +102,180 @@ bool ServiceRegistry::enabled() const noexcept
 
 void ServiceRegistry::add(
         SequenceNumber idx,
-        std::pair<ParticipantId, SampleIdentity> new_entry) noexcept
+        std::pair<ParticipantId, SampleIdentity> new_entry,
+        const RpcRequestTimestamps& timestamps /* = {} */) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    auto now = std::chrono::steady_clock::now();
+    Entry& entry = entry_(idx);
+    EntryGuard guard(entry);
 
-    if (registry_.count(idx))
+    if (entry.used)
     {
-        // Should never occur as each sequence number associated to a write operation is unique
-        logWarning(DDSPIPE_SERVICEREGISTRY,
-                "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
-                " attempting to add entry with already present SequenceNumber.");
-        return;
+        if (entry.sequence_number == idx)
+        {
+            // Should never occur as each sequence number associated to a write operation is unique
+            logWarning(DDSPIPE_SERVICEREGISTRY,
+                    "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                    " attempting to add entry with already present SequenceNumber.");
+            return;
+        }
+
+        if (expired_(entry.added_time, now))
+        {
+            expired_requests_.increment();
+        }
+        else
+        {
+            overwritten_requests_.increment();
+            logWarning(DDSPIPE_SERVICEREGISTRY,
+                    "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                    " full: request " << entry.sequence_number << " overwritten without reply.");
+        }
     }
 
-    registry_[idx] = new_entry;
+    entry.used = true;
+    entry.sequence_number = idx;
+    entry.added_time = now;
+    entry.value = std::move(new_entry);
+    entry.timestamps = timestamps;
+
+    requests_.increment();
 
-    // Remove oldest entry if registry full
-    // TMP: Use configuration specs value when available
-    if (registry_.size() == DEFAULT_MAX_ENTRIES_)
+    uint64_t sequence_number = to_uint64_(idx);
+    uint64_t last_added = last_added_.load();
+    while (last_added < sequence_number && !last_added_.compare_exchange_weak(last_added, sequence_number))
     {
-        registry_.erase(registry_.begin());
     }
 }
 
 std::pair<ParticipantId, SampleIdentity> ServiceRegistry::get(
-        SequenceNumber idx) const noexcept
+        SequenceNumber idx) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    RpcRequestTimestamps timestamps;
+    return get(idx, timestamps);
+}
 
-    std::pair<ParticipantId, SampleIdentity> ret;
-    if (registry_.count(idx))
-    {
-        ret = registry_.at(idx);
-    }
-    else
+std::pair<ParticipantId, SampleIdentity> ServiceRegistry::get(
+        SequenceNumber idx,
+        RpcRequestTimestamps& timestamps) noexcept
+{
+    Entry& entry = entry_(idx);
+    EntryGuard guard(entry);
+
+    if (entry.used && entry.sequence_number == idx)
     {
-        ret = {ParticipantId(), SampleIdentity()};
+        if (!expired_(entry.added_time, std::chrono::steady_clock::now()))
+        {
+            timestamps = entry.timestamps;
+            return entry.value;
+        }
+
+        // Remove it, so a late reply is not forwarded
+        entry.used = false;
+        expired_requests_.increment();
     }
 
-    return ret;
+    return {ParticipantId(), SampleIdentity()};
 }
 
 void ServiceRegistry::erase(
         SequenceNumber idx) noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    Entry& entry = entry_(idx);
+    EntryGuard guard(entry);
 
-    if (registry_.count(idx))
+    if (entry.used && entry.sequence_number == idx)
     {
-        registry_.erase(idx);
+        entry.used = false;
+        correlated_replies_.increment();
     }
 }
 
+void ServiceRegistry::uncorrelated_reply() noexcept
+{
+    uncorrelated_replies_.increment();
+}
+
+void ServiceRegistry::request_sending() noexcept
+{
+    sending_requests_++;
+}
+
+void ServiceRegistry::request_added() noexcept
+{
+    sending_requests_--;
+
+    // A reply that starts waiting after this check sees the request already added
+    if (waiting_replies_ > 0)
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_cv_.notify_all();
+    }
+}
+
+bool ServiceRegistry::wait_pending_request(
+        const SequenceNumber& idx) const noexcept
+{
+    uint64_t sequence_number = to_uint64_(idx);
+
+    // Requests are added in order, so an older one is already in the registry or will never be
+    if (sending_requests_ == 0 || sequence_number <= last_added_)
+    {
+        return false;
+    }
+
+    waiting_replies_++;
+    {
+        std::unique_lock<std::mutex> lock(pending_mutex_);
+        pending_cv_.wait(lock, [this, sequence_number]()
+                {
+                    return sending_requests_ == 0 || sequence_number <= last_added_;
+                });
+    }
+    waiting_replies_--;
+
+    return true;
+}
+
 RpcTopic ServiceRegistry::topic() const noexcept
 {
     return topic_;
 }
 
-std::recursive_mutex& ServiceRegistry::get_mutex() noexcept
+ServiceRegistryMetricsSnapshot ServiceRegistry::metrics() const noexcept
+{
+    ServiceRegistryMetricsSnapshot result;
+    result.requests = requests_.load();
+    result.correlated_replies = correlated_replies_.load();
+    result.uncorrelated_replies = uncorrelated_replies_.load();
+    result.expired = expired_requests_.load();
+    result.overwritten = overwritten_requests_.load();
+
+    // Expired requests are only noticed when their entry is looked up or reused
+    uint64_t finished = result.correlated_replies + result.expired + result.overwritten;
+    result.pending = result.requests > finished ? result.requests - finished : 0;
+
+    return result;
+}
+
+ServiceRegistry::Entry& ServiceRegistry::entry_(
+        const SequenceNumber& idx) noexcept
+{
+    // Sequence numbers of a writer are consecutive, so consecutive requests land in consecutive entries
+    return registry_[idx.low & (capacity_ - 1)];
+}
+
+uint64_t ServiceRegistry::to_uint64_(
+        const SequenceNumber& idx) noexcept
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(idx.high)) << 32) | idx.low;
+}
+
+bool ServiceRegistry::expired_(
+        const std::chrono::steady_clock::time_point& added_time,
+        const std::chrono::steady_clock::time_point& now) const noexcept
 {
-    return mutex_;
+    return expiry_.count() > 0 && now - added_time > expiry_;
 }
 
 } /* namespace core */
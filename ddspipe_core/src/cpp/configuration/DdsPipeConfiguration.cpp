@@ -29,7 +29,13 @@ namespace core {
 bool DdsPipeConfiguration::is_valid(
         utils::Formatter& error_msg) const noexcept
 {
-    return routes.is_valid(error_msg) && topic_routes.is_valid(error_msg);
+    if (bridge_creation_threads == 0)
+    {
+        error_msg << "The number of threads to create Bridges must be greater than 0. ";
+        return false;
+    }
+
+    return routes.is_valid(error_msg) && topic_routes.is_valid(error_msg) && memory_budget.is_valid(error_msg);
 }
 
 bool DdsPipeConfiguration::is_valid(
@@ -0,0 +1,54 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadPoolConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/ThreadPoolConfiguration.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+bool ThreadPoolConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (n_threads == 0)
+    {
+        error_msg << "Thread pool requires at least one thread. ";
+        return false;
+    }
+
+    if (priority_classes == 0)
+    {
+        error_msg << "Thread pool requires at least one priority class. ";
+        return false;
+    }
+
+    if (cpu_pinning && kind != ThreadPoolKind::work_stealing)
+    {
+        error_msg << "CPU pinning is only available with the work stealing scheduler. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
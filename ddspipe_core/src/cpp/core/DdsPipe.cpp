@@ -12,15 +12,22 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
 #include <set>
+#include <thread>
 
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/exception/InconsistencyException.hpp>
 #include <cpp_utils/Log.hpp>
+#include <cpp_utils/types/cast.hpp>
 
 #include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
 
 namespace eprosima {
 namespace ddspipe {
@@ -33,7 +40,7 @@ DdsPipe::DdsPipe(
         const std::shared_ptr<DiscoveryDatabase>& discovery_database,
         const std::shared_ptr<PayloadPool>& payload_pool,
         const std::shared_ptr<ParticipantsDatabase>& participants_database,
-        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const std::shared_ptr<IThreadPool>& thread_pool,
         const std::set<utils::Heritable<DistributedTopic>>& builtin_topics, /* = {} */
         bool start_enable, /* = false */
         const DdsPipeConfiguration& configuration /* = {} */)
@@ -56,16 +63,16 @@ DdsPipe::DdsPipe(
                       "Configuration for DDS Pipe is invalid: " << error_msg);
     }
 
-    // Add callback to be called by the discovery database when an Endpoint is discovered
-    discovery_database_->add_endpoint_discovered_callback(std::bind(&DdsPipe::discovered_endpoint_, this,
-            std::placeholders::_1));
-
-    // Add callback to be called by the discovery database when an Endpoint is updated
-    discovery_database_->add_endpoint_updated_callback(std::bind(&DdsPipe::updated_endpoint_, this,
-            std::placeholders::_1));
+    // Account the memory of the payloads before any Track takes them
+    memory_accountant_ = std::make_shared<MemoryAccountant>(configuration_.memory_budget);
+    if (!payload_pool_->set_memory_accountant(memory_accountant_))
+    {
+        logWarning(DDSPIPE, "Payload pool already accounted by another DDS Pipe. Sharing its memory budget.");
+        memory_accountant_ = payload_pool_->memory_accountant();
+    }
 
-    // Add callback to be called by the discovery database when an Endpoint is removed/dropped
-    discovery_database_->add_endpoint_erased_callback(std::bind(&DdsPipe::removed_endpoint_, this,
+    // Add callback to be called by the discovery database once per batch of Endpoints discovered, updated or removed
+    discovery_database_->add_endpoints_changed_callback(std::bind(&DdsPipe::endpoints_changed_, this,
             std::placeholders::_1));
 
     // Create Bridges for builtin topics
@@ -74,6 +81,12 @@ DdsPipe::DdsPipe(
     // Enable thread pool
     thread_pool_->enable();
 
+    // Destroy idle lazy Readers periodically
+    if (configuration_.lazy_readers && configuration_.lazy_readers_idle_timeout > 0)
+    {
+        idle_readers_thread_ = std::thread(&DdsPipe::remove_idle_readers_routine_, this);
+    }
+
     // Enable if set
     if (start_enable)
     {
@@ -89,10 +102,42 @@ DdsPipe::DdsPipe(
     logDebug(DDSPIPE, "DDS Pipe created.");
 }
 
+DdsPipe::DdsPipe(
+        const std::shared_ptr<AllowedTopicList>& allowed_topics,
+        const std::shared_ptr<DiscoveryDatabase>& discovery_database,
+        const std::shared_ptr<PayloadPool>& payload_pool,
+        const std::shared_ptr<ParticipantsDatabase>& participants_database,
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        const std::set<utils::Heritable<DistributedTopic>>& builtin_topics, /* = {} */
+        bool start_enable, /* = false */
+        const DdsPipeConfiguration& configuration /* = {} */)
+    : DdsPipe(
+        allowed_topics,
+        discovery_database,
+        payload_pool,
+        participants_database,
+        std::make_shared<FifoThreadPool>(thread_pool),
+        builtin_topics,
+        start_enable,
+        configuration)
+{
+}
+
 DdsPipe::~DdsPipe()
 {
     logDebug(DDSPIPE, "Destroying DDS Pipe.");
 
+    // Stop destroying idle Readers
+    if (idle_readers_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_idle_readers_ = true;
+        }
+        idle_readers_cv_.notify_all();
+        idle_readers_thread_.join();
+    }
+
     // Stop Discovery Database
     discovery_database_->stop();
 
@@ -116,66 +161,227 @@ DdsPipe::~DdsPipe()
 utils::ReturnCode DdsPipe::reload_allowed_topics(
         const std::shared_ptr<AllowedTopicList>& allowed_topics)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> reload_lock(reload_mutex_);
 
-    logDebug(DDSPIPE, "Reloading DDS Pipe configuration...");
+    // Topics activated whose Bridge must be created
+    std::vector<utils::Heritable<DistributedTopic>> topics_to_create;
 
-    // Check if it should change or is the same configuration
-    if (*allowed_topics == *allowed_topics_)
     {
-        logDebug(DDSPIPE, "Same configuration, do nothing in reload.");
-        return utils::ReturnCode::RETCODE_NO_DATA;
-    }
+        std::lock_guard<std::mutex> lock(mutex_);
 
-    // Set new Allowed list
-    allowed_topics_ = allowed_topics;
+        logDebug(DDSPIPE, "Reloading DDS Pipe configuration...");
 
-    logDebug(DDSPIPE, "New DDS Pipe allowed topics configuration: " << allowed_topics_);
+        // Check if it should change or is the same configuration
+        if (*allowed_topics == *allowed_topics_)
+        {
+            logDebug(DDSPIPE, "Same configuration, do nothing in reload.");
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
 
-    if (!enabled_)
-    {
-        return utils::ReturnCode::RETCODE_OK;
-    }
+        // Only the topics that match a filter added or removed may change
+        TopicFilterMatcher changed_filters;
+        bool incremental = allowed_topics_->changed_filters(*allowed_topics, changed_filters);
 
-    // It must change the configuration. Check every topic discovered and activate/deactivate it if needed.
-    for (auto& topic_it : current_topics_)
-    {
-        // If topic is active and it is blocked, deactivate it
-        if (topic_it.second)
+        // Set new Allowed list
+        allowed_topics_ = allowed_topics;
+
+        logDebug(DDSPIPE, "New DDS Pipe allowed topics configuration: " << allowed_topics_);
+
+        if (!enabled_)
         {
-            if (!allowed_topics_->is_topic_allowed(*topic_it.first))
+            return utils::ReturnCode::RETCODE_OK;
+        }
+
+        std::vector<utils::Heritable<DistributedTopic>> topics;
+
+        if (incremental)
+        {
+            topics = topics_matching_nts_(changed_filters);
+        }
+        else
+        {
+            for (const auto& topic_it : current_topics_)
             {
-                deactivate_topic_nts_(topic_it.first);
+                topics.push_back(topic_it.first);
             }
         }
-        else
+
+        logDebug(DDSPIPE, "Checking " << topics.size() << " of " << current_topics_.size() << " topics in reload.");
+
+        // It must change the configuration. Check every topic affected and activate/deactivate it if needed.
+        for (const auto& topic : topics)
         {
-            // If topic is not active and it is allowed, activate it
-            if (allowed_topics_->is_topic_allowed(*topic_it.first))
+            bool active = current_topics_[topic];
+            bool allowed = allowed_topics_->is_topic_allowed(*topic);
+
+            if (active && !allowed)
             {
-                activate_topic_nts_(topic_it.first);
+                // If topic is active and it is blocked, deactivate it
+                deactivate_topic_nts_(topic);
+            }
+            else if (!active && allowed)
+            {
+                // If topic is not active and it is allowed, activate it
+                if (bridges_.find(topic) != bridges_.end() ||
+                        bridges_in_creation_.find(topic) != bridges_in_creation_.end())
+                {
+                    // The Bridge exists, or it is being created by another reload
+                    activate_topic_nts_(topic);
+                }
+                else
+                {
+                    // The Bridge is created once the lock is released
+                    logInfo(DDSPIPE, "Activating topic: " << topic << ".");
+                    current_topics_[topic] = true;
+                    topics_to_create.push_back(topic);
+                    bridges_in_creation_[topic];
+                }
             }
         }
-    }
 
-    // Check every service discovered and activate/deactivate it if needed.
-    for (auto& service_it : current_services_)
-    {
-        if (allowed_topics_->is_service_allowed(service_it.first))
+        // Check every service affected and activate/deactivate it if needed.
+        for (auto& service_it : current_services_)
         {
-            service_it.second = true;
-            rpc_bridges_[service_it.first]->enable();
+            if (incremental &&
+                    !changed_filters.matches(service_it.first.request_topic()) &&
+                    !changed_filters.matches(service_it.first.reply_topic()))
+            {
+                continue;
+            }
+
+            if (allowed_topics_->is_service_allowed(service_it.first))
+            {
+                service_it.second = true;
+                rpc_bridges_[service_it.first]->enable();
+            }
+            else
+            {
+                service_it.second = false;
+                rpc_bridges_[service_it.first]->disable();
+            }
         }
-        else
+    }
+
+    if (topics_to_create.empty())
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    // Create the Bridges without blocking the discovery callbacks
+    std::vector<std::unique_ptr<DdsBridge>> new_bridges = create_bridges_(topics_to_create);
+
+    // Bridges not added, destroyed once the lock is released
+    std::vector<std::unique_ptr<DdsBridge>> discarded_bridges;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (std::size_t i = 0; i < topics_to_create.size(); i++)
         {
-            service_it.second = false;
-            rpc_bridges_[service_it.first]->disable();
+            const auto& topic = topics_to_create[i];
+
+            // Participants that discovered the topic while the Bridge was created
+            auto it_creation = bridges_in_creation_.find(topic);
+            std::set<ParticipantId> discoverers = std::move(it_creation->second);
+            bridges_in_creation_.erase(it_creation);
+
+            if (!new_bridges[i])
+            {
+                // It could not be created
+                continue;
+            }
+
+            auto it_bridge = bridges_.find(topic);
+
+            if (it_bridge != bridges_.end())
+            {
+                // It has been created meanwhile. Keep that one, with the writers of the participants that discovered it
+                for (const auto& participant_id : discoverers)
+                {
+                    it_bridge->second->create_writer(participant_id);
+                }
+
+                discarded_bridges.push_back(std::move(new_bridges[i]));
+                continue;
+            }
+
+            // The DdsPipe could have been disabled meanwhile
+            if (enabled_ && current_topics_[topic])
+            {
+                new_bridges[i]->enable();
+            }
+
+            // Writers could have changed while it was created
+            update_remote_writers_nts_(topic, *new_bridges[i]);
+
+            for (const auto& participant_id : discoverers)
+            {
+                new_bridges[i]->create_writer(participant_id);
+            }
+
+            bridges_[topic] = std::move(new_bridges[i]);
         }
     }
 
     return utils::ReturnCode::RETCODE_OK;
 }
 
+std::vector<TrackMetricsSnapshot> DdsPipe::metrics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<TrackMetricsSnapshot> result;
+
+    for (const auto& bridge_it : bridges_)
+    {
+        std::vector<TrackMetricsSnapshot> bridge_metrics = bridge_it.second->metrics();
+        result.insert(
+            result.end(),
+            std::make_move_iterator(bridge_metrics.begin()),
+            std::make_move_iterator(bridge_metrics.end()));
+    }
+
+    return result;
+}
+
+std::map<std::string, HistoryMetricsSnapshot> DdsPipe::history_metrics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::map<std::string, HistoryMetricsSnapshot> result;
+
+    for (const auto& bridge_it : bridges_)
+    {
+        result[bridge_it.first->serialize()] += bridge_it.second->history_metrics();
+    }
+
+    return result;
+}
+
+MemoryUsageSnapshot DdsPipe::memory_usage() const
+{
+    return memory_accountant_->usage();
+}
+
+std::vector<RpcMetricsSnapshot> DdsPipe::rpc_metrics() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<RpcMetricsSnapshot> result;
+
+    for (const auto& bridge_it : rpc_bridges_)
+    {
+        result.push_back(bridge_it.second->metrics());
+    }
+
+    return result;
+}
+
+std::vector<PriorityClassMetricsSnapshot> DdsPipe::thread_pool_metrics() const noexcept
+{
+    return thread_pool_->metrics();
+}
+
 utils::ReturnCode DdsPipe::enable() noexcept
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -228,142 +434,185 @@ utils::ReturnCode DdsPipe::disable() noexcept
     }
 }
 
-void DdsPipe::discovered_endpoint_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::endpoints_changed_(
+        const std::vector<EndpointChange>& changes) noexcept
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    discovered_endpoint_nts_(endpoint);
+    endpoints_changed_nts_(changes);
 }
 
-void DdsPipe::updated_endpoint_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::endpoints_changed_nts_(
+        const std::vector<EndpointChange>& changes) noexcept
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    updated_endpoint_nts_(endpoint);
-}
+    logDebug(DDSPIPE, "Batch of " << changes.size() << " Endpoints changed in DDS Pipe core.");
 
-void DdsPipe::removed_endpoint_(
-        const Endpoint& endpoint) noexcept
-{
-    std::lock_guard<std::mutex> lock(mutex_);
-    removed_endpoint_nts_(endpoint);
+    // Last version of the readers changed for each topic and discoverer participant
+    std::map<ReaderKey, EndpointChange> readers_changed;
+
+    // Last version of the writers changed for each topic and discoverer participant
+    std::map<WriterKey, Endpoint> writers_changed;
+
+    for (const auto& change : changes)
+    {
+        const auto& operation = std::get<0>(change);
+        const auto& endpoint = std::get<1>(change);
+
+        if (RpcTopic::is_service_topic(endpoint.topic))
+        {
+            service_endpoint_changed_nts_(operation, endpoint);
+        }
+        else if (endpoint.is_reader())
+        {
+            readers_changed[ReaderKey(endpoint.topic.topic_unique_name(), endpoint.discoverer_participant_id)] =
+                    change;
+        }
+        else if (configuration_.lazy_readers && endpoint.is_writer())
+        {
+            writers_changed[WriterKey(endpoint.topic.topic_unique_name(), endpoint.discoverer_participant_id)] =
+                    endpoint;
+        }
+    }
+
+    // Relevance is checked once per topic and participant, after the whole batch is in the database
+    for (const auto& reader_changed : readers_changed)
+    {
+        readers_changed_nts_(
+            reader_changed.first,
+            std::get<0>(reader_changed.second),
+            std::get<1>(reader_changed.second));
+    }
+
+    for (const auto& writer_changed : writers_changed)
+    {
+        writers_changed_nts_(writer_changed.second);
+    }
 }
 
-void DdsPipe::discovered_endpoint_nts_(
+void DdsPipe::service_endpoint_changed_nts_(
+        DatabaseOperation operation,
         const Endpoint& endpoint) noexcept
 {
-    logDebug(DDSPIPE, "Endpoint discovered in DDS Pipe core: " << endpoint << ".");
+    if (!endpoint.is_server_endpoint())
+    {
+        return;
+    }
 
-    if (RpcTopic::is_service_topic(endpoint.topic))
+    // Updated information is not sent to service topics
+    if (operation == DatabaseOperation::add && endpoint.is_reader())
     {
-        if (endpoint.is_reader() && endpoint.is_server_endpoint())
-        {
-            // Service server discovered
-            discovered_service_nts_(RpcTopic(
-                        endpoint.topic), endpoint.discoverer_participant_id, endpoint.guid.guid_prefix());
-        }
+        logDebug(DDSPIPE, "Endpoint discovered in DDS Pipe core: " << endpoint << ".");
+
+        // Service server discovered
+        discovered_service_nts_(RpcTopic(
+                    endpoint.topic), endpoint.discoverer_participant_id, endpoint.guid.guid_prefix());
     }
-    else if (is_endpoint_relevant_(endpoint))
+    else if (operation == DatabaseOperation::erase)
     {
-        discovered_topic_nts_(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
+        logDebug(DDSPIPE, "Endpoint removed/dropped: " << endpoint << ".");
+
+        // Service server removed/dropped
+        removed_service_nts_(RpcTopic(endpoint.topic), endpoint.discoverer_participant_id,
+                endpoint.guid.guid_prefix());
     }
 }
 
-void DdsPipe::removed_endpoint_nts_(
+void DdsPipe::readers_changed_nts_(
+        const ReaderKey& key,
+        DatabaseOperation operation,
         const Endpoint& endpoint) noexcept
 {
-    logDebug(DDSPIPE, "Endpoint removed/dropped: " << endpoint << ".");
+    // A reader added while inactive is relevant as well, as long as it is not updated or removed
+    bool has_relevant_readers = discovery_database_->count_active_endpoints(
+        EndpointKind::reader,
+        endpoint.topic,
+        endpoint.discoverer_participant_id) > 0 ||
+            (operation == DatabaseOperation::add && !endpoint.active);
 
-    const auto& topic = utils::Heritable<DdsTopic>::make_heritable(endpoint.topic);
+    bool had_relevant_readers = readers_relevant_.count(key) > 0;
 
-    if (RpcTopic::is_service_topic(endpoint.topic))
+    if (has_relevant_readers && !had_relevant_readers)
     {
-        if (endpoint.is_server_endpoint())
-        {
-            // Service server removed/dropped
-            removed_service_nts_(RpcTopic(endpoint.topic), endpoint.discoverer_participant_id,
-                    endpoint.guid.guid_prefix());
-        }
+        // First relevant reader in the topic with this discoverer participant
+        logDebug(DDSPIPE, "Endpoint discovered in DDS Pipe core: " << endpoint << ".");
 
+        readers_relevant_.insert(key);
+        discovered_topic_nts_(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
     }
-    else if (configuration_.remove_unused_entities && is_endpoint_relevant_(endpoint))
+    else if (!has_relevant_readers && had_relevant_readers)
     {
-        // Remove the subscriber from the topic.
-        auto it_bridge = bridges_.find(topic);
+        // No relevant readers left in the topic with this discoverer participant
+        logDebug(DDSPIPE, "Endpoint removed/dropped: " << endpoint << ".");
+
+        readers_relevant_.erase(key);
 
-        if (it_bridge == bridges_.end())
+        if (!configuration_.remove_unused_entities)
         {
-            // The bridge does not exist. We cannot remove the writer. Exit.
             return;
         }
-        else
+
+        // Remove the subscriber from the topic.
+        auto it_bridge = bridges_.find(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
+
+        if (it_bridge != bridges_.end())
         {
             it_bridge->second->remove_writer(endpoint.discoverer_participant_id);
+            return;
+        }
+
+        // If its Bridge is being created, do not create this writer once it is added
+        auto it_creation = bridges_in_creation_.find(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
+
+        if (it_creation != bridges_in_creation_.end())
+        {
+            it_creation->second.erase(endpoint.discoverer_participant_id);
         }
     }
 }
 
-void DdsPipe::updated_endpoint_nts_(
+void DdsPipe::writers_changed_nts_(
         const Endpoint& endpoint) noexcept
 {
-    logDebug(DDSPIPE, "Endpoint updated in DDS Pipe core: " << endpoint << ".");
+    // A Bridge created afterwards takes the writers from the discovery database
+    auto it_bridge = bridges_.find(utils::Heritable<DdsTopic>::make_heritable(endpoint.topic));
 
-    // Don't send updated information to service topics.
-    if (RpcTopic::is_service_topic(endpoint.topic))
+    if (it_bridge == bridges_.end())
     {
         return;
     }
 
-    if (endpoint.active)
-    {
-        discovered_endpoint_nts_(endpoint);
-    }
-    else
-    {
-        removed_endpoint_nts_(endpoint);
-    }
+    bool has_active_writers = discovery_database_->count_active_endpoints(
+        EndpointKind::writer,
+        endpoint.topic,
+        endpoint.discoverer_participant_id) > 0;
+
+    it_bridge->second->set_remote_writers(endpoint.discoverer_participant_id, has_active_writers);
 }
 
-bool DdsPipe::is_endpoint_relevant_(
-        const Endpoint& endpoint) noexcept
+void DdsPipe::init_bridges_nts_(
+        const std::set<utils::Heritable<DistributedTopic>>& builtin_topics)
 {
-    if (!endpoint.is_reader())
+    for (const auto& topic : builtin_topics)
     {
-        return false;
+        discovered_topic_nts_(topic);
     }
 
-    auto is_endpoint_relevant = [endpoint](const Endpoint& entity)
-            {
-                return entity.active &&
-                       entity.is_reader() &&
-                       entity.topic == endpoint.topic &&
-                       entity.discoverer_participant_id == endpoint.discoverer_participant_id;
-            };
+    std::vector<utils::Heritable<DistributedTopic>> topics(builtin_topics.begin(), builtin_topics.end());
 
-    const auto& relevant_endpoints = discovery_database_->get_endpoints(is_endpoint_relevant);
+    auto start = std::chrono::steady_clock::now();
 
-    if (endpoint.active)
-    {
-        // An active reader is relevant when it is the only active reader in a topic
-        // with a discoverer participant id.
-        return relevant_endpoints.size() == 1 && relevant_endpoints.count(endpoint.guid);
-    }
-    else
-    {
-        // An inactive reader is relevant when there aren't any active readers in a topic
-        // with a discoverer participant id.
-        return relevant_endpoints.size() == 0;
-    }
-}
+    std::vector<std::unique_ptr<DdsBridge>> new_bridges = create_bridges_(topics);
 
-void DdsPipe::init_bridges_nts_(
-        const std::set<utils::Heritable<DistributedTopic>>& builtin_topics)
-{
-    for (const auto& topic : builtin_topics)
+    for (std::size_t i = 0; i < topics.size(); i++)
     {
-        discovered_topic_nts_(topic);
-        create_new_bridge_nts_(topic, false);
+        if (new_bridges[i])
+        {
+            bridges_[topics[i]] = std::move(new_bridges[i]);
+        }
     }
+
+    logInfo(DDSPIPE, "Created " << bridges_.size() << " Bridges for builtin topics in " <<
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() <<
+            " ms.");
 }
 
 void DdsPipe::discovered_topic_nts_(
@@ -381,8 +630,20 @@ void DdsPipe::discovered_topic_nts_(
         return;
     }
 
+    auto it_creation = bridges_in_creation_.find(topic);
+
+    if (it_creation != bridges_in_creation_.end())
+    {
+        // The bridge is being created. The writer is created in it once it is added.
+        it_creation->second.insert(topic->topic_discoverer());
+        return;
+    }
+
     // Add topic to current_topics as non activated
-    current_topics_.emplace(topic, false);
+    if (current_topics_.emplace(topic, false).second)
+    {
+        current_topics_by_name_.emplace(topic->topic_name(), topic);
+    }
 
     // If Pipe is enabled and topic allowed, activate it
     if (enabled_ && allowed_topics_->is_topic_allowed(*topic))
@@ -440,6 +701,24 @@ void DdsPipe::removed_service_nts_(
 void DdsPipe::create_new_bridge_nts_(
         const utils::Heritable<DistributedTopic>& topic,
         bool enabled /*= false*/) noexcept
+{
+    auto new_bridge = create_bridge_(topic);
+
+    if (!new_bridge)
+    {
+        return;
+    }
+
+    if (enabled)
+    {
+        new_bridge->enable();
+    }
+
+    bridges_[topic] = std::move(new_bridge);
+}
+
+std::unique_ptr<DdsBridge> DdsPipe::create_bridge_(
+        const utils::Heritable<DistributedTopic>& topic) noexcept
 {
     logInfo(DDSPIPE, "Creating Bridge for topic: " << topic << ".");
 
@@ -449,19 +728,14 @@ void DdsPipe::create_new_bridge_nts_(
         auto routes_config = configuration_.get_routes_config(topic);
 
         // Create bridge instance
-        auto new_bridge = std::make_unique<DdsBridge>(topic,
-                        participants_database_,
-                        payload_pool_,
-                        thread_pool_,
-                        routes_config,
-                        configuration_.remove_unused_entities);
-
-        if (enabled)
-        {
-            new_bridge->enable();
-        }
-
-        bridges_[topic] = std::move(new_bridge);
+        return std::make_unique<DdsBridge>(topic,
+                       participants_database_,
+                       payload_pool_,
+                       thread_pool_,
+                       routes_config,
+                       configuration_.remove_unused_entities,
+                       configuration_.lazy_readers,
+                       participants_with_writers_(topic));
     }
     catch (const utils::InitializationException& e)
     {
@@ -469,6 +743,147 @@ void DdsPipe::create_new_bridge_nts_(
                 "Error creating Bridge for topic " << topic <<
                 ". Error code:" << e.what() << ".");
     }
+
+    return nullptr;
+}
+
+std::vector<std::unique_ptr<DdsBridge>> DdsPipe::create_bridges_(
+        const std::vector<utils::Heritable<DistributedTopic>>& topics) noexcept
+{
+    std::vector<std::unique_ptr<DdsBridge>> new_bridges(topics.size());
+
+    std::size_t n_threads = std::min<std::size_t>(configuration_.bridge_creation_threads, topics.size());
+
+    // Each thread creates the next Bridge not taken yet, so slow Bridges do not leave other threads idle
+    std::atomic<std::size_t> next_topic(0);
+
+    auto create_bridges_routine = [this, &topics, &new_bridges, &next_topic]()
+            {
+                for (std::size_t i = next_topic++; i < topics.size(); i = next_topic++)
+                {
+                    new_bridges[i] = create_bridge_(topics[i]);
+                }
+            };
+
+    // The calling thread is one of the threads creating Bridges
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < n_threads; i++)
+    {
+        threads.emplace_back(create_bridges_routine);
+    }
+
+    create_bridges_routine();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return new_bridges;
+}
+
+std::vector<utils::Heritable<DistributedTopic>> DdsPipe::topics_matching_nts_(
+        const TopicFilterMatcher& filters) const noexcept
+{
+    std::vector<utils::Heritable<DistributedTopic>> topics;
+
+    if (filters.empty())
+    {
+        return topics;
+    }
+
+    std::set<std::string> prefixes;
+
+    if (!filters.topic_name_prefixes(prefixes))
+    {
+        // The filters may match any topic name, so every topic is checked
+        for (const auto& topic_it : current_topics_)
+        {
+            if (filters.matches(*topic_it.first))
+            {
+                topics.push_back(topic_it.first);
+            }
+        }
+
+        return topics;
+    }
+
+    // Only check the topics whose name starts with a prefix of the filters
+    for (const auto& prefix : prefixes)
+    {
+        for (auto it = current_topics_by_name_.lower_bound(prefix);
+                it != current_topics_by_name_.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+                ++it)
+        {
+            if (filters.matches(*it->second))
+            {
+                topics.push_back(it->second);
+            }
+        }
+    }
+
+    return topics;
+}
+
+std::set<ParticipantId> DdsPipe::participants_with_writers_(
+        const utils::Heritable<DistributedTopic>& topic) const noexcept
+{
+    std::set<ParticipantId> participants;
+
+    if (!configuration_.lazy_readers || !utils::can_cast<DdsTopic>(topic.get_reference()))
+    {
+        return participants;
+    }
+
+    const DdsTopic& dds_topic = dynamic_cast<const DdsTopic&>(topic.get_reference());
+
+    for (const auto& id : participants_database_->get_participants_ids())
+    {
+        if (discovery_database_->count_active_endpoints(EndpointKind::writer, dds_topic, id) > 0)
+        {
+            participants.insert(id);
+        }
+    }
+
+    return participants;
+}
+
+void DdsPipe::update_remote_writers_nts_(
+        const utils::Heritable<DistributedTopic>& topic,
+        DdsBridge& bridge) noexcept
+{
+    if (!configuration_.lazy_readers)
+    {
+        return;
+    }
+
+    std::set<ParticipantId> participants = participants_with_writers_(topic);
+
+    for (const auto& id : participants_database_->get_participants_ids())
+    {
+        bridge.set_remote_writers(id, participants.count(id) > 0);
+    }
+}
+
+void DdsPipe::remove_idle_readers_routine_() noexcept
+{
+    std::chrono::milliseconds idle_timeout(configuration_.lazy_readers_idle_timeout);
+
+    // Check twice per timeout, so a Reader is destroyed at most 1.5 timeouts after it became idle
+    std::chrono::milliseconds period = std::max(idle_timeout / 2, std::chrono::milliseconds(1));
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!idle_readers_cv_.wait_for(lock, period, [this]()
+            {
+                return stop_idle_readers_;
+            }))
+    {
+        for (const auto& bridge_it : bridges_)
+        {
+            bridge_it.second->remove_idle_readers(idle_timeout);
+        }
+    }
 }
 
 void DdsPipe::create_new_service_nts_(
@@ -477,7 +892,8 @@ void DdsPipe::create_new_service_nts_(
     logInfo(DDSPIPE, "Creating Service: " << topic << ".");
 
     // Endpoints not created until enabled for the first time, so no exception can be thrown
-    rpc_bridges_[topic] = std::make_unique<RpcBridge>(topic, participants_database_, payload_pool_, thread_pool_);
+    rpc_bridges_[topic] = std::make_unique<RpcBridge>(
+        topic, participants_database_, payload_pool_, thread_pool_, configuration_.rpc_request_expiry);
 }
 
 void DdsPipe::activate_topic_nts_(
@@ -493,8 +909,11 @@ void DdsPipe::activate_topic_nts_(
 
     if (it_bridge == bridges_.end())
     {
-        // The Bridge did not exist
-        create_new_bridge_nts_(topic, true);
+        // The Bridge did not exist. If it is being created, it is enabled once it is added.
+        if (bridges_in_creation_.find(topic) == bridges_in_creation_.end())
+        {
+            create_new_bridge_nts_(topic, true);
+        }
     }
     else
     {
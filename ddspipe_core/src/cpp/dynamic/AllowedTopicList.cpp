@@ -17,10 +17,16 @@
  *
  */
 
+#include <algorithm>
+#include <iterator>
+
 #include <cpp_utils/exception/UnsupportedException.hpp>
 #include <cpp_utils/Log.hpp>
+#include <cpp_utils/types/cast.hpp>
 #include <cpp_utils/utils.hpp>
 
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
 #include <dynamic/AllowedTopicList.hpp>
 
 namespace eprosima {
@@ -29,6 +35,7 @@ namespace core {
 
 AllowedTopicList::AllowedTopicList()
 {
+    compile_lists_();
 }
 
 // TODO: Add logs
@@ -39,6 +46,8 @@ AllowedTopicList::AllowedTopicList(
     allowlist_ = AllowedTopicList::get_topic_list_without_repetition_(allowlist);
     blocklist_ = AllowedTopicList::get_topic_list_without_repetition_(blocklist);
 
+    compile_lists_();
+
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created:");
     logDebug(DDSPIPE_ALLOWEDTOPICLIST, "New Allowed topic list created: " << *this << ".");
 }
@@ -46,9 +55,13 @@ AllowedTopicList::AllowedTopicList(
 AllowedTopicList& AllowedTopicList::operator =(
         const AllowedTopicList& other)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
     this->allowlist_ = other.allowlist_;
     this->blocklist_ = other.blocklist_;
 
+    compile_lists_();
+
     return *this;
 }
 
@@ -64,54 +77,97 @@ void AllowedTopicList::clear() noexcept
 
     blocklist_.clear();
     allowlist_.clear();
+
+    compile_lists_();
 }
 
 bool AllowedTopicList::is_topic_allowed(
         const ITopic& topic) const noexcept
 {
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    // Keep the lists alive while checking, even if they are replaced meanwhile
+    std::shared_ptr<CompiledLists> lists = std::atomic_load(&compiled_lists_);
 
-    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
-    bool accepted = allowlist_.empty();
+    if (!lists->cacheable || !utils::can_cast<types::DdsTopic>(topic))
+    {
+        return lists->is_topic_allowed(topic);
+    }
 
-    // Check if allowlist filter it (this will do anything if empty and accepted will be true)
-    for (const auto& filter : allowlist_)
+    const types::DdsTopic& dds_topic = dynamic_cast<const types::DdsTopic&>(topic);
+    VerdictCache::key_type key(dds_topic.topic_name(), dds_topic.type_name);
+
+    // Lock-free path for the topics already checked
     {
-        if (filter->matches(topic))
+        std::shared_ptr<const VerdictCache> verdicts = std::atomic_load(&lists->verdicts);
+        auto it = verdicts->find(key);
+        if (it != verdicts->end())
         {
-            accepted = true;
-            break;
+            return it->second;
         }
     }
 
-    // Check if it has not passed the allowlist so blocklist is skipped
-    if (!accepted)
+    std::lock_guard<std::mutex> lock(lists->pending_mutex);
+
+    auto it = lists->pending_verdicts.find(key);
+    if (it != lists->pending_verdicts.end())
     {
-        return false;
+        return it->second;
     }
 
-    // Allowlist passed, check blocklist
-    for (const auto& filter : blocklist_)
+    bool allowed = lists->is_topic_allowed(topic);
+    lists->pending_verdicts.emplace(std::move(key), allowed);
+
+    // Publish the pending verdicts once they are a fraction of the ones published, so the cost of copying the
+    // published ones is amortized between the new verdicts
+    std::shared_ptr<const VerdictCache> verdicts = std::atomic_load(&lists->verdicts);
+    if (lists->pending_verdicts.size() * 4 >= verdicts->size())
     {
-        if (filter->matches(topic))
-        {
-            return false;
-        }
+        auto new_verdicts = std::make_shared<VerdictCache>(*verdicts);
+        new_verdicts->insert(lists->pending_verdicts.begin(), lists->pending_verdicts.end());
+        lists->pending_verdicts.clear();
+
+        std::atomic_store(&lists->verdicts, std::shared_ptr<const VerdictCache>(std::move(new_verdicts)));
     }
 
-    // Blocklist passed, the topic is allowed
-    return true;
+    return allowed;
 }
 
 bool AllowedTopicList::is_service_allowed(
         const types::RpcTopic& topic) const noexcept
 {
-    // Lock mutex to perform the verification atomically
-    std::lock_guard<std::recursive_mutex> lock(mutex_);
-
     return is_topic_allowed(topic.request_topic()) && is_topic_allowed(topic.reply_topic());
 }
 
+bool AllowedTopicList::changed_filters(
+        const AllowedTopicList& other,
+        types::TopicFilterMatcher& changed_filters) const noexcept
+{
+    std::unique_lock<std::recursive_mutex> lock(mutex_, std::defer_lock);
+    std::unique_lock<std::recursive_mutex> other_lock(other.mutex_, std::defer_lock);
+    std::lock(lock, other_lock);
+
+    // Every topic not in a non empty allowlist changes its verdict
+    if (allowlist_.empty() != other.allowlist_.empty())
+    {
+        return false;
+    }
+
+    std::set<utils::Heritable<types::IFilterTopic>> filters;
+
+    std::set_symmetric_difference(
+        allowlist_.begin(), allowlist_.end(),
+        other.allowlist_.begin(), other.allowlist_.end(),
+        std::inserter(filters, filters.end()));
+
+    std::set_symmetric_difference(
+        blocklist_.begin(), blocklist_.end(),
+        other.blocklist_.begin(), other.blocklist_.end(),
+        std::inserter(filters, filters.end()));
+
+    changed_filters = types::TopicFilterMatcher(filters);
+
+    return true;
+}
+
 bool AllowedTopicList::operator ==(
         const AllowedTopicList& other) const noexcept
 {
@@ -161,6 +217,41 @@ std::set<utils::Heritable<types::IFilterTopic>> AllowedTopicList::get_topic_list
     return non_repeated_list;
 }
 
+AllowedTopicList::CompiledLists::CompiledLists(
+        const std::set<utils::Heritable<types::IFilterTopic>>& allowlist,
+        const std::set<utils::Heritable<types::IFilterTopic>>& blocklist)
+    : allowed(allowlist)
+    , blocked(blocklist)
+    , cacheable(std::all_of(allowlist.begin(), allowlist.end(), is_wildcard_filter_) &&
+            std::all_of(blocklist.begin(), blocklist.end(), is_wildcard_filter_))
+    , verdicts(std::make_shared<const VerdictCache>())
+{
+}
+
+bool AllowedTopicList::CompiledLists::is_topic_allowed(
+        const ITopic& topic) const noexcept
+{
+    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
+    if (!allowed.empty() && !allowed.matches(topic))
+    {
+        return false;
+    }
+
+    // Allowlist passed, check blocklist
+    return !blocked.matches(topic);
+}
+
+bool AllowedTopicList::CompiledLists::is_wildcard_filter_(
+        const utils::Heritable<types::IFilterTopic>& filter) noexcept
+{
+    return filter.can_cast<types::WildcardDdsFilterTopic>();
+}
+
+void AllowedTopicList::compile_lists_() noexcept
+{
+    std::atomic_store(&compiled_lists_, std::make_shared<CompiledLists>(allowlist_, blocklist_));
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const AllowedTopicList& atl)
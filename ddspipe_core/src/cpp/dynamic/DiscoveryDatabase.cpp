@@ -81,18 +81,7 @@ void DiscoveryDatabase::stop() noexcept
 bool DiscoveryDatabase::topic_exists(
         const DdsTopic& topic) const noexcept
 {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-
-    // Loop over every Endpoint checking if topic matches
-    // It is not required to be reference
-    for (const auto& entity : entities_)
-    {
-        if (entity.second.topic == topic)
-        {
-            return true;
-        }
-    }
-    return false;
+    return count_endpoints(topic) > 0;
 }
 
 bool DiscoveryDatabase::endpoint_exists(
@@ -121,7 +110,9 @@ bool DiscoveryDatabase::add_endpoint_(
             else
             {
                 // If exists but inactive, modify entry
+                unindex_nts_(it->second);
                 it->second = new_endpoint;
+                index_nts_(it->second);
 
                 logInfo(DDSPIPE_DISCOVERY_DATABASE,
                         "Modifying an already discovered (inactive) Endpoint " << new_endpoint << ".");
@@ -135,6 +126,7 @@ bool DiscoveryDatabase::add_endpoint_(
 
             // Add it to the dictionary
             entities_.insert(std::pair<Guid, Endpoint>(new_endpoint.guid, new_endpoint));
+            index_nts_(new_endpoint);
         }
     }
 
@@ -167,7 +159,9 @@ bool DiscoveryDatabase::update_endpoint_(
                     "Modifying an already discovered Endpoint " << endpoint_to_update << ".");
 
             // Modify entry
+            unindex_nts_(it->second);
             it->second = endpoint_to_update;
+            index_nts_(it->second);
             // It is assumed a topic cannot change, otherwise further actions may be taken
         }
     }
@@ -189,15 +183,18 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
 
         logInfo(DDSPIPE_DISCOVERY_DATABASE, "Erasing Endpoint " << endpoint_to_erase << ".");
 
-        auto erased = entities_.erase(endpoint_to_erase.guid);
+        auto it = entities_.find(endpoint_to_erase.guid);
 
-        if (erased == 0)
+        if (it == entities_.end())
         {
             throw utils::InconsistencyException(
                       utils::Formatter() <<
                           "Error erasing Endpoint " << endpoint_to_erase <<
                           " from database. Endpoint entry not found.");
         }
+
+        unindex_nts_(it->second);
+        entities_.erase(it);
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
@@ -265,6 +262,51 @@ std::map<Guid, Endpoint> DiscoveryDatabase::get_endpoints(
     return endpoints;
 }
 
+std::size_t DiscoveryDatabase::count_endpoints(
+        const DdsTopic& topic) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = topic_index_.find(topic.topic_unique_name());
+    return it != topic_index_.end() ? it->second.size() : 0;
+}
+
+std::size_t DiscoveryDatabase::count_endpoints(
+        const ParticipantId& discoverer_participant_id) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = participant_index_.find(discoverer_participant_id);
+    return it != participant_index_.end() ? it->second.size() : 0;
+}
+
+std::size_t DiscoveryDatabase::count_active_endpoints(
+        EndpointKind kind,
+        const DdsTopic& topic,
+        const ParticipantId& discoverer_participant_id) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = active_index_.find(ActiveEndpointsKey(topic.topic_unique_name(), discoverer_participant_id, kind));
+    return it != active_index_.end() ? it->second.size() : 0;
+}
+
+std::vector<Guid> DiscoveryDatabase::get_active_endpoint_guids(
+        EndpointKind kind,
+        const DdsTopic& topic,
+        const ParticipantId& discoverer_participant_id) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = active_index_.find(ActiveEndpointsKey(topic.topic_unique_name(), discoverer_participant_id, kind));
+    if (it == active_index_.end())
+    {
+        return {};
+    }
+
+    return std::vector<Guid>(it->second.begin(), it->second.end());
+}
+
 void DiscoveryDatabase::add_endpoint_discovered_callback(
         std::function<void(Endpoint)> endpoint_discovered_callback) noexcept
 {
@@ -289,6 +331,14 @@ void DiscoveryDatabase::add_endpoint_erased_callback(
     erased_endpoint_callbacks_.push_back(endpoint_erased_callback);
 }
 
+void DiscoveryDatabase::add_endpoints_changed_callback(
+        std::function<void(const std::vector<EndpointChange>&)> endpoints_changed_callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+
+    endpoints_changed_callbacks_.push_back(endpoints_changed_callback);
+}
+
 void DiscoveryDatabase::clear_all_callbacks() noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
@@ -296,6 +346,51 @@ void DiscoveryDatabase::clear_all_callbacks() noexcept
     added_endpoint_callbacks_.clear();
     updated_endpoint_callbacks_.clear();
     erased_endpoint_callbacks_.clear();
+    endpoints_changed_callbacks_.clear();
+}
+
+DiscoveryDatabase::ActiveEndpointsKey DiscoveryDatabase::active_endpoints_key_(
+        const Endpoint& endpoint) noexcept
+{
+    return ActiveEndpointsKey(endpoint.topic.topic_unique_name(), endpoint.discoverer_participant_id, endpoint.kind);
+}
+
+void DiscoveryDatabase::index_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    topic_index_[endpoint.topic.topic_unique_name()].insert(endpoint.guid);
+    participant_index_[endpoint.discoverer_participant_id].insert(endpoint.guid);
+
+    if (endpoint.active)
+    {
+        active_index_[active_endpoints_key_(endpoint)].insert(endpoint.guid);
+    }
+}
+
+void DiscoveryDatabase::unindex_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    // Remove the guid from the entry of the index, and the entry itself when it gets empty
+    auto remove_from_index = [&endpoint](auto& index, const auto& key)
+            {
+                auto it = index.find(key);
+                if (it != index.end())
+                {
+                    it->second.erase(endpoint.guid);
+                    if (it->second.empty())
+                    {
+                        index.erase(it);
+                    }
+                }
+            };
+
+    remove_from_index(topic_index_, endpoint.topic.topic_unique_name());
+    remove_from_index(participant_index_, endpoint.discoverer_participant_id);
+
+    if (endpoint.active)
+    {
+        remove_from_index(active_index_, active_endpoints_key_(endpoint));
+    }
 }
 
 void DiscoveryDatabase::queue_processing_thread_routine_() noexcept
@@ -331,14 +426,98 @@ void DiscoveryDatabase::push_item_to_queue_(
     entities_to_process_cv_.notify_one();
 }
 
+std::vector<EndpointChange> DiscoveryDatabase::coalesce_(
+        const std::vector<EndpointChange>& operations) const noexcept
+{
+    // Last operation and endpoint of each guid, and order of first appearance
+    std::map<Guid, EndpointChange> last_operations;
+    std::vector<Guid> order;
+
+    for (const auto& operation : operations)
+    {
+        const Guid& guid = std::get<1>(operation).guid;
+
+        auto it = last_operations.find(guid);
+        if (it == last_operations.end())
+        {
+            last_operations.emplace(guid, operation);
+            order.push_back(guid);
+        }
+        else
+        {
+            it->second = operation;
+        }
+    }
+
+    std::vector<EndpointChange> coalesced;
+    coalesced.reserve(order.size());
+
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    for (const auto& guid : order)
+    {
+        const auto& last_operation = last_operations[guid];
+        const DatabaseOperation last_kind = std::get<0>(last_operation);
+        const Endpoint& endpoint = std::get<1>(last_operation);
+
+        auto it = entities_.find(guid);
+        bool exists_before = it != entities_.end();
+        bool exists_after = last_kind != DatabaseOperation::erase;
+
+        if (!exists_before && !exists_after)
+        {
+            logDebug(DDSPIPE_DISCOVERY_DATABASE,
+                    "Discarding operations of Endpoint " << endpoint << " as it is added and erased in the same batch.");
+            continue;
+        }
+
+        DatabaseOperation kind;
+        if (!exists_before)
+        {
+            kind = DatabaseOperation::add;
+        }
+        else if (!exists_after)
+        {
+            kind = DatabaseOperation::erase;
+        }
+        else if (last_kind == DatabaseOperation::add && !it->second.active)
+        {
+            kind = DatabaseOperation::add;
+        }
+        else
+        {
+            kind = DatabaseOperation::update;
+        }
+
+        coalesced.emplace_back(kind, endpoint);
+    }
+
+    return coalesced;
+}
+
 void DiscoveryDatabase::process_queue_() noexcept
 {
     entities_to_process_.Swap();
+
+    std::vector<EndpointChange> operations;
     while (!entities_to_process_.Empty())
     {
-        std::tuple<DatabaseOperation, Endpoint> queue_item = entities_to_process_.Front();
-        DatabaseOperation db_operation = std::get<0>(queue_item);
-        Endpoint entity = std::get<1>(queue_item);
+        operations.push_back(entities_to_process_.Front());
+        entities_to_process_.Pop();
+    }
+
+    std::vector<EndpointChange> changes = coalesce_(operations);
+
+    logDebug(DDSPIPE_DISCOVERY_DATABASE,
+            "Processing " << operations.size() << " database operations coalesced into " << changes.size() << ".");
+
+    std::vector<EndpointChange> applied;
+    applied.reserve(changes.size());
+
+    for (const auto& change : changes)
+    {
+        DatabaseOperation db_operation = std::get<0>(change);
+        const Endpoint& entity = std::get<1>(change);
         try
         {
             if (db_operation == DatabaseOperation::add)
@@ -353,13 +532,24 @@ void DiscoveryDatabase::process_queue_() noexcept
             {
                 erase_endpoint_(entity);
             }
+            applied.push_back(change);
         }
         catch (const utils::InconsistencyException& e)
         {
             logDevError(DDSPIPE_DISCOVERY_DATABASE,
                     "Error processing database operations queue:" << e.what() << ".");
         }
-        entities_to_process_.Pop();
+    }
+
+    if (applied.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    for (auto endpoints_changed_callback : endpoints_changed_callbacks_)
+    {
+        endpoints_changed_callback(applied);
     }
 }
 
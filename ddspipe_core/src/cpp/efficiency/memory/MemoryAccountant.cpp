@@ -0,0 +1,183 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryAccountant.cpp
+ *
+ */
+
+#include <cstdint>
+
+#include <ddspipe_core/efficiency/memory/MemoryAccountant.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr unsigned int MemoryAccountant::N_SHARDS;
+
+MemoryAccountSnapshot MemoryAccount::snapshot() const noexcept
+{
+    MemoryAccountSnapshot result;
+    result.bytes = bytes.load(std::memory_order_relaxed);
+    result.dropped_oldest = dropped_oldest.load(std::memory_order_relaxed);
+    result.rejected = rejected.load(std::memory_order_relaxed);
+    result.downsampled = downsampled.load(std::memory_order_relaxed);
+    return result;
+}
+
+MemoryAccountant::MemoryAccountant(
+        const MemoryBudgetConfiguration& configuration /* = MemoryBudgetConfiguration() */)
+    : configuration_(configuration)
+    , reserved_bytes_(0)
+    , charged_payloads_(0)
+    , n_topics_(0)
+{
+}
+
+const MemoryBudgetConfiguration& MemoryAccountant::configuration() const noexcept
+{
+    return configuration_;
+}
+
+std::shared_ptr<MemoryAccount> MemoryAccountant::topic_account(
+        const std::string& topic)
+{
+    std::lock_guard<std::mutex> lock(accounts_mutex_);
+
+    auto& account = topics_[topic];
+    if (!account)
+    {
+        account = std::make_shared<MemoryAccount>();
+        n_topics_.store(topics_.size(), std::memory_order_relaxed);
+    }
+    return account;
+}
+
+std::shared_ptr<MemoryAccount> MemoryAccountant::participant_account(
+        const types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(accounts_mutex_);
+
+    auto& account = participants_[participant_id];
+    if (!account)
+    {
+        account = std::make_shared<MemoryAccount>();
+    }
+    return account;
+}
+
+void MemoryAccountant::payload_reserved(
+        const types::Payload& payload) noexcept
+{
+    reserved_bytes_.fetch_add(payload.max_size, std::memory_order_relaxed);
+}
+
+void MemoryAccountant::payload_released(
+        const types::Payload& payload) noexcept
+{
+    reserved_bytes_.fetch_sub(payload.max_size, std::memory_order_relaxed);
+
+    if (charged_payloads_ == 0)
+    {
+        return;
+    }
+
+    Shard& shard = shard_(payload.data);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.charges.find(payload.data);
+    if (it == shard.charges.end())
+    {
+        return;
+    }
+
+    it->second.topic->bytes.fetch_sub(it->second.bytes, std::memory_order_relaxed);
+    it->second.participant->bytes.fetch_sub(it->second.bytes, std::memory_order_relaxed);
+    shard.charges.erase(it);
+    charged_payloads_--;
+}
+
+void MemoryAccountant::charge(
+        const types::Payload& payload,
+        MemoryAccount& topic,
+        MemoryAccount& participant) noexcept
+{
+    if (payload.data == nullptr)
+    {
+        return;
+    }
+
+    Shard& shard = shard_(payload.data);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto inserted = shard.charges.emplace(payload.data, Charge{&topic, &participant, payload.max_size});
+    if (!inserted.second)
+    {
+        return;
+    }
+
+    charged_payloads_++;
+    topic.bytes.fetch_add(payload.max_size, std::memory_order_relaxed);
+    participant.bytes.fetch_add(payload.max_size, std::memory_order_relaxed);
+}
+
+uint64_t MemoryAccountant::reserved_bytes() const noexcept
+{
+    int64_t bytes = reserved_bytes_.load(std::memory_order_relaxed);
+    return bytes > 0 ? static_cast<uint64_t>(bytes) : 0;
+}
+
+bool MemoryAccountant::over_budget() const noexcept
+{
+    return configuration_.max_bytes > 0 && reserved_bytes() > configuration_.max_bytes;
+}
+
+uint64_t MemoryAccountant::topic_share() const noexcept
+{
+    uint64_t n_topics = n_topics_.load(std::memory_order_relaxed);
+    return configuration_.max_bytes / (n_topics > 0 ? n_topics : 1);
+}
+
+MemoryUsageSnapshot MemoryAccountant::usage() const
+{
+    MemoryUsageSnapshot result;
+    result.reserved_bytes = reserved_bytes();
+    result.max_bytes = configuration_.max_bytes;
+
+    std::lock_guard<std::mutex> lock(accounts_mutex_);
+
+    for (const auto& topic : topics_)
+    {
+        result.topics[topic.first] = topic.second->snapshot();
+    }
+
+    for (const auto& participant : participants_)
+    {
+        result.participants[participant.first] = participant.second->snapshot();
+    }
+
+    return result;
+}
+
+MemoryAccountant::Shard& MemoryAccountant::shard_(
+        const void* data) noexcept
+{
+    // Payloads are at least 8 bytes aligned, so the lowest bits do not spread them
+    return shards_[(reinterpret_cast<std::uintptr_t>(data) >> 4) % N_SHARDS];
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
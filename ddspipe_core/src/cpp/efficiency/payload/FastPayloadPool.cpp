@@ -86,11 +86,9 @@ bool FastPayloadPool::release_payload(
     MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
     reference_place--;
 
-    // Remove reference
-    (*reference_place)--;
-
-    // In case it was the last reference, release payload
-    if ((*reference_place) == 0)
+    // Remove reference, and in case it was the last one, release payload
+    // NOTE: decrement and check must be a single atomic operation, or two concurrent releases could both free it
+    if (reference_place->fetch_sub(1) == 1)
     {
         // Release payload
         // NOTE: There is no need to check as release cannot return false
@@ -128,6 +126,7 @@ bool FastPayloadPool::reserve_(
     payload.max_size = size;
 
     add_reserved_payload_();
+    payload_reserved_(payload);
 
     logDebug(DDSPIPE_PAYLOADPOOL_FAST, "Reserved payload ptr: " << static_cast<void*>(payload.data) << ".");
 
@@ -139,6 +138,8 @@ bool FastPayloadPool::release_(
 {
     logDebug(DDSPIPE_PAYLOADPOOL_FAST, "Releasing payload ptr: " << static_cast<void*>(payload.data) << ".");
 
+    payload_released_(payload);
+
     // Free memory from the initial allocation, 4 bytes before
     MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
     reference_place--;
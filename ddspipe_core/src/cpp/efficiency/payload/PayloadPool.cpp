@@ -31,6 +31,7 @@ using namespace eprosima::ddspipe::core::types;
 PayloadPool::PayloadPool()
     : reserve_count_(0)
     , release_count_(0)
+    , memory_accountant_(nullptr)
 {
 }
 
@@ -116,9 +117,50 @@ bool PayloadPool::is_clean() const noexcept
     return reserve_count_ == release_count_;
 }
 
+bool PayloadPool::set_memory_accountant(
+        const std::shared_ptr<MemoryAccountant>& accountant) noexcept
+{
+    std::lock_guard<std::mutex> lock(memory_accountant_mutex_);
+
+    if (memory_accountant_owner_)
+    {
+        return false;
+    }
+
+    memory_accountant_owner_ = accountant;
+    memory_accountant_.store(accountant.get());
+    return true;
+}
+
+std::shared_ptr<MemoryAccountant> PayloadPool::memory_accountant() const noexcept
+{
+    std::lock_guard<std::mutex> lock(memory_accountant_mutex_);
+    return memory_accountant_owner_;
+}
+
 /////
 // INTERNAL PART
 
+void PayloadPool::payload_reserved_(
+        const Payload& payload) noexcept
+{
+    MemoryAccountant* accountant = memory_accountant_.load(std::memory_order_acquire);
+    if (accountant != nullptr)
+    {
+        accountant->payload_reserved(payload);
+    }
+}
+
+void PayloadPool::payload_released_(
+        const Payload& payload) noexcept
+{
+    MemoryAccountant* accountant = memory_accountant_.load(std::memory_order_acquire);
+    if (accountant != nullptr)
+    {
+        accountant->payload_released(payload);
+    }
+}
+
 void PayloadPool::add_reserved_payload_()
 {
     ++reserve_count_;
@@ -147,6 +189,7 @@ bool PayloadPool::reserve_(
     }
 
     payload.reserve(size);
+    payload_reserved_(payload);
 
     logDebug(DDSPIPE_PAYLOADPOOL, "Reserved payload ptr: " << payload.data << ".");
 
@@ -160,6 +203,7 @@ bool PayloadPool::release_(
 {
     logDebug(DDSPIPE_PAYLOADPOOL, "Releasing payload ptr: " << payload.data << ".");
 
+    payload_released_(payload);
     payload.empty();
 
     if (payload.data != nullptr)
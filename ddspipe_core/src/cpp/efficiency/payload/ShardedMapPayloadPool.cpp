@@ -0,0 +1,177 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShardedMapPayloadPool.cpp
+ *
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/payload/ShardedMapPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr unsigned int ShardedMapPayloadPool::N_SHARDS;
+
+ShardedMapPayloadPool::~ShardedMapPayloadPool()
+{
+    size_t still_referenced = 0;
+    for (auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        still_referenced += shard.reserved_payloads.size();
+    }
+
+    if (still_referenced > 0)
+    {
+        logDevError(
+            DDSPIPE_PAYLOADPOOL,
+            "Removing ShardedMapPayloadPool with still " << still_referenced << " payloads referenced.");
+
+        // Data could not be erased because they will be erased once the Payload is destroyed
+    }
+}
+
+bool ShardedMapPayloadPool::get_payload(
+        uint32_t size,
+        Payload& payload)
+{
+    // Reserve new payload
+    if (!reserve_(size, payload))
+    {
+        return false;
+    }
+    payload.max_size = size;
+
+    // Store this payload in its shard
+    {
+        Shard& shard = shard_(payload.data);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.reserved_payloads[payload.data] = 1;
+    }
+
+    return true;
+}
+
+bool ShardedMapPayloadPool::get_payload(
+        const Payload& src_payload,
+        IPayloadPool*& data_owner,
+        Payload& target_payload)
+{
+    // If we are not the owner, create a new payload. Else, reference the existing one
+    if (data_owner != this)
+    {
+        // Store space for payload
+        if (!get_payload(src_payload.max_size, target_payload))
+        {
+            return false;
+        }
+
+        // Copy info
+        std::memcpy(target_payload.data, src_payload.data, src_payload.length);
+        target_payload.length = src_payload.length;
+    }
+    else
+    {
+        Shard& shard = shard_(src_payload.data);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // src_payload must be inside reserved payloads
+        auto payload_it = shard.reserved_payloads.find(src_payload.data);
+        if (payload_it == shard.reserved_payloads.end())
+        {
+            logError(DDSPIPE_PAYLOADPOOL, "Payload ownership is this pool, but it is not reserved from here.");
+            throw utils::InconsistencyException("Payload ownership is this pool, but it is not reserved from here.");
+        }
+
+        // Add reference
+        payload_it->second++;
+
+        // Set Payload to refer same payload
+        target_payload.data = src_payload.data;
+        target_payload.length = src_payload.length;
+        target_payload.max_size = src_payload.max_size;
+    }
+    return true;
+}
+
+bool ShardedMapPayloadPool::release_payload(
+        Payload& payload)
+{
+    {
+        Shard& shard = shard_(payload.data);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // Check that this payload is in this pool
+        auto payload_it = shard.reserved_payloads.find(payload.data);
+        if (payload_it == shard.reserved_payloads.end())
+        {
+            logError(DDSPIPE_PAYLOADPOOL, "Trying to release a payload from this pool that is not present.");
+            throw utils::InconsistencyException("Trying to release a payload from this pool that is not present.");
+        }
+
+        // Dereference element
+        payload_it->second--;
+
+        // In case it was not the last reference, there is nothing else to do with the data
+        if (payload_it->second > 0)
+        {
+            payload.length = 0;
+            payload.pos = 0;
+            payload.max_size = 0;
+            payload.data = nullptr;
+            return true;
+        }
+
+        // Remove it from shard before releasing the data, so the memory is freed outside the lock
+        shard.reserved_payloads.erase(payload_it);
+    }
+
+    // It was the last reference, release payload
+    if (!release_(payload))
+    {
+        return false;
+    }
+
+    // Restore payload info
+    payload.length = 0;
+    payload.pos = 0;
+    payload.max_size = 0;
+    payload.data = nullptr;
+
+    return true;
+}
+
+ShardedMapPayloadPool::Shard& ShardedMapPayloadPool::shard_(
+        const PayloadUnit* data) noexcept
+{
+    // Low bits of the pointer are mostly equal due to allocation alignment, so mix them with the higher ones
+    uintptr_t key = reinterpret_cast<uintptr_t>(data);
+    key ^= key >> 16;
+    key ^= key >> 6;
+    return shards_[key % N_SHARDS];
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,907 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemoryPayloadPool.cpp
+ *
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/UnsupportedException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddspipe_core/efficiency/payload/SharedMemoryPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr uint32_t SharedMemoryPayloadPool::DEFAULT_BLOCK_SIZE;
+constexpr uint32_t SharedMemoryPayloadPool::DEFAULT_N_BLOCKS;
+constexpr uint32_t SharedMemoryPayloadPool::MAX_PROCESSES;
+constexpr uint32_t SharedMemoryPayloadPool::SEGMENT_UNINITIALIZED;
+constexpr uint32_t SharedMemoryPayloadPool::SEGMENT_INITIALIZING;
+constexpr uint32_t SharedMemoryPayloadPool::SEGMENT_READY;
+constexpr uint32_t SharedMemoryPayloadPool::SEGMENT_CLOSED;
+
+struct SharedMemoryPayloadPool::SegmentHeader
+{
+    //! Magic number identifying an initialized DDS Pipe segment
+    uint64_t magic;
+
+    //! Version of the segment layout
+    uint32_t version;
+
+    //! Bytes of data of each block
+    uint32_t block_size;
+
+    //! Number of blocks in the segment
+    uint32_t n_blocks;
+
+    //! Owner pid in the high 32 bits, processes attached in the next 16 bits and phase in the low 16 bits
+    std::atomic<uint64_t> control;
+
+    //! Head of the free list: modification tag in the high 32 bits (avoids ABA) and block index in the low ones
+    std::atomic<uint64_t> free_head;
+
+    //! Number of blocks in the free list
+    std::atomic<uint32_t> free_blocks;
+
+    //! Pid of the processes attached to the segment (0 if the slot is free, -1 while its references are reclaimed)
+    std::atomic<int32_t> processes[MAX_PROCESSES];
+};
+
+struct SharedMemoryPayloadPool::BlockHeader
+{
+    //! Number of references to this block held by the process in each slot of the process table
+    std::atomic<uint32_t> process_references[MAX_PROCESSES];
+
+    //! Index of the next block in the free list (only meaningful while the block is free)
+    std::atomic<uint32_t> next_free;
+
+    //! Number of references to this block in every process. It must be just before the data.
+    MetaInfoType references;
+};
+
+namespace {
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "Shared memory reference counters require lock free atomic ints.");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory free list requires lock free atomic 64 bits ints.");
+
+constexpr uint64_t SEGMENT_MAGIC = 0x4444535050495045; // "DDSPPIPE"
+constexpr uint32_t SEGMENT_VERSION = 2;
+
+//! Value of a process slot whose references are being reclaimed
+constexpr int32_t RECLAIMING_SLOT = -1;
+
+//! Index used as end of the free list
+constexpr uint32_t NO_BLOCK = 0xFFFFFFFF;
+
+//! Alignment of the blocks in the segment (cache line)
+constexpr uint64_t BLOCK_ALIGNMENT = 64;
+
+//! Time between checks while another process initializes or removes the segment
+constexpr std::chrono::milliseconds WAIT_READY_PERIOD(10);
+
+uint64_t align_up(
+        uint64_t value,
+        uint64_t alignment) noexcept
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+uint64_t make_control(
+        int32_t owner,
+        uint32_t attached,
+        uint32_t phase) noexcept
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(owner)) << 32) |
+           (static_cast<uint64_t>(attached & 0xFFFF) << 16) |
+           (phase & 0xFFFF);
+}
+
+int32_t control_owner(
+        uint64_t control) noexcept
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(control >> 32));
+}
+
+uint32_t control_attached(
+        uint64_t control) noexcept
+{
+    return static_cast<uint32_t>((control >> 16) & 0xFFFF);
+}
+
+uint32_t control_phase(
+        uint64_t control) noexcept
+{
+    return static_cast<uint32_t>(control & 0xFFFF);
+}
+
+uint64_t head_index(
+        uint64_t head) noexcept
+{
+    return head & 0xFFFFFFFF;
+}
+
+uint64_t next_head(
+        uint64_t head,
+        uint32_t index) noexcept
+{
+    return (((head >> 32) + 1) << 32) | index;
+}
+
+bool is_process_alive(
+        int32_t pid) noexcept
+{
+#if !defined(_WIN32)
+    return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+#else
+    static_cast<void>(pid);
+    return false;
+#endif // if !defined(_WIN32)
+}
+
+int32_t this_process_id() noexcept
+{
+#if !defined(_WIN32)
+    return static_cast<int32_t>(getpid());
+#else
+    return 0;
+#endif // if !defined(_WIN32)
+}
+
+} /* namespace */
+
+SharedMemoryPayloadPool::SharedMemoryPayloadPool(
+        const std::string& segment_name,
+        uint32_t block_size,
+        uint32_t n_blocks)
+    : segment_name_("/" + segment_name)
+    , block_size_(block_size)
+    , n_blocks_(n_blocks)
+    , block_stride_(align_up(sizeof(BlockHeader) + block_size, BLOCK_ALIGNMENT))
+    , segment_size_(header_space_() + block_stride_ * n_blocks)
+    , segment_(nullptr)
+    , header_(nullptr)
+    , process_slot_(MAX_PROCESSES)
+    , recovered_stale_segment_(false)
+{
+    static_assert(sizeof(BlockHeader) == sizeof(uint32_t) * (MAX_PROCESSES + 1) + sizeof(MetaInfoType),
+            "Reference counter must be just before the data of the block.");
+
+    if (block_size_ == 0 || n_blocks_ == 0 || n_blocks_ >= NO_BLOCK)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Invalid shared memory segment layout " << n_blocks_ << "x" << block_size_
+                                     << " for segment " << segment_name_ << ".");
+    }
+
+    open_segment_();
+
+    logInfo(DDSPIPE_PAYLOADPOOL_SHM,
+            "Attached to shared memory segment " << segment_name_ << " with " << n_blocks_ << " blocks of "
+                                                 << block_size_ << " bytes" <<
+            (recovered_stale_segment_ ? " (stale segment recovered)." : "."));
+}
+
+SharedMemoryPayloadPool::~SharedMemoryPayloadPool()
+{
+#if !defined(_WIN32)
+    if (header_ != nullptr)
+    {
+        if (detach_())
+        {
+            // Last process using the segment (now closed for new processes), remove it so it is not found as stale
+            logInfo(DDSPIPE_PAYLOADPOOL_SHM, "Removing shared memory segment " << segment_name_ << ".");
+            shm_unlink(segment_name_.c_str());
+        }
+
+        unmap_segment_();
+    }
+#endif // if !defined(_WIN32)
+}
+
+bool SharedMemoryPayloadPool::get_payload(
+        uint32_t size,
+        Payload& payload)
+{
+    if (size == 0)
+    {
+        logDevError(DDSPIPE_PAYLOADPOOL,
+                "Trying to reserve a data block of 0 bytes.");
+        return false;
+    }
+
+    if (size <= block_size_)
+    {
+        BlockHeader* block = pop_free_block_();
+        if (block == nullptr && reclaim_dead_processes() > 0)
+        {
+            // Blocks held by crashed processes have been freed
+            block = pop_free_block_();
+        }
+
+        if (block != nullptr)
+        {
+            block->process_references[process_slot_].store(1);
+            block->references.store(1);
+
+            payload.data = reinterpret_cast<PayloadUnit*>(block + 1);
+            payload.max_size = size;
+
+            add_reserved_payload_();
+            payload_reserved_(payload);
+
+            logDebug(DDSPIPE_PAYLOADPOOL_SHM, "Reserved shared payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+            return true;
+        }
+
+        logDebug(DDSPIPE_PAYLOADPOOL_SHM,
+                "Shared memory segment " << segment_name_ << " is full, reserving payload in local memory.");
+    }
+
+    return reserve_local_(size, payload);
+}
+
+bool SharedMemoryPayloadPool::get_payload(
+        const Payload& src_payload,
+        IPayloadPool*& data_owner,
+        Payload& target_payload)
+{
+    // If we are not the owner, create a new payload. Else, reference the existing one
+    if (data_owner != this)
+    {
+        // Store space for payload
+        if (!get_payload(src_payload.max_size, target_payload))
+        {
+            return false;
+        }
+
+        // Copy info
+        std::memcpy(target_payload.data, src_payload.data, src_payload.length);
+        target_payload.length = src_payload.length;
+    }
+    else
+    {
+        // IMPORTANT: Every payload reserved from this object has its references counter just before the data
+        MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(src_payload.data);
+        reference_place--;
+
+        // Add reference (and account it to this process if it is in the segment)
+        BlockHeader* block = block_of_(src_payload.data);
+        if (block != nullptr)
+        {
+            block->process_references[process_slot_].fetch_add(1);
+        }
+        reference_place->fetch_add(1);
+
+        // Set Payload to refer same payload
+        target_payload.data = src_payload.data;
+        target_payload.length = src_payload.length;
+        target_payload.max_size = src_payload.max_size;
+
+        add_reserved_payload_();
+    }
+    return true;
+}
+
+bool SharedMemoryPayloadPool::release_payload(
+        Payload& payload)
+{
+    // IMPORTANT: Every payload reserved from this object has its references counter just before the data
+    MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
+    reference_place--;
+
+    BlockHeader* block = block_of_(payload.data);
+    if (block != nullptr)
+    {
+        block->process_references[process_slot_].fetch_sub(1);
+    }
+
+    // Remove reference, and free the data if it was the last one (in any process)
+    if (reference_place->fetch_sub(1) == 1)
+    {
+        payload_released_(payload);
+
+        if (block != nullptr)
+        {
+            logDebug(DDSPIPE_PAYLOADPOOL_SHM, "Releasing shared payload ptr: " << static_cast<void*>(payload.data) << ".");
+            push_free_block_(block);
+        }
+        else
+        {
+            logDebug(DDSPIPE_PAYLOADPOOL_SHM, "Releasing local payload ptr: " << static_cast<void*>(payload.data) << ".");
+            std::free(reference_place);
+        }
+    }
+
+    payload.length = 0;
+    payload.max_size = 0;
+    payload.data = nullptr;
+    payload.pos = 0;
+
+    add_release_payload_();
+
+    return true;
+}
+
+bool SharedMemoryPayloadPool::is_shared(
+        const Payload& payload) const noexcept
+{
+    return block_of_(payload.data) != nullptr;
+}
+
+uint64_t SharedMemoryPayloadPool::offset_of(
+        const Payload& payload) const
+{
+    if (block_of_(payload.data) == nullptr)
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Payload is not stored in shared memory segment " << segment_name_ << ".");
+    }
+
+    return static_cast<uint64_t>(payload.data - segment_);
+}
+
+bool SharedMemoryPayloadPool::get_payload_from_offset(
+        uint64_t offset,
+        uint32_t length,
+        Payload& payload)
+{
+    if (offset >= segment_size_ || length > block_size_)
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Offset " << offset << " out of shared memory segment " << segment_name_ << ".");
+    }
+
+    BlockHeader* block = block_of_(segment_ + offset);
+    if (block == nullptr)
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Offset " << offset << " is not a block in shared memory segment "
+                                     << segment_name_ << ".");
+    }
+
+    // Add a reference only if the data is still referenced by someone, as otherwise it may be already reused
+    unsigned int references = block->references.load();
+    do
+    {
+        if (references == 0)
+        {
+            logWarning(DDSPIPE_PAYLOADPOOL_SHM,
+                    "Referencing released data at offset " << offset << " in segment " << segment_name_ << ".");
+            return false;
+        }
+    } while (!block->references.compare_exchange_weak(references, references + 1));
+
+    block->process_references[process_slot_].fetch_add(1);
+
+    payload.data = reinterpret_cast<PayloadUnit*>(block + 1);
+    payload.length = length;
+    payload.max_size = block_size_;
+
+    add_reserved_payload_();
+
+    return true;
+}
+
+uint32_t SharedMemoryPayloadPool::reclaim_dead_processes() noexcept
+{
+    uint32_t freed_blocks = 0;
+
+    for (uint32_t slot = 0; slot < MAX_PROCESSES; slot++)
+    {
+        int32_t pid = header_->processes[slot].load();
+        if (slot == process_slot_ || pid <= 0 || is_process_alive(pid))
+        {
+            continue;
+        }
+
+        // Only one process reclaims each slot
+        if (!header_->processes[slot].compare_exchange_strong(pid, RECLAIMING_SLOT))
+        {
+            continue;
+        }
+
+        uint32_t released_references = 0;
+        for (uint32_t i = 0; i < n_blocks_; i++)
+        {
+            BlockHeader* block = block_(i);
+            uint32_t references = block->process_references[slot].exchange(0);
+            if (references == 0)
+            {
+                continue;
+            }
+
+            released_references += references;
+            if (block->references.fetch_sub(references) == references)
+            {
+                push_free_block_(block);
+                freed_blocks++;
+            }
+        }
+
+        header_->processes[slot].store(0);
+
+        // The dead process never detached, so it is still counted as attached
+        uint64_t control = header_->control.load();
+        while (control_phase(control) == SEGMENT_READY && control_attached(control) > 0 &&
+                !header_->control.compare_exchange_weak(
+                    control,
+                    make_control(control_owner(control), control_attached(control) - 1, SEGMENT_READY)))
+        {
+        }
+
+        logWarning(DDSPIPE_PAYLOADPOOL_SHM,
+                "Released " << released_references << " references of finished process " << pid
+                            << " in shared memory segment " << segment_name_ << ".");
+    }
+
+    return freed_blocks;
+}
+
+uint32_t SharedMemoryPayloadPool::free_blocks() const noexcept
+{
+    return header_->free_blocks.load();
+}
+
+bool SharedMemoryPayloadPool::recovered_stale_segment() const noexcept
+{
+    return recovered_stale_segment_;
+}
+
+void SharedMemoryPayloadPool::open_segment_()
+{
+#if !defined(_WIN32)
+    while (true)
+    {
+        uint64_t inode = map_segment_();
+
+        if (join_segment_())
+        {
+            // The last process of the segment may have removed it just after this one opened it
+            if (is_linked_(inode))
+            {
+                break;
+            }
+
+            // Not linked anymore, so it must not be unlinked (the name may already refer to a new segment)
+            detach_();
+        }
+
+        // Segment being removed: open it again to create a new one
+        unmap_segment_();
+        std::this_thread::sleep_for(WAIT_READY_PERIOD);
+    }
+
+    // Release the blocks held by processes that finished without detaching
+    reclaim_dead_processes();
+#else
+    throw utils::UnsupportedException("SharedMemoryPayloadPool is only supported in POSIX systems.");
+#endif // if !defined(_WIN32)
+}
+
+uint64_t SharedMemoryPayloadPool::map_segment_()
+{
+#if !defined(_WIN32)
+    // Open the segment, creating it if it does not exist
+    int fd = shm_open(segment_name_.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error opening shared memory segment " << segment_name_ << ": "
+                                     << std::strerror(errno) << ".");
+    }
+
+    // A new segment has size 0 (and is filled with zeros once truncated, so it is uninitialized)
+    struct stat segment_stat;
+    if (fstat(fd, &segment_stat) != 0 ||
+            (segment_stat.st_size == 0 && ftruncate(fd, static_cast<off_t>(segment_size_)) != 0))
+    {
+        close(fd);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error sizing shared memory segment " << segment_name_ << ": "
+                                     << std::strerror(errno) << ".");
+    }
+
+    if (segment_stat.st_size != 0 && static_cast<uint64_t>(segment_stat.st_size) != segment_size_)
+    {
+        close(fd);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Shared memory segment " << segment_name_ << " already exists with size "
+                                     << segment_stat.st_size << " instead of " << segment_size_ << ".");
+    }
+
+    void* segment = mmap(nullptr, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (segment == MAP_FAILED)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error mapping shared memory segment " << segment_name_ << ": "
+                                     << std::strerror(errno) << ".");
+    }
+
+    segment_ = reinterpret_cast<uint8_t*>(segment);
+    header_ = reinterpret_cast<SegmentHeader*>(segment_);
+
+    return static_cast<uint64_t>(segment_stat.st_ino);
+#else
+    return 0;
+#endif // if !defined(_WIN32)
+}
+
+void SharedMemoryPayloadPool::unmap_segment_() noexcept
+{
+#if !defined(_WIN32)
+    munmap(segment_, segment_size_);
+#endif // if !defined(_WIN32)
+    segment_ = nullptr;
+    header_ = nullptr;
+}
+
+bool SharedMemoryPayloadPool::join_segment_()
+{
+    while (true)
+    {
+        uint64_t control = header_->control.load();
+        uint32_t phase = control_phase(control);
+
+        if (phase == SEGMENT_UNINITIALIZED)
+        {
+            // New segment: this process initializes it
+            if (begin_initialization_(control))
+            {
+                initialize_segment_();
+                claim_process_slot_();
+                end_initialization_();
+                return true;
+            }
+            continue;
+        }
+
+        if (phase == SEGMENT_INITIALIZING || phase == SEGMENT_CLOSED)
+        {
+            if (is_process_alive(control_owner(control)))
+            {
+                if (phase == SEGMENT_CLOSED)
+                {
+                    // Being removed by its last process
+                    return false;
+                }
+
+                // Wait for the initializer to finish
+                std::this_thread::sleep_for(WAIT_READY_PERIOD);
+                continue;
+            }
+
+            // The owner died initializing or removing the segment, so nobody else can be using it
+            if (begin_initialization_(control))
+            {
+                logWarning(DDSPIPE_PAYLOADPOOL_SHM,
+                        "Shared memory segment " << segment_name_ << " left by process " << control_owner(control)
+                                                 << " while " << (phase == SEGMENT_CLOSED ? "removing" : "initializing")
+                                                 << " it, recovering it.");
+
+                initialize_segment_();
+                claim_process_slot_();
+                recovered_stale_segment_ = true;
+                end_initialization_();
+                return true;
+            }
+            continue;
+        }
+
+        // Segment ready: if no process using it is alive, it is stale
+        if (!other_process_alive_())
+        {
+            if (begin_initialization_(control))
+            {
+                logWarning(DDSPIPE_PAYLOADPOOL_SHM,
+                        "Shared memory segment " << segment_name_ << " left by a finished process, recovering it.");
+
+                initialize_segment_();
+                claim_process_slot_();
+                recovered_stale_segment_ = true;
+                end_initialization_();
+                return true;
+            }
+            continue;
+        }
+
+        // Segment in use by other processes: check layout and join it
+        if (header_->magic != SEGMENT_MAGIC ||
+                header_->version != SEGMENT_VERSION ||
+                header_->block_size != block_size_ ||
+                header_->n_blocks != n_blocks_)
+        {
+            unmap_segment_();
+            throw utils::InitializationException(
+                      utils::Formatter() << "Shared memory segment " << segment_name_
+                                         << " already exists with a different layout.");
+        }
+
+        // Register this process before counting it, so it is seen alive by processes looking for stale segments
+        if (!claim_process_slot_())
+        {
+            unmap_segment_();
+            throw utils::InitializationException(
+                      utils::Formatter() << "Shared memory segment " << segment_name_ << " already has "
+                                         << MAX_PROCESSES << " processes attached.");
+        }
+
+        // Fails if the segment has been recovered or closed meanwhile (which may have cleared the slot)
+        if (header_->control.compare_exchange_strong(
+                    control,
+                    make_control(control_owner(control), control_attached(control) + 1, SEGMENT_READY)))
+        {
+            return true;
+        }
+
+        release_process_slot_();
+    }
+}
+
+bool SharedMemoryPayloadPool::is_linked_(
+        uint64_t inode) const noexcept
+{
+#if !defined(_WIN32)
+    int fd = shm_open(segment_name_.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat segment_stat;
+    bool linked = fstat(fd, &segment_stat) == 0 && static_cast<uint64_t>(segment_stat.st_ino) == inode;
+    close(fd);
+
+    return linked;
+#else
+    static_cast<void>(inode);
+    return false;
+#endif // if !defined(_WIN32)
+}
+
+uint64_t SharedMemoryPayloadPool::control_() const noexcept
+{
+    return header_->control.load();
+}
+
+bool SharedMemoryPayloadPool::begin_initialization_(
+        uint64_t expected_control) noexcept
+{
+    return header_->control.compare_exchange_strong(
+        expected_control,
+        make_control(this_process_id(), 0, SEGMENT_INITIALIZING));
+}
+
+void SharedMemoryPayloadPool::end_initialization_() noexcept
+{
+    header_->control.store(make_control(this_process_id(), 1, SEGMENT_READY));
+}
+
+void SharedMemoryPayloadPool::initialize_segment_() noexcept
+{
+    header_->magic = SEGMENT_MAGIC;
+    header_->version = SEGMENT_VERSION;
+    header_->block_size = block_size_;
+    header_->n_blocks = n_blocks_;
+
+    for (auto& process : header_->processes)
+    {
+        process.store(0);
+    }
+    process_slot_ = MAX_PROCESSES;
+
+    // Every block is free, linked in order
+    for (uint32_t i = 0; i < n_blocks_; i++)
+    {
+        BlockHeader* block = block_(i);
+        for (auto& process_references : block->process_references)
+        {
+            process_references.store(0);
+        }
+        block->references.store(0);
+        block->next_free.store(i + 1 < n_blocks_ ? i + 1 : NO_BLOCK);
+    }
+
+    header_->free_head.store(0);
+    header_->free_blocks.store(n_blocks_);
+}
+
+bool SharedMemoryPayloadPool::claim_process_slot_() noexcept
+{
+    int32_t pid = this_process_id();
+
+    for (uint32_t slot = 0; slot < MAX_PROCESSES; slot++)
+    {
+        // Slots of dead processes are only reused once their references are reclaimed
+        int32_t current = 0;
+        if (header_->processes[slot].compare_exchange_strong(current, pid))
+        {
+            process_slot_ = slot;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SharedMemoryPayloadPool::release_process_slot_() noexcept
+{
+    if (process_slot_ < MAX_PROCESSES)
+    {
+        int32_t pid = this_process_id();
+        header_->processes[process_slot_].compare_exchange_strong(pid, 0);
+        process_slot_ = MAX_PROCESSES;
+    }
+}
+
+bool SharedMemoryPayloadPool::detach_() noexcept
+{
+    release_process_slot_();
+
+    uint64_t control = header_->control.load();
+    while (control_phase(control) == SEGMENT_READY)
+    {
+        // Last if no other process is counted, or none of the ones counted is alive
+        bool last = control_attached(control) <= 1 || !other_process_alive_();
+
+        uint64_t new_control = last ?
+                make_control(this_process_id(), 0, SEGMENT_CLOSED) :
+                make_control(control_owner(control), control_attached(control) - 1, SEGMENT_READY);
+
+        if (header_->control.compare_exchange_weak(control, new_control))
+        {
+            return last;
+        }
+    }
+
+    // Recovered by another process meanwhile, so it is not this one who removes it
+    return false;
+}
+
+bool SharedMemoryPayloadPool::other_process_alive_() const noexcept
+{
+    for (uint32_t slot = 0; slot < MAX_PROCESSES; slot++)
+    {
+        if (slot != process_slot_ && is_process_alive(header_->processes[slot].load()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+SharedMemoryPayloadPool::BlockHeader* SharedMemoryPayloadPool::pop_free_block_() noexcept
+{
+    uint64_t head = header_->free_head.load();
+
+    while (true)
+    {
+        uint64_t index = head_index(head);
+        if (index == NO_BLOCK)
+        {
+            return nullptr;
+        }
+
+        BlockHeader* block = block_(static_cast<uint32_t>(index));
+        uint32_t next = block->next_free.load();
+
+        // The tag changes in every modification, so it fails if the head has been popped and pushed meanwhile
+        if (header_->free_head.compare_exchange_weak(head, next_head(head, next)))
+        {
+            header_->free_blocks.fetch_sub(1);
+            return block;
+        }
+    }
+}
+
+void SharedMemoryPayloadPool::push_free_block_(
+        BlockHeader* block) noexcept
+{
+    uint32_t index = static_cast<uint32_t>(
+        (reinterpret_cast<uint8_t*>(block) - (segment_ + header_space_())) / block_stride_);
+
+    uint64_t head = header_->free_head.load();
+    do
+    {
+        block->next_free.store(static_cast<uint32_t>(head_index(head)));
+    } while (!header_->free_head.compare_exchange_weak(head, next_head(head, index)));
+
+    header_->free_blocks.fetch_add(1);
+}
+
+uint64_t SharedMemoryPayloadPool::header_space_() noexcept
+{
+    return align_up(sizeof(SegmentHeader), BLOCK_ALIGNMENT);
+}
+
+SharedMemoryPayloadPool::BlockHeader* SharedMemoryPayloadPool::block_(
+        uint32_t index) const noexcept
+{
+    return reinterpret_cast<BlockHeader*>(segment_ + header_space_() + block_stride_ * index);
+}
+
+SharedMemoryPayloadPool::BlockHeader* SharedMemoryPayloadPool::block_of_(
+        const PayloadUnit* data) const noexcept
+{
+    const uint8_t* first_data = segment_ + header_space_() + sizeof(BlockHeader);
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data);
+
+    if (ptr < first_data || ptr >= segment_ + segment_size_)
+    {
+        return nullptr;
+    }
+
+    uint64_t offset = static_cast<uint64_t>(ptr - first_data);
+    if (offset % block_stride_ != 0)
+    {
+        return nullptr;
+    }
+
+    return block_(static_cast<uint32_t>(offset / block_stride_));
+}
+
+bool SharedMemoryPayloadPool::reserve_local_(
+        uint32_t size,
+        Payload& payload) noexcept
+{
+    // Allocate memory + space for reference, as in FastPayloadPool
+    void* memory_allocated = std::malloc(size + sizeof(MetaInfoType));
+    if (memory_allocated == nullptr)
+    {
+        logError(DDSPIPE_PAYLOADPOOL_SHM, "Error allocating a data block of " << size << " bytes.");
+        return false;
+    }
+
+    MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(memory_allocated);
+    (*reference_place) = 1;
+
+    payload.data = reinterpret_cast<PayloadUnit*>(reference_place + 1);
+    payload.max_size = size;
+
+    add_reserved_payload_();
+    payload_reserved_(payload);
+
+    logDebug(DDSPIPE_PAYLOADPOOL_SHM, "Reserved local payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
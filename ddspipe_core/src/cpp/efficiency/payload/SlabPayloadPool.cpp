@@ -0,0 +1,439 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SlabPayloadPool.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/payload/SlabPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+constexpr uint32_t SlabPayloadPool::MIN_SIZE_CLASS_SHIFT;
+constexpr uint32_t SlabPayloadPool::MAX_SIZE_CLASS_SHIFT;
+constexpr uint32_t SlabPayloadPool::N_SIZE_CLASSES;
+constexpr uint64_t SlabPayloadPool::DEFAULT_THREAD_CACHE_MAX_BYTES;
+constexpr uint64_t SlabPayloadPool::DEFAULT_RESERVOIR_MAX_BYTES;
+constexpr uint32_t SlabPayloadPool::THREAD_CACHE_TRANSFER_BLOCKS;
+
+std::atomic<uint64_t> SlabPayloadPool::next_pool_id_{1};
+
+namespace {
+
+//! Extra bytes allocated in each block before the payload data
+constexpr size_t BLOCK_HEADER_SIZE = sizeof(SizeClassType) + sizeof(MetaInfoType);
+
+} /* namespace */
+
+struct SlabPayloadPool::ThreadCache
+{
+    //! Free every block still cached
+    ~ThreadCache()
+    {
+        free_blocks_nts();
+    }
+
+    //! Free every block cached
+    void free_blocks_nts()
+    {
+        for (auto& blocks : free_blocks)
+        {
+            for (void* block : blocks)
+            {
+                std::free(block);
+            }
+            blocks.clear();
+        }
+        cached_bytes = 0;
+    }
+
+    //! Free blocks by size class
+    std::array<std::vector<void*>, N_SIZE_CLASSES> free_blocks;
+
+    //! Bytes currently stored in \c free_blocks
+    uint64_t cached_bytes = 0;
+
+    //! Pool this cache belongs to (nullptr once the pool is destroyed)
+    SlabPayloadPool* pool = nullptr;
+
+    //! Whether the thread owning this cache has finished (so the pool can unregister it)
+    std::atomic<bool> thread_finished{false};
+
+    /**
+     * Guards \c pool , and the blocks when the owner thread finishes or the pool is destroyed.
+     *
+     * The owner thread uses the blocks without it, as a pool must not be used while being destroyed.
+     */
+    std::mutex mutex;
+};
+
+struct SlabPayloadPool::ThreadCaches
+{
+    //! Give the blocks of every cache back to its pool when the thread finishes
+    ~ThreadCaches()
+    {
+        for (auto& it : caches)
+        {
+            ThreadCache& cache = *it.second;
+
+            std::lock_guard<std::mutex> lock(cache.mutex);
+
+            if (cache.pool != nullptr)
+            {
+                for (SizeClassType size_class = 0; size_class < N_SIZE_CLASSES; size_class++)
+                {
+                    cache.pool->flush_thread_cache_(cache, size_class, cache.free_blocks[size_class].size());
+                }
+            }
+            cache.thread_finished = true;
+        }
+    }
+
+    //! Caches of this thread, indexed by pool id
+    std::unordered_map<uint64_t, std::shared_ptr<ThreadCache>> caches;
+};
+
+SlabPayloadPool::SlabPayloadPool(
+        uint64_t thread_cache_max_bytes,
+        uint64_t reservoir_max_bytes)
+    : pool_id_(next_pool_id_.fetch_add(1))
+    , thread_cache_max_bytes_(thread_cache_max_bytes)
+    , reservoir_max_bytes_(reservoir_max_bytes)
+    , reservoir_bytes_(0)
+{
+}
+
+SlabPayloadPool::~SlabPayloadPool()
+{
+    // Free blocks in every thread cache, so they are not stranded in threads that outlive this pool
+    {
+        std::lock_guard<std::mutex> lock(thread_caches_mutex_);
+
+        for (auto& cache : thread_caches_registered_)
+        {
+            std::lock_guard<std::mutex> cache_lock(cache->mutex);
+
+            cache->free_blocks_nts();
+            cache->pool = nullptr;
+        }
+        thread_caches_registered_.clear();
+    }
+
+    // Free blocks in reservoir (after the thread caches, as finishing threads move their blocks here)
+    {
+        std::lock_guard<std::mutex> lock(reservoir_mutex_);
+
+        for (auto& blocks : reservoir_)
+        {
+            for (void* block : blocks)
+            {
+                std::free(block);
+            }
+            blocks.clear();
+        }
+        reservoir_bytes_ = 0;
+    }
+}
+
+bool SlabPayloadPool::reserve_(
+        uint32_t size,
+        types::Payload& payload)
+{
+    if (size == 0)
+    {
+        logDevError(DDSPIPE_PAYLOADPOOL,
+                "Trying to reserve a data block of 0 bytes.");
+        return false;
+    }
+
+    SizeClassType size_class = size_class_(size);
+    void* memory_allocated = nullptr;
+
+    if (size_class < N_SIZE_CLASSES)
+    {
+        uint64_t block_bytes = size_class_bytes_(size_class);
+
+        // Look for a free block in this thread cache, taking a batch of them from the reservoir if empty
+        ThreadCache& cache = thread_cache_();
+        auto& cached_blocks = cache.free_blocks[size_class];
+        if (cached_blocks.empty())
+        {
+            refill_thread_cache_(cache, size_class);
+        }
+
+        if (!cached_blocks.empty())
+        {
+            memory_allocated = cached_blocks.back();
+            cached_blocks.pop_back();
+            cache.cached_bytes -= block_bytes;
+        }
+
+        // No free block available, allocate a new one for the whole size class
+        if (memory_allocated == nullptr)
+        {
+            memory_allocated = std::malloc(block_bytes + BLOCK_HEADER_SIZE);
+        }
+    }
+    else
+    {
+        // Too big to be recycled, allocate exactly what is needed
+        memory_allocated = std::malloc(size + BLOCK_HEADER_SIZE);
+    }
+
+    if (memory_allocated == nullptr)
+    {
+        logError(DDSPIPE_PAYLOADPOOL_SLAB, "Error allocating a data block of " << size << " bytes.");
+        return false;
+    }
+
+    // Store the size class so it can be recycled in release
+    SizeClassType* size_class_place = reinterpret_cast<SizeClassType*>(memory_allocated);
+    (*size_class_place) = size_class;
+
+    // Use reference space to set that this is referenced for the first time
+    MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(size_class_place + 1);
+    (*reference_place) = 1;
+
+    payload.data = reinterpret_cast<eprosima::fastrtps::rtps::octet*>(reference_place + 1);
+    payload.max_size = size;
+
+    add_reserved_payload_();
+    payload_reserved_(payload);
+
+    logDebug(DDSPIPE_PAYLOADPOOL_SLAB, "Reserved payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+    return true;
+}
+
+bool SlabPayloadPool::release_(
+        types::Payload& payload)
+{
+    logDebug(DDSPIPE_PAYLOADPOOL_SLAB, "Releasing payload ptr: " << static_cast<void*>(payload.data) << ".");
+
+    payload_released_(payload);
+
+    // Get the beginning of the block, before the reference and the size class
+    MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
+    reference_place--;
+    SizeClassType* size_class_place = reinterpret_cast<SizeClassType*>(reference_place);
+    size_class_place--;
+
+    SizeClassType size_class = (*size_class_place);
+    void* memory_allocated = size_class_place;
+    bool recycled = false;
+
+    if (size_class < N_SIZE_CLASSES)
+    {
+        uint64_t block_bytes = size_class_bytes_(size_class);
+
+        // Store it in this thread cache
+        ThreadCache& cache = thread_cache_();
+        auto& cached_blocks = cache.free_blocks[size_class];
+        cached_blocks.push_back(memory_allocated);
+        cache.cached_bytes += block_bytes;
+        recycled = true;
+
+        // Move a batch of blocks to the reservoir if this size class holds too many, so other threads reuse them
+        if (cached_blocks.size() > 2 * THREAD_CACHE_TRANSFER_BLOCKS)
+        {
+            flush_thread_cache_(cache, size_class, THREAD_CACHE_TRANSFER_BLOCKS);
+        }
+
+        // Move batches of blocks to the reservoir (or free them) until the cache fits in its limit
+        while (cache.cached_bytes > thread_cache_max_bytes_ && !cached_blocks.empty())
+        {
+            flush_thread_cache_(cache, size_class, THREAD_CACHE_TRANSFER_BLOCKS);
+        }
+    }
+
+    if (!recycled)
+    {
+        std::free(memory_allocated);
+    }
+
+    // Remove payload internal values
+    payload.length = 0;
+    payload.max_size = 0;
+    payload.data = nullptr;
+    payload.pos = 0;
+
+    add_release_payload_();
+
+    return true;
+}
+
+SizeClassType SlabPayloadPool::size_class_(
+        uint32_t size) noexcept
+{
+    uint32_t shift = MIN_SIZE_CLASS_SHIFT;
+    while ((static_cast<uint64_t>(1) << shift) < size)
+    {
+        shift++;
+    }
+
+    if (shift > MAX_SIZE_CLASS_SHIFT)
+    {
+        return N_SIZE_CLASSES;
+    }
+
+    return shift - MIN_SIZE_CLASS_SHIFT;
+}
+
+uint64_t SlabPayloadPool::size_class_bytes_(
+        SizeClassType size_class) noexcept
+{
+    return static_cast<uint64_t>(1) << (size_class + MIN_SIZE_CLASS_SHIFT);
+}
+
+void SlabPayloadPool::flush_thread_cache_(
+        ThreadCache& cache,
+        SizeClassType size_class,
+        size_t n_blocks)
+{
+    auto& cached_blocks = cache.free_blocks[size_class];
+    uint64_t block_bytes = size_class_bytes_(size_class);
+
+    n_blocks = std::min(n_blocks, cached_blocks.size());
+    size_t first_block = cached_blocks.size() - n_blocks;
+    size_t moved_blocks = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(reservoir_mutex_);
+
+        auto& reservoir_blocks = reservoir_[size_class];
+        while (moved_blocks < n_blocks && reservoir_bytes_ + block_bytes <= reservoir_max_bytes_)
+        {
+            reservoir_blocks.push_back(cached_blocks[first_block + moved_blocks]);
+            reservoir_bytes_ += block_bytes;
+            moved_blocks++;
+        }
+    }
+
+    // Free the blocks that do not fit in the reservoir
+    for (size_t i = first_block + moved_blocks; i < cached_blocks.size(); i++)
+    {
+        std::free(cached_blocks[i]);
+    }
+
+    cached_blocks.resize(first_block);
+    cache.cached_bytes -= n_blocks * block_bytes;
+}
+
+void SlabPayloadPool::refill_thread_cache_(
+        ThreadCache& cache,
+        SizeClassType size_class)
+{
+    auto& cached_blocks = cache.free_blocks[size_class];
+    uint64_t block_bytes = size_class_bytes_(size_class);
+
+    // Take as many blocks as fit in the cache, but at least the one about to be used
+    uint64_t room_blocks = 1;
+    if (cache.cached_bytes < thread_cache_max_bytes_)
+    {
+        room_blocks = std::max<uint64_t>(1, (thread_cache_max_bytes_ - cache.cached_bytes) / block_bytes);
+    }
+    uint64_t max_blocks = std::min<uint64_t>(THREAD_CACHE_TRANSFER_BLOCKS, room_blocks);
+
+    std::lock_guard<std::mutex> lock(reservoir_mutex_);
+
+    auto& reservoir_blocks = reservoir_[size_class];
+    size_t n_blocks = static_cast<size_t>(std::min<uint64_t>(max_blocks, reservoir_blocks.size()));
+
+    cached_blocks.insert(cached_blocks.end(), reservoir_blocks.end() - n_blocks, reservoir_blocks.end());
+    reservoir_blocks.resize(reservoir_blocks.size() - n_blocks);
+
+    reservoir_bytes_ -= n_blocks * block_bytes;
+    cache.cached_bytes += n_blocks * block_bytes;
+}
+
+SlabPayloadPool::ThreadCache& SlabPayloadPool::thread_cache_()
+{
+    // Pool ids are never reused, so the cached pointer is only used while its pool is alive
+    static thread_local uint64_t last_pool_id = 0;
+    static thread_local ThreadCache* last_cache = nullptr;
+
+    if (last_pool_id == pool_id_)
+    {
+        return *last_cache;
+    }
+
+    auto& caches = thread_caches_().caches;
+    auto it = caches.find(pool_id_);
+
+    if (it == caches.end())
+    {
+        // Forget the caches of pools already destroyed
+        for (auto cache_it = caches.begin(); cache_it != caches.end();)
+        {
+            std::lock_guard<std::mutex> lock(cache_it->second->mutex);
+
+            if (cache_it->second->pool == nullptr)
+            {
+                cache_it = caches.erase(cache_it);
+            }
+            else
+            {
+                ++cache_it;
+            }
+        }
+
+        auto cache = std::make_shared<ThreadCache>();
+        cache->pool = this;
+
+        // Register it in the pool, forgetting the caches of threads already finished
+        {
+            std::lock_guard<std::mutex> lock(thread_caches_mutex_);
+
+            thread_caches_registered_.erase(
+                std::remove_if(
+                    thread_caches_registered_.begin(),
+                    thread_caches_registered_.end(),
+                    [](const std::shared_ptr<ThreadCache>& registered)
+                    {
+                        return registered->thread_finished.load();
+                    }),
+                thread_caches_registered_.end());
+
+            thread_caches_registered_.push_back(cache);
+        }
+
+        it = caches.emplace(pool_id_, std::move(cache)).first;
+    }
+
+    last_cache = it->second.get();
+    last_pool_id = pool_id_;
+
+    return *last_cache;
+}
+
+SlabPayloadPool::ThreadCaches& SlabPayloadPool::thread_caches_() noexcept
+{
+    static thread_local ThreadCaches caches;
+    return caches;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,85 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FifoThreadPool.cpp
+ *
+ */
+
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+FifoThreadPool::FifoThreadPool(
+        unsigned int n_threads,
+        unsigned int messages_per_turn /* = 0 */)
+    : FifoThreadPool(std::make_shared<utils::SlotThreadPool>(n_threads), messages_per_turn)
+{
+}
+
+FifoThreadPool::FifoThreadPool(
+        const std::shared_ptr<utils::SlotThreadPool>& thread_pool,
+        unsigned int messages_per_turn /* = 0 */)
+    : thread_pool_(thread_pool)
+    , messages_per_turn_(messages_per_turn)
+{
+}
+
+void FifoThreadPool::enable() noexcept
+{
+    thread_pool_->enable();
+}
+
+void FifoThreadPool::disable() noexcept
+{
+    thread_pool_->disable();
+}
+
+void FifoThreadPool::slot(
+        const utils::TaskId& task_id,
+        Task&& task)
+{
+    thread_pool_->slot(task_id, std::move(task));
+}
+
+void FifoThreadPool::unslot(
+        const utils::TaskId& task_id)
+{
+    thread_pool_->slot(task_id, []()
+            {
+            });
+}
+
+void FifoThreadPool::emit(
+        const utils::TaskId& task_id,
+        unsigned int /* priority = 0 */)
+{
+    thread_pool_->emit(task_id);
+}
+
+unsigned int FifoThreadPool::messages_per_turn() const noexcept
+{
+    return messages_per_turn_;
+}
+
+std::vector<PriorityClassMetricsSnapshot> FifoThreadPool::metrics() const noexcept
+{
+    return {};
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,268 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PriorityThreadPool.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/thread_pool/PriorityThreadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr const unsigned int PriorityThreadPool::DEFAULT_PRIORITY_CLASSES;
+constexpr const unsigned int PriorityThreadPool::DEFAULT_STARVATION_TIMEOUT_MS;
+
+PriorityThreadPool::PriorityThreadPool(
+        unsigned int n_threads,
+        unsigned int messages_per_turn /* = 0 */,
+        unsigned int n_priority_classes /* = DEFAULT_PRIORITY_CLASSES */,
+        unsigned int starvation_timeout_ms /* = DEFAULT_STARVATION_TIMEOUT_MS */)
+    : n_threads_(n_threads > 0 ? n_threads : 1)
+    , messages_per_turn_(messages_per_turn)
+    , starvation_timeout_(starvation_timeout_ms)
+    , pending_tasks_(0)
+    , enabled_(false)
+{
+    if (n_threads == 0)
+    {
+        logWarning(DDSPIPE_THREAD_POOL, "Priority thread pool created with 0 threads. Using 1 thread instead.");
+    }
+
+    if (n_priority_classes == 0)
+    {
+        logWarning(DDSPIPE_THREAD_POOL, "Priority thread pool created with 0 priority classes. Using 1 instead.");
+        n_priority_classes = 1;
+    }
+
+    classes_.reserve(n_priority_classes);
+    for (unsigned int i = 0; i < n_priority_classes; i++)
+    {
+        classes_.push_back(std::make_unique<PriorityClass>());
+    }
+}
+
+PriorityThreadPool::~PriorityThreadPool()
+{
+    disable();
+}
+
+void PriorityThreadPool::enable() noexcept
+{
+    std::lock_guard<std::mutex> lock(enabling_mutex_);
+
+    {
+        std::lock_guard<std::mutex> queues_lock(mutex_);
+        if (enabled_)
+        {
+            return;
+        }
+        enabled_ = true;
+    }
+
+    logDebug(DDSPIPE_THREAD_POOL, "Enabling priority thread pool with " << n_threads_ << " threads and "
+                                                                       << classes_.size() << " priority classes.");
+
+    // Tasks emitted while disabled are still in the queues, so they are executed now
+    for (unsigned int i = 0; i < n_threads_; i++)
+    {
+        threads_.emplace_back(&PriorityThreadPool::run_, this);
+    }
+}
+
+void PriorityThreadPool::disable() noexcept
+{
+    std::lock_guard<std::mutex> lock(enabling_mutex_);
+
+    {
+        std::lock_guard<std::mutex> queues_lock(mutex_);
+        if (!enabled_)
+        {
+            return;
+        }
+        enabled_ = false;
+    }
+    cv_.notify_all();
+
+    logDebug(DDSPIPE_THREAD_POOL, "Disabling priority thread pool.");
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void PriorityThreadPool::slot(
+        const utils::TaskId& task_id,
+        Task&& task)
+{
+    auto shared_task = std::make_shared<const Task>(std::move(task));
+
+    std::unique_lock<std::shared_timed_mutex> lock(slots_mutex_);
+    slots_[task_id] = std::move(shared_task);
+}
+
+void PriorityThreadPool::unslot(
+        const utils::TaskId& task_id)
+{
+    std::unique_lock<std::shared_timed_mutex> lock(slots_mutex_);
+    slots_.erase(task_id);
+}
+
+void PriorityThreadPool::emit(
+        const utils::TaskId& task_id,
+        unsigned int priority /* = 0 */)
+{
+    unsigned int index = std::min(priority, static_cast<unsigned int>(classes_.size() - 1));
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        classes_[index]->emissions.push_back({task_id, std::chrono::steady_clock::now()});
+        pending_tasks_++;
+    }
+    cv_.notify_one();
+}
+
+unsigned int PriorityThreadPool::messages_per_turn() const noexcept
+{
+    return messages_per_turn_;
+}
+
+unsigned int PriorityThreadPool::priority_classes() const noexcept
+{
+    return classes_.size();
+}
+
+std::vector<PriorityClassMetricsSnapshot> PriorityThreadPool::metrics() const noexcept
+{
+    std::vector<PriorityClassMetricsSnapshot> result(classes_.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (unsigned int i = 0; i < classes_.size(); i++)
+    {
+        const PriorityClass& priority_class = *classes_[i];
+        result[i].priority = i;
+        result[i].executed = priority_class.executed;
+        result[i].starvation_promotions = priority_class.starvation_promotions;
+        result[i].queue_depth = priority_class.emissions.size();
+        result[i].queueing_delay = priority_class.queueing_delay.snapshot();
+    }
+
+    return result;
+}
+
+void PriorityThreadPool::run_() noexcept
+{
+    while (true)
+    {
+        utils::TaskId task_id;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(
+                lock,
+                [this]()
+                {
+                    return !enabled_ || pending_tasks_ > 0;
+                });
+
+            if (!enabled_)
+            {
+                return;
+            }
+
+            task_id = pop_nts_();
+        }
+
+        execute_(task_id);
+    }
+}
+
+utils::TaskId PriorityThreadPool::pop_nts_() noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    // Highest class with emissions queued
+    int highest = classes_.size() - 1;
+    while (classes_[highest]->emissions.empty())
+    {
+        highest--;
+    }
+
+    // Oldest emission of a lower class that has waited longer than the timeout
+    int selected = highest;
+    bool promoted = false;
+    for (int i = highest - 1; i >= 0; i--)
+    {
+        const auto& emissions = classes_[i]->emissions;
+        if (!emissions.empty()
+                && now - emissions.front().time >= starvation_timeout_
+                && (!promoted || emissions.front().time < classes_[selected]->emissions.front().time))
+        {
+            selected = i;
+            promoted = true;
+        }
+    }
+
+    PriorityClass& priority_class = *classes_[selected];
+    Emission emission = priority_class.emissions.front();
+    priority_class.emissions.pop_front();
+    pending_tasks_--;
+
+    priority_class.executed++;
+    if (promoted)
+    {
+        priority_class.starvation_promotions++;
+    }
+    priority_class.queueing_delay.record(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - emission.time).count());
+
+    return emission.task_id;
+}
+
+void PriorityThreadPool::execute_(
+        const utils::TaskId& task_id) noexcept
+{
+    std::shared_ptr<const Task> task;
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(slots_mutex_);
+        auto it = slots_.find(task_id);
+        if (it != slots_.end())
+        {
+            task = it->second;
+        }
+    }
+
+    if (task)
+    {
+        (*task)();
+    }
+    else
+    {
+        // Emissions pending when the slot was removed end up here
+        logDebug(DDSPIPE_THREAD_POOL, "Task " << task_id << " emitted without slot. Skipping it.");
+    }
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,74 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TaskGuard.cpp
+ *
+ */
+
+#include <ddspipe_core/efficiency/thread_pool/TaskGuard.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+bool TaskGuard::enter() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (closed_)
+    {
+        return false;
+    }
+
+    executions_++;
+    return true;
+}
+
+void TaskGuard::leave() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        executions_--;
+    }
+    executions_cv_.notify_all();
+}
+
+void TaskGuard::close() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    executions_cv_.wait(lock, [this]()
+            {
+                return executions_ == 0;
+            });
+}
+
+IThreadPool::Task TaskGuard::guarded_task(
+        const std::shared_ptr<TaskGuard>& guard,
+        IThreadPool::Task&& task) noexcept
+{
+    return [guard, task = std::move(task)]()
+           {
+               if (guard->enter())
+               {
+                   task();
+                   guard->leave();
+               }
+           };
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,294 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WorkStealingThreadPool.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif // if defined(__linux__)
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/efficiency/thread_pool/WorkStealingThreadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+namespace {
+
+//! Pool the current thread belongs to, if any
+thread_local const WorkStealingThreadPool* current_pool = nullptr;
+
+//! Index of the current thread in \c current_pool
+thread_local unsigned int current_worker = 0;
+
+} /* namespace */
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+        unsigned int n_threads,
+        unsigned int messages_per_turn /* = 0 */,
+        bool cpu_pinning /* = false */)
+    : n_threads_(n_threads > 0 ? n_threads : 1)
+    , messages_per_turn_(messages_per_turn)
+    , cpu_pinning_(cpu_pinning)
+    , pending_tasks_(0)
+    , idle_threads_(0)
+    , next_worker_(0)
+    , enabled_(false)
+{
+    if (n_threads == 0)
+    {
+        logWarning(DDSPIPE_THREAD_POOL, "Work stealing thread pool created with 0 threads. Using 1 thread instead.");
+    }
+
+    workers_.reserve(n_threads_);
+    for (unsigned int i = 0; i < n_threads_; i++)
+    {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    disable();
+}
+
+void WorkStealingThreadPool::enable() noexcept
+{
+    std::lock_guard<std::mutex> lock(enabling_mutex_);
+
+    if (enabled_)
+    {
+        return;
+    }
+
+    logDebug(DDSPIPE_THREAD_POOL, "Enabling work stealing thread pool with " << n_threads_ << " threads.");
+
+    {
+        std::lock_guard<std::mutex> idle_lock(idle_mutex_);
+        enabled_ = true;
+    }
+
+    // Tasks emitted while disabled are still in the queues, so they are executed now
+    for (unsigned int i = 0; i < n_threads_; i++)
+    {
+        threads_.emplace_back(&WorkStealingThreadPool::run_, this, i);
+    }
+}
+
+void WorkStealingThreadPool::disable() noexcept
+{
+    std::lock_guard<std::mutex> lock(enabling_mutex_);
+
+    if (!enabled_)
+    {
+        return;
+    }
+
+    logDebug(DDSPIPE_THREAD_POOL, "Disabling work stealing thread pool.");
+
+    {
+        // Set inside the mutex so no thread starts waiting after being notified
+        std::lock_guard<std::mutex> idle_lock(idle_mutex_);
+        enabled_ = false;
+    }
+    idle_cv_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void WorkStealingThreadPool::slot(
+        const utils::TaskId& task_id,
+        Task&& task)
+{
+    auto shared_task = std::make_shared<const Task>(std::move(task));
+
+    std::unique_lock<std::shared_timed_mutex> lock(slots_mutex_);
+    slots_[task_id] = std::move(shared_task);
+}
+
+void WorkStealingThreadPool::unslot(
+        const utils::TaskId& task_id)
+{
+    std::unique_lock<std::shared_timed_mutex> lock(slots_mutex_);
+    slots_.erase(task_id);
+}
+
+void WorkStealingThreadPool::emit(
+        const utils::TaskId& task_id,
+        unsigned int /* priority = 0 */)
+{
+    // A thread of the pool keeps the task it emits, any other spreads them between threads
+    unsigned int index = (current_pool == this) ? current_worker : (next_worker_++ % n_threads_);
+
+    {
+        std::lock_guard<std::mutex> lock(workers_[index]->mutex);
+        workers_[index]->tasks.push_back(task_id);
+    }
+
+    // Increased after queueing, so an idle thread that sees it can always take a task.
+    // An idle thread increases idle_threads_ before checking pending_tasks_, so one of both sees the other.
+    pending_tasks_++;
+
+    if (idle_threads_ > 0)
+    {
+        {
+            std::lock_guard<std::mutex> idle_lock(idle_mutex_);
+        }
+        idle_cv_.notify_one();
+    }
+}
+
+unsigned int WorkStealingThreadPool::messages_per_turn() const noexcept
+{
+    return messages_per_turn_;
+}
+
+std::vector<PriorityClassMetricsSnapshot> WorkStealingThreadPool::metrics() const noexcept
+{
+    return {};
+}
+
+void WorkStealingThreadPool::run_(
+        unsigned int index) noexcept
+{
+    current_pool = this;
+    current_worker = index;
+
+    if (cpu_pinning_)
+    {
+        pin_to_cpu_(index);
+    }
+
+    while (enabled_)
+    {
+        utils::TaskId task_id;
+        if (pop_(index, task_id))
+        {
+            execute_(task_id);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> idle_lock(idle_mutex_);
+        idle_threads_++;
+        idle_cv_.wait(
+            idle_lock,
+            [this]()
+            {
+                return !enabled_ || pending_tasks_ > 0;
+            });
+        idle_threads_--;
+    }
+
+    current_pool = nullptr;
+}
+
+bool WorkStealingThreadPool::pop_(
+        unsigned int index,
+        utils::TaskId& task_id) noexcept
+{
+    for (unsigned int i = 0; i < n_threads_; i++)
+    {
+        bool own = (i == 0);
+        Worker& worker = *workers_[(index + i) % n_threads_];
+
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        if (worker.tasks.empty())
+        {
+            continue;
+        }
+
+        if (own)
+        {
+            task_id = worker.tasks.front();
+            worker.tasks.pop_front();
+        }
+        else
+        {
+            // Steal the most recent task, the owner keeps working on the oldest ones
+            task_id = worker.tasks.back();
+            worker.tasks.pop_back();
+        }
+
+        pending_tasks_--;
+        return true;
+    }
+
+    return false;
+}
+
+void WorkStealingThreadPool::execute_(
+        const utils::TaskId& task_id) noexcept
+{
+    std::shared_ptr<const Task> task;
+
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(slots_mutex_);
+        auto it = slots_.find(task_id);
+        if (it != slots_.end())
+        {
+            task = it->second;
+        }
+    }
+
+    if (task)
+    {
+        (*task)();
+    }
+    else
+    {
+        // Emissions pending when the slot was removed end up here
+        logDebug(DDSPIPE_THREAD_POOL, "Task " << task_id << " emitted without slot. Skipping it.");
+    }
+}
+
+void WorkStealingThreadPool::pin_to_cpu_(
+        unsigned int index) noexcept
+{
+#if defined(__linux__)
+    unsigned int n_cpus = std::thread::hardware_concurrency();
+    unsigned int cpu = n_cpus > 0 ? index % n_cpus : index;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+    if (ret != 0)
+    {
+        logWarning(DDSPIPE_THREAD_POOL, "Error pinning thread " << index << " to CPU " << cpu
+                                                                << ". Error code " << ret << ".");
+    }
+    else
+    {
+        logDebug(DDSPIPE_THREAD_POOL, "Thread " << index << " pinned to CPU " << cpu << ".");
+    }
+#else
+    logWarning(DDSPIPE_THREAD_POOL, "CPU pinning is only supported in Linux. Thread " << index << " not pinned.");
+#endif // if defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
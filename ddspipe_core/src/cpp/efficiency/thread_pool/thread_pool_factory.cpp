@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file thread_pool_factory.cpp
+ *
+ */
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/PriorityThreadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/thread_pool_factory.hpp>
+#include <ddspipe_core/efficiency/thread_pool/WorkStealingThreadPool.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+std::shared_ptr<IThreadPool> create_thread_pool(
+        const ThreadPoolConfiguration& configuration)
+{
+    utils::Formatter error_msg;
+    if (!configuration.is_valid(error_msg))
+    {
+        throw utils::ConfigurationException(
+                  utils::Formatter() <<
+                      "Configuration for thread pool is invalid: " << error_msg);
+    }
+
+    switch (configuration.kind)
+    {
+        case ThreadPoolKind::fifo:
+            return std::make_shared<FifoThreadPool>(
+                configuration.n_threads,
+                configuration.messages_per_turn);
+
+        case ThreadPoolKind::work_stealing:
+            return std::make_shared<WorkStealingThreadPool>(
+                configuration.n_threads,
+                configuration.messages_per_turn,
+                configuration.cpu_pinning);
+
+        case ThreadPoolKind::priority:
+            return std::make_shared<PriorityThreadPool>(
+                configuration.n_threads,
+                configuration.messages_per_turn,
+                configuration.priority_classes,
+                configuration.starvation_timeout);
+
+        default:
+            utils::tsnh(utils::Formatter() << "Unknown thread pool kind.");
+            return nullptr;
+    }
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
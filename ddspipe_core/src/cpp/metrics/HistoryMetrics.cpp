@@ -0,0 +1,48 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file HistoryMetrics.cpp
+ *
+ */
+
+#include <ddspipe_core/metrics/HistoryMetrics.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+HistoryMetricsSnapshot& HistoryMetricsSnapshot::operator +=(
+        const HistoryMetricsSnapshot& other) noexcept
+{
+    reserved_caches += other.reserved_caches;
+    max_caches += other.max_caches;
+    backlog += other.backlog;
+    footprint_bytes += other.footprint_bytes;
+    return *this;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const HistoryMetricsSnapshot& metrics)
+{
+    os << "HistoryMetrics{reserved(" << metrics.reserved_caches << "/" << metrics.max_caches
+       << ");backlog(" << metrics.backlog << ");bytes(" << metrics.footprint_bytes << ")}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
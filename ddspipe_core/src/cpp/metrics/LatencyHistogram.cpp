@@ -0,0 +1,168 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr unsigned int LatencyHistogram::SUB_BUCKET_BITS;
+constexpr unsigned int LatencyHistogram::SUB_BUCKETS;
+constexpr unsigned int LatencyHistogram::MAX_EXPONENT;
+constexpr unsigned int LatencyHistogram::N_BUCKETS;
+
+namespace {
+
+//! Position of the most significant bit set of \c value (value must not be 0)
+unsigned int highest_bit(
+        uint64_t value) noexcept
+{
+    unsigned int bit = 0;
+    while (value >>= 1)
+    {
+        bit++;
+    }
+    return bit;
+}
+
+} /* namespace */
+
+double LatencyHistogramSnapshot::mean() const noexcept
+{
+    return count == 0 ? 0 : static_cast<double>(sum) / count;
+}
+
+uint64_t LatencyHistogramSnapshot::percentile(
+        double percentile) const noexcept
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Number of values that must be below the result (at least 1)
+    uint64_t threshold = static_cast<uint64_t>(std::max(1.0, percentile * count / 100.0));
+
+    uint64_t accumulated = 0;
+    for (unsigned int i = 0; i < buckets.size(); i++)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= threshold)
+        {
+            // Upper bound of the bucket, but never over the maximum seen
+            uint64_t upper_bound = (i + 1 < LatencyHistogram::N_BUCKETS) ?
+                    LatencyHistogram::bucket_lower_bound(i + 1) - 1 : max;
+            return std::min(upper_bound, max);
+        }
+    }
+
+    return max;
+}
+
+void LatencyHistogram::record(
+        uint64_t value_ns) noexcept
+{
+    buckets_[bucket_index(value_ns)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value_ns, std::memory_order_relaxed);
+
+    // Only loop while this value is a new minimum / maximum, which is rare after the first values
+    uint64_t current = min_.load(std::memory_order_relaxed);
+    while (value_ns < current && !min_.compare_exchange_weak(current, value_ns, std::memory_order_relaxed))
+    {
+    }
+
+    current = max_.load(std::memory_order_relaxed);
+    while (value_ns > current && !max_.compare_exchange_weak(current, value_ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencyHistogramSnapshot LatencyHistogram::snapshot() const noexcept
+{
+    LatencyHistogramSnapshot result;
+
+    result.buckets.reserve(N_BUCKETS);
+    for (const auto& bucket : buckets_)
+    {
+        result.buckets.push_back(bucket.load(std::memory_order_relaxed));
+    }
+
+    result.count = count_.load(std::memory_order_relaxed);
+    result.sum = sum_.load(std::memory_order_relaxed);
+    result.max = max_.load(std::memory_order_relaxed);
+    result.min = (result.count == 0) ? 0 : min_.load(std::memory_order_relaxed);
+
+    return result;
+}
+
+unsigned int LatencyHistogram::bucket_index(
+        uint64_t value_ns) noexcept
+{
+    // Small values have a bucket each
+    if (value_ns < SUB_BUCKETS)
+    {
+        return static_cast<unsigned int>(value_ns);
+    }
+
+    unsigned int exponent = highest_bit(value_ns);
+    if (exponent > MAX_EXPONENT)
+    {
+        return N_BUCKETS - 1;
+    }
+
+    // The SUB_BUCKET_BITS bits after the most significant one select the linear sub-bucket
+    unsigned int shift = exponent - SUB_BUCKET_BITS;
+    unsigned int sub_bucket = static_cast<unsigned int>(value_ns >> shift) - SUB_BUCKETS;
+
+    return SUB_BUCKETS + shift * SUB_BUCKETS + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_lower_bound(
+        unsigned int index) noexcept
+{
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    unsigned int shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+    unsigned int sub_bucket = (index - SUB_BUCKETS) % SUB_BUCKETS;
+
+    return static_cast<uint64_t>(SUB_BUCKETS + sub_bucket) << shift;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const LatencyHistogramSnapshot& histogram)
+{
+    os << "Latency{count(" << histogram.count << ");mean(" << histogram.mean() << "ns)"
+       << ";min(" << histogram.min << "ns)"
+       << ";p50(" << histogram.percentile(50) << "ns)"
+       << ";p99(" << histogram.percentile(99) << "ns)"
+       << ";max(" << histogram.max << "ns)}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,55 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryUsage.cpp
+ *
+ */
+
+#include <ddspipe_core/metrics/MemoryUsage.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryAccountSnapshot& account)
+{
+    os << "MemoryAccount{bytes(" << account.bytes << ");dropped_oldest(" << account.dropped_oldest
+       << ");rejected(" << account.rejected << ");downsampled(" << account.downsampled << ")}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryUsageSnapshot& usage)
+{
+    os << "MemoryUsage{reserved(" << usage.reserved_bytes << "/" << usage.max_bytes << ");topics{";
+    for (const auto& topic : usage.topics)
+    {
+        os << topic.first << ":" << topic.second << ";";
+    }
+    os << "};participants{";
+    for (const auto& participant : usage.participants)
+    {
+        os << participant.first << ":" << participant.second << ";";
+    }
+    os << "}}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
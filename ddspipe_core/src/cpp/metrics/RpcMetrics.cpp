@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RpcMetrics.cpp
+ *
+ */
+
+#include <ddspipe_core/metrics/RpcMetrics.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+void RpcMetrics::record_reply(
+        const RpcRequestTimestamps& request,
+        int64_t reply_received_ns,
+        int64_t reply_sent_ns) noexcept
+{
+    if (request.sent_ns <= 0 || reply_received_ns < request.sent_ns)
+    {
+        return;
+    }
+
+    server_round_trip_.record(static_cast<uint64_t>(reply_received_ns - request.sent_ns));
+
+    if (request.received_ns > 0 && request.sent_ns >= request.received_ns && reply_sent_ns >= reply_received_ns)
+    {
+        bridge_latency_.record(static_cast<uint64_t>(
+                    (request.sent_ns - request.received_ns) + (reply_sent_ns - reply_received_ns)));
+    }
+}
+
+RpcMetricsSnapshot RpcMetrics::snapshot() const
+{
+    RpcMetricsSnapshot result;
+    result.bridge_latency = bridge_latency_.snapshot();
+    result.server_round_trip = server_round_trip_.snapshot();
+    return result;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const RpcMetricsSnapshot& metrics)
+{
+    os << "RpcMetrics{" << metrics.service
+       << ";bridge_latency(" << metrics.bridge_latency << ");server_round_trip(" << metrics.server_round_trip << ")"
+       << ";timeouts(" << metrics.timeouts << ")";
+
+    for (const auto& registry_it : metrics.registries)
+    {
+        os << ";registry(" << registry_it.first << ";" << registry_it.second << ")";
+    }
+
+    os << "}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,38 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadPoolMetrics.cpp
+ *
+ */
+
+#include <ddspipe_core/metrics/ThreadPoolMetrics.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const PriorityClassMetricsSnapshot& metrics)
+{
+    os << "PriorityClassMetrics{" << metrics.priority
+       << ";executed(" << metrics.executed << ");starvation_promotions(" << metrics.starvation_promotions
+       << ");queue_depth(" << metrics.queue_depth << ");queueing_delay(" << metrics.queueing_delay << ")}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -0,0 +1,123 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TrackMetrics.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <ddspipe_core/metrics/TrackMetrics.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+using namespace eprosima::ddspipe::core::types;
+
+void TrackMetrics::add_writer(
+        const ParticipantId& id)
+{
+    if (writers_.find(id) == writers_.end())
+    {
+        writers_[id] = std::unique_ptr<WriterCounters>(new WriterCounters());
+    }
+}
+
+TrackMetrics::WriterCounters& TrackMetrics::writer(
+        const ParticipantId& id)
+{
+    return *writers_.at(id);
+}
+
+void TrackMetrics::taken(
+        uint64_t n) noexcept
+{
+    taken_.increment(n);
+}
+
+void TrackMetrics::record_latency(
+        const IRoutingData& data,
+        int64_t now_ns) noexcept
+{
+    const RtpsPayloadData* rtps_data = dynamic_cast<const RtpsPayloadData*>(&data);
+    if (rtps_data == nullptr)
+    {
+        return;
+    }
+
+    int64_t source_ns = rtps_data->source_timestamp.to_ns();
+    if (source_ns > 0 && now_ns >= source_ns)
+    {
+        source_latency_.record(static_cast<uint64_t>(now_ns - source_ns));
+    }
+
+    int64_t reception_ns = rtps_data->reception_timestamp.to_ns();
+    if (reception_ns > 0 && now_ns >= reception_ns)
+    {
+        pipe_latency_.record(static_cast<uint64_t>(now_ns - reception_ns));
+    }
+}
+
+TrackMetricsSnapshot TrackMetrics::snapshot() const
+{
+    TrackMetricsSnapshot result;
+
+    result.taken = taken_.load();
+
+    for (const auto& writer_it : writers_)
+    {
+        WriterMetricsSnapshot& writer = result.writers[writer_it.first];
+        writer.written = writer_it.second->written.load();
+        writer.write_errors = writer_it.second->write_errors.load();
+        writer.dropped = writer_it.second->dropped.load();
+    }
+
+    result.source_latency = source_latency_.snapshot();
+    result.pipe_latency = pipe_latency_.snapshot();
+
+    return result;
+}
+
+int64_t TrackMetrics::now_ns() noexcept
+{
+    // Fast DDS timestamps are taken from the system clock
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const TrackMetricsSnapshot& metrics)
+{
+    os << "TrackMetrics{" << metrics.topic << ";" << metrics.reader_participant_id
+       << ";taken(" << metrics.taken << ");rejected(" << metrics.rejected << ")"
+       << ";reader_history(" << metrics.reader_history << ")";
+
+    for (const auto& writer_it : metrics.writers)
+    {
+        os << ";writer(" << writer_it.first << ";" << writer_it.second.written << ";"
+           << writer_it.second.write_errors << ";" << writer_it.second.dropped << ";"
+           << writer_it.second.queue_depth << ";" << writer_it.second.history << ")";
+    }
+
+    os << ";source_latency(" << metrics.source_latency << ");pipe_latency(" << metrics.pipe_latency << ")}";
+    return os;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <ddspipe_core/efficiency/memory/ThreadLocalBlockPool.hpp>
 #include <ddspipe_core/types/data/RpcPayloadData.hpp>
 
 namespace eprosima {
@@ -24,6 +25,28 @@ types::TopicInternalTypeDiscriminator RpcPayloadData::internal_type_discriminato
     return INTERNAL_TOPIC_TYPE_RPC;
 }
 
+void* RpcPayloadData::operator new(
+        std::size_t size)
+{
+    if (size != sizeof(RpcPayloadData))
+    {
+        return ::operator new(size);
+    }
+    return ThreadLocalBlockPool<sizeof(RpcPayloadData)>::allocate();
+}
+
+void RpcPayloadData::operator delete(
+        void* ptr,
+        std::size_t size) noexcept
+{
+    if (size != sizeof(RpcPayloadData))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    ThreadLocalBlockPool<sizeof(RpcPayloadData)>::release(ptr);
+}
+
 } /* namespace types */
 } /* namespace core */
 } /* namespace ddspipe */
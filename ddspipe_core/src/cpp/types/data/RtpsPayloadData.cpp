@@ -14,6 +14,7 @@
 
 #include <cpp_utils/Log.hpp>
 
+#include <ddspipe_core/efficiency/memory/ThreadLocalBlockPool.hpp>
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
 
 namespace eprosima {
@@ -41,6 +42,29 @@ types::TopicInternalTypeDiscriminator RtpsPayloadData::internal_type_discriminat
     return INTERNAL_TOPIC_TYPE_RTPS;
 }
 
+void* RtpsPayloadData::operator new(
+        std::size_t size)
+{
+    // Subclasses that do not define their own allocation are allocated as usual
+    if (size != sizeof(RtpsPayloadData))
+    {
+        return ::operator new(size);
+    }
+    return ThreadLocalBlockPool<sizeof(RtpsPayloadData)>::allocate();
+}
+
+void RtpsPayloadData::operator delete(
+        void* ptr,
+        std::size_t size) noexcept
+{
+    if (size != sizeof(RtpsPayloadData))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    ThreadLocalBlockPool<sizeof(RtpsPayloadData)>::release(ptr);
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const RtpsPayloadData& data)
@@ -72,6 +72,41 @@ bool SpecificEndpointQoS::operator == (
     return this->partitions == other.partitions && this->ownership_strength == other.ownership_strength;
 }
 
+std::size_t SpecificEndpointQoS::hash() const noexcept
+{
+    // FNV-1a over the ownership strength and the names of the partitions
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    uint64_t result = FNV_OFFSET_BASIS;
+    auto add_byte = [&result](
+        unsigned char byte)
+            {
+                result ^= byte;
+                result *= FNV_PRIME;
+            };
+
+    const uint32_t strength = this->ownership_strength.value;
+    for (unsigned int i = 0; i < sizeof(strength); ++i)
+    {
+        add_byte(static_cast<unsigned char>(strength >> (8 * i)));
+    }
+
+    // Iterate the partitions in place, as getNames copies every name
+    for (auto const& partition : this->partitions)
+    {
+        for (const char* c = partition.name(); *c != '\0'; ++c)
+        {
+            add_byte(static_cast<unsigned char>(*c));
+        }
+        // Separator, so {"ab"} and {"a", "b"} differ
+        add_byte(0);
+    }
+
+    std::size_t hash = static_cast<std::size_t>(result);
+    return hash != 0 ? hash : 1;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const PartitionQosPolicy& qos)
@@ -28,6 +28,12 @@ namespace types {
 std::atomic<HistoryDepthType> TopicQoS::default_history_depth{HISTORY_DEPTH_DEFAULT};
 std::atomic<unsigned int> TopicQoS::default_downsampling{1};
 std::atomic<float> TopicQoS::default_max_reception_rate{0};
+std::atomic<unsigned int> TopicQoS::default_fanout_queue_size{0};
+std::atomic<unsigned int> TopicQoS::default_priority{0};
+std::atomic<bool> TopicQoS::default_adaptive_history{false};
+std::atomic<uint64_t> TopicQoS::default_memory_budget{0};
+
+constexpr HistoryDepthType TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES;
 
 TopicQoS::TopicQoS()
 {
@@ -37,6 +43,14 @@ TopicQoS::TopicQoS()
     downsampling = default_downsampling;
     // Set max reception rate by default
     max_reception_rate = default_max_reception_rate;
+    // Set fan-out queue size by default
+    fanout_queue_size = default_fanout_queue_size;
+    // Set priority by default
+    priority = default_priority;
+    // Set adaptive history by default
+    adaptive_history = default_adaptive_history;
+    // Set memory budget by default
+    memory_budget = default_memory_budget;
 }
 
 bool TopicQoS::operator ==(
@@ -50,7 +64,12 @@ bool TopicQoS::operator ==(
         this->use_partitions == other.use_partitions &&
         this->keyed == other.keyed &&
         this->downsampling == other.downsampling &&
-        this->max_reception_rate == other.max_reception_rate;
+        this->max_reception_rate == other.max_reception_rate &&
+        this->batch_size == other.batch_size &&
+        this->fanout_queue_size == other.fanout_queue_size &&
+        this->priority == other.priority &&
+        this->adaptive_history == other.adaptive_history &&
+        this->memory_budget == other.memory_budget;
 }
 
 bool TopicQoS::is_reliable() const noexcept
@@ -160,6 +179,11 @@ std::ostream& operator <<(
         ";depth(" << qos.history_depth << ")" <<
         ";downsampling(" << qos.downsampling << ")" <<
         ";max_reception_rate(" << qos.max_reception_rate << ")" <<
+        ";batch_size(" << qos.batch_size << ")" <<
+        ";fanout_queue_size(" << qos.fanout_queue_size << ")" <<
+        ";priority(" << qos.priority << ")" <<
+        (qos.adaptive_history ? ";adaptive_history" : "") <<
+        ";memory_budget(" << qos.memory_budget << ")" <<
         "}";
 
     return os;
@@ -16,17 +16,28 @@
  * @file schema.cpp
  */
 
-#include <ostream>
 #include <map>
-
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
 #include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
 #include <fastrtps/types/DynamicTypeMember.h>
 #include <fastrtps/types/DynamicTypePtr.h>
 #include <fastrtps/types/TypeDescriptor.h>
+#include <fastrtps/types/TypeObject.h>
+#include <fastrtps/utils/md5.h>
 
 #include <cpp_utils/exception/InconsistencyException.hpp>
 #include <cpp_utils/exception/UnsupportedException.hpp>
-#include <cpp_utils/types/Tree.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <ddspipe_core/types/dynamic_types/schema.hpp>
@@ -45,23 +56,6 @@ constexpr const char* TYPE_CLOSURE =
 constexpr const char* TAB_SEPARATOR =
         "    ";
 
-struct TreeNodeType
-{
-    TreeNodeType(
-            std::string member_name,
-            std::string type_kind_name,
-            fastrtps::types::DynamicType_ptr dynamic_type)
-        : member_name(member_name)
-        , type_kind_name(type_kind_name)
-        , dynamic_type(dynamic_type)
-    {
-    }
-
-    std::string member_name;
-    std::string type_kind_name;
-    fastrtps::types::DynamicType_ptr dynamic_type;
-};
-
 // Forward declaration
 std::string type_kind_to_str(
         const fastrtps::types::DynamicType_ptr& type);
@@ -235,74 +229,119 @@ std::string type_kind_to_str(
     }
 }
 
-utils::TreeNode<TreeNodeType> generate_dyn_type_tree(
-        const fastrtps::types::DynamicType_ptr& type,
-        const std::string& member_name = "PARENT")
+/**
+ * IDL definition of a single "writable" type (i.e. struct, enum or union).
+ *
+ * Structs also hold the fragments of every type they depend on, deepest dependencies first and without
+ * repetitions, so the schema of a type is composed by concatenation instead of walking its members again.
+ */
+struct SchemaFragment
+{
+    std::string name;
+    std::string definition;
+    std::vector<std::shared_ptr<const SchemaFragment>> dependencies;
+};
+
+using SchemaFragmentPtr = std::shared_ptr<const SchemaFragment>;
+
+/**
+ * Fragments shared by every schema generated in the process.
+ *
+ * Keyed by type name and hash of the TypeObject built from its DynamicType, so a type defined again with the same
+ * name never reuses a stale fragment.
+ */
+struct SchemaFragmentCache
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, SchemaFragmentPtr> fragments;
+};
+
+SchemaFragmentCache& schema_fragment_cache()
+{
+    static SchemaFragmentCache cache;
+    return cache;
+}
+
+bool schema_fragment_key(
+        const fastrtps::types::DynamicType_ptr& dyn_type,
+        std::string& key)
 {
-    // Get kind
-    fastrtps::types::TypeKind kind = type->get_kind();
+    // The TypeObject is built from dyn_type itself (force), as the one registered with its name could belong to a
+    // previous definition
+    fastrtps::types::TypeObject object;
+    fastrtps::types::DynamicTypeBuilderFactory::get_instance()->build_type_object(dyn_type, object, true, true);
 
-    switch (kind)
+    if (object._d() != fastrtps::types::EK_COMPLETE)
     {
-        case fastrtps::types::TK_STRUCTURE:
-        {
-            // If is struct, the call is recursive.
-            // Create new tree node
-            utils::TreeNode<TreeNodeType> parent(member_name, type->get_name(), type);
+        return false;
+    }
 
-            // Get all members of this struct
-            std::vector<std::pair<std::string,
-                    fastrtps::types::DynamicType_ptr>> members_by_name = get_members_sorted(type);
+    // MD5 of the serialized TypeObject, as the equivalence hashes of Fast DDS
+    eprosima::fastcdr::FastBuffer fast_buffer;
+    eprosima::fastcdr::Cdr cdr(fast_buffer, eprosima::fastcdr::Cdr::LITTLE_ENDIANNESS,
+            eprosima::fastcdr::Cdr::DDS_CDR);
+    object.serialize(cdr);
 
-            for (const auto& member : members_by_name)
-            {
-                // Add each member with its name as a new node in a branch (recursion)
-                parent.add_branch(
-                    generate_dyn_type_tree(member.second, member.first));
-            }
-            return parent;
-        }
-        break;
+    fastrtps::MD5 object_hash;
+    object_hash.update(fast_buffer.getBuffer(), static_cast<unsigned int>(cdr.getSerializedDataLength()));
+    object_hash.finalize();
 
-        case fastrtps::types::TK_ARRAY:
-        case fastrtps::types::TK_SEQUENCE:
-        {
-            // If container (array or struct) has exactly one branch
-            // Calculate child branch
-            auto internal_type = container_internal_type(type);
+    key = dyn_type->get_name();
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(object_hash.digest), sizeof(object_hash.digest));
 
-            // Create this node
-            utils::TreeNode<TreeNodeType> container(member_name, type_kind_to_str(type), type);
-            // Add branch
-            container.add_branch(generate_dyn_type_tree(internal_type, "CONTAINER_MEMBER"));
+    return true;
+}
 
-            return container;
-        }
-        break;
+/**
+ * Get the type that must be written for a member of type \c dyn_type, skipping arrays and sequences.
+ *
+ * @return whether the member depends on a struct, enum or union.
+ */
+bool writable_type(
+        const fastrtps::types::DynamicType_ptr& dyn_type,
+        fastrtps::types::DynamicType_ptr& result)
+{
+    fastrtps::types::DynamicType_ptr type = dyn_type;
+
+    while (type->get_kind() == fastrtps::types::TK_ARRAY || type->get_kind() == fastrtps::types::TK_SEQUENCE)
+    {
+        type = container_internal_type(type);
+    }
+
+    switch (type->get_kind())
+    {
+        case fastrtps::types::TK_STRUCTURE:
+        case fastrtps::types::TK_ENUM:
+        case fastrtps::types::TK_UNION:
+            result = type;
+            return true;
 
         default:
-            return utils::TreeNode<TreeNodeType>(member_name, type_kind_to_str(type), type);
-            break;
+            return false;
     }
 }
 
-std::ostream& node_to_str(
+std::ostream& member_to_str(
         std::ostream& os,
-        const utils::TreeNode<TreeNodeType>& node)
+        const std::string& member_name,
+        const fastrtps::types::DynamicType_ptr& member_type)
 {
     os << TAB_SEPARATOR;
 
-    if (node.info.dynamic_type->get_kind() == fastrtps::types::TK_ARRAY)
+    std::string type_kind_name = type_kind_to_str(member_type);
+
+    if (member_type->get_kind() == fastrtps::types::TK_ARRAY)
     {
-        auto dim_pos = node.info.type_kind_name.find("[");
-        auto kind_name_str = node.info.type_kind_name.substr(0, dim_pos);
-        auto dim_str = node.info.type_kind_name.substr(dim_pos, std::string::npos);
+        auto dim_pos = type_kind_name.find("[");
+        auto kind_name_str = type_kind_name.substr(0, dim_pos);
+        auto dim_str = type_kind_name.substr(dim_pos, std::string::npos);
 
-        os << kind_name_str << " " << node.info.member_name << dim_str;
+        os << kind_name_str << " " << member_name << dim_str;
     }
     else
     {
-        os << node.info.type_kind_name << " " << node.info.member_name;
+        os << type_kind_name << " " << member_name;
     }
 
     return os;
@@ -310,15 +349,15 @@ std::ostream& node_to_str(
 
 std::ostream& struct_to_str(
         std::ostream& os,
-        const utils::TreeNode<TreeNodeType>& node)
+        const fastrtps::types::DynamicType_ptr& dyn_type)
 {
     // Add types name
-    os << "struct " << node.info.type_kind_name << TYPE_OPENING;
+    os << "struct " << dyn_type->get_name() << TYPE_OPENING;
 
     // Add struct attributes
-    for (auto const& child : node.branches())
+    for (auto const& member : get_members_sorted(dyn_type))
     {
-        node_to_str(os, child.info);
+        member_to_str(os, member.first, member.second);
         os << ";\n";
     }
 
@@ -330,12 +369,12 @@ std::ostream& struct_to_str(
 
 std::ostream& enum_to_str(
         std::ostream& os,
-        const utils::TreeNode<TreeNodeType>& node)
+        const fastrtps::types::DynamicType_ptr& dyn_type)
 {
-    os << "enum " << node.info.type_kind_name << TYPE_OPENING << TAB_SEPARATOR;
+    os << "enum " << dyn_type->get_name() << TYPE_OPENING << TAB_SEPARATOR;
 
     std::map<fastrtps::types::MemberId, fastrtps::types::DynamicTypeMember*> members;
-    node.info.dynamic_type->get_all_members(members);
+    dyn_type->get_all_members(members);
     bool first_iter = true;
     for (const auto& member : members)
     {
@@ -356,13 +395,13 @@ std::ostream& enum_to_str(
 
 std::ostream& union_to_str(
         std::ostream& os,
-        const utils::TreeNode<TreeNodeType>& node)
+        const fastrtps::types::DynamicType_ptr& dyn_type)
 {
-    os << "union " << node.info.type_kind_name << " switch (" << type_kind_to_str(
-        node.info.dynamic_type->get_descriptor()->get_discriminator_type()) << ")" << TYPE_OPENING;
+    os << "union " << dyn_type->get_name() << " switch (" << type_kind_to_str(
+        dyn_type->get_descriptor()->get_discriminator_type()) << ")" << TYPE_OPENING;
 
     std::map<fastrtps::types::MemberId, fastrtps::types::DynamicTypeMember*> members;
-    node.info.dynamic_type->get_all_members(members);  // WARNING: Default case not included in this collection, and currently not available
+    dyn_type->get_all_members(members);  // WARNING: Default case not included in this collection, and currently not available
     for (const auto& member : members)
     {
         auto labels = member.second->get_union_labels();  // WARNING: There might be casting issues as discriminant type is currently not taken into consideration
@@ -391,58 +430,140 @@ std::ostream& union_to_str(
     return os;
 }
 
-std::string generate_dyn_type_schema_from_tree(
-        const utils::TreeNode<TreeNodeType>& parent_node)
+/**
+ * Get the fragment of \c dyn_type, generating it (and the ones of its dependencies) if not cached yet.
+ *
+ * @param fragments_in_use fragments already resolved for the schema being generated, by type name.
+ */
+SchemaFragmentPtr schema_fragment(
+        const fastrtps::types::DynamicType_ptr& dyn_type,
+        std::map<std::string, SchemaFragmentPtr>& fragments_in_use)
 {
-    std::set<std::string> types_written;
+    const std::string name = dyn_type->get_name();
 
-    std::stringstream ss;
+    auto it = fragments_in_use.find(name);
+    if (it != fragments_in_use.end())
+    {
+        return it->second;
+    }
+
+    SchemaFragmentCache& cache = schema_fragment_cache();
+    std::string key;
+    const bool cacheable = schema_fragment_key(dyn_type, key);
 
-    // For every Node, check if it is of a "writable" type (i.e. struct, enum or union).
-    // If it is, check if it is not yet written
-    // If it is not, write it down
-    for (const auto& node : parent_node.all_nodes())
+    if (cacheable)
     {
-        auto kind = node.info.dynamic_type->get_kind();
-        if (types_written.find(node.info.type_kind_name) == types_written.end())
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        auto cached = cache.fragments.find(key);
+        if (cached != cache.fragments.end())
         {
-            switch (kind)
-            {
-                case fastrtps::types::TK_STRUCTURE:
-                    struct_to_str(ss, node);
-                    break;
+            fragments_in_use[name] = cached->second;
+            return cached->second;
+        }
+    }
 
-                case fastrtps::types::TK_ENUM:
-                    enum_to_str(ss, node);
-                    break;
+    auto fragment = std::make_shared<SchemaFragment>();
+    fragment->name = name;
 
-                case fastrtps::types::TK_UNION:
-                    union_to_str(ss, node);
-                    break;
+    std::stringstream ss;
+    switch (dyn_type->get_kind())
+    {
+        case fastrtps::types::TK_ENUM:
+            enum_to_str(ss, dyn_type);
+            break;
 
-                default:
+        case fastrtps::types::TK_UNION:
+            union_to_str(ss, dyn_type);
+            break;
+
+        case fastrtps::types::TK_STRUCTURE:
+        {
+            // Every member adds its own dependencies followed by itself, skipping types already added
+            std::set<std::string> types_written;
+
+            auto add_dependency = [&](const SchemaFragmentPtr& dependency)
+                    {
+                        if (types_written.insert(dependency->name).second)
+                        {
+                            fragment->dependencies.push_back(dependency);
+                        }
+                    };
+
+            for (const auto& member : get_members_sorted(dyn_type))
+            {
+                fastrtps::types::DynamicType_ptr member_type;
+                if (!writable_type(member.second, member_type))
+                {
                     continue;
+                }
+
+                SchemaFragmentPtr member_fragment = schema_fragment(member_type, fragments_in_use);
+
+                for (const auto& dependency : member_fragment->dependencies)
+                {
+                    add_dependency(dependency);
+                }
+                add_dependency(member_fragment);
             }
-            ss << "\n"; // Introduce blank line between type definitions
-            types_written.insert(node.info.type_kind_name);
+
+            struct_to_str(ss, dyn_type);
         }
+        break;
+
+        default:
+            struct_to_str(ss, dyn_type);
+            break;
     }
+    fragment->definition = ss.str();
 
-    // Write struct parent node at last, after all its dependencies
-    // NOTE: not a requirement for Foxglove IDL Parser, dependencies can be placed after parent
-    struct_to_str(ss, parent_node);
+    SchemaFragmentPtr result = fragment;
 
-    return ss.str();
+    if (cacheable)
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+
+        // Another thread may have generated the same fragment meanwhile
+        result = cache.fragments.emplace(key, fragment).first->second;
+    }
+
+    fragments_in_use[name] = result;
+
+    return result;
 }
 
 std::string generate_idl_schema(
         const fastrtps::types::DynamicType_ptr& dynamic_type)
 {
-    // Generate type tree
-    utils::TreeNode<TreeNodeType> parent_type = generate_dyn_type_tree(dynamic_type);
+    std::map<std::string, SchemaFragmentPtr> fragments_in_use;
+    SchemaFragmentPtr parent_fragment = schema_fragment(dynamic_type, fragments_in_use);
+
+    std::size_t schema_size = parent_fragment->definition.size();
+    for (const auto& dependency : parent_fragment->dependencies)
+    {
+        schema_size += dependency->definition.size() + 1;
+    }
+
+    std::string schema;
+    schema.reserve(schema_size);
+
+    // Write every dependency before the parent struct, with a blank line between type definitions
+    // NOTE: not a requirement for Foxglove IDL Parser, dependencies can be placed after parent
+    for (const auto& dependency : parent_fragment->dependencies)
+    {
+        schema += dependency->definition;
+        schema += "\n";
+    }
+    schema += parent_fragment->definition;
 
-    // From tree, generate string
-    return generate_dyn_type_schema_from_tree(parent_type);
+    return schema;
+}
+
+void clear_idl_schema_cache()
+{
+    SchemaFragmentCache& cache = schema_fragment_cache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.fragments.clear();
 }
 
 } /* namespace types */
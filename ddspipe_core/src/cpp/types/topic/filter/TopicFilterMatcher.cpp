@@ -0,0 +1,298 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicFilterMatcher.cpp
+ *
+ */
+
+#include <cpp_utils/types/cast.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/TopicFilterMatcher.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace types {
+
+TopicFilterMatcher::TopicFilterMatcher(
+        const std::set<utils::Heritable<IFilterTopic>>& filters)
+{
+    for (const auto& filter : filters)
+    {
+        if (!filter.can_cast<WildcardDdsFilterTopic>())
+        {
+            uncompiled_filters_.push_back(filter);
+            any_topic_name_prefix_ = true;
+            continue;
+        }
+
+        const auto& wildcard_filter = filter.dyn_cast<WildcardDdsFilterTopic>();
+
+        bool topic_name_set = wildcard_filter.topic_name.is_set();
+        bool type_name_set = wildcard_filter.type_name.is_set();
+
+#if defined(_WIN32)
+        // Topic names are matched case insensitively, so they are not sorted by the prefixes of the patterns
+        any_topic_name_prefix_ = true;
+#else
+        if (topic_name_set)
+        {
+            const std::string& pattern = wildcard_filter.topic_name.get_reference();
+            std::string prefix = pattern.substr(0, pattern.find_first_of("*?[\\"));
+
+            any_topic_name_prefix_ = any_topic_name_prefix_ || prefix.empty();
+            topic_name_prefixes_.insert(std::move(prefix));
+        }
+        else
+        {
+            any_topic_name_prefix_ = true;
+        }
+#endif // if defined(_WIN32)
+
+        if ((topic_name_set && !GlobAutomaton::is_compilable(wildcard_filter.topic_name.get_reference())) ||
+                (type_name_set && !GlobAutomaton::is_compilable(wildcard_filter.type_name.get_reference())))
+        {
+            uncompiled_filters_.push_back(filter);
+            continue;
+        }
+
+        std::size_t filter_index = n_filters_++;
+
+        any_topic_name_.push_back(!topic_name_set);
+        if (topic_name_set)
+        {
+            topic_names_.add(wildcard_filter.topic_name.get_reference(), filter_index);
+        }
+
+        any_type_name_.push_back(!type_name_set);
+        if (type_name_set)
+        {
+            type_names_.add(wildcard_filter.type_name.get_reference(), filter_index);
+        }
+    }
+}
+
+bool TopicFilterMatcher::empty() const noexcept
+{
+    return n_filters_ == 0 && uncompiled_filters_.empty();
+}
+
+bool TopicFilterMatcher::matches(
+        const ITopic& topic) const noexcept
+{
+    if (n_filters_ > 0 && utils::can_cast<DdsTopic>(topic))
+    {
+        const DdsTopic& dds_topic = dynamic_cast<const DdsTopic&>(topic);
+
+        std::vector<bool> topic_name_matched(any_topic_name_);
+        topic_names_.match(dds_topic.topic_name(), topic_name_matched);
+
+        std::vector<bool> type_name_matched(any_type_name_);
+        type_names_.match(dds_topic.type_name, type_name_matched);
+
+        for (std::size_t i = 0; i < n_filters_; i++)
+        {
+            if (topic_name_matched[i] && type_name_matched[i])
+            {
+                return true;
+            }
+        }
+    }
+
+    for (const auto& filter : uncompiled_filters_)
+    {
+        if (filter->matches(topic))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool TopicFilterMatcher::topic_name_prefixes(
+        std::set<std::string>& prefixes) const noexcept
+{
+    if (any_topic_name_prefix_)
+    {
+        return false;
+    }
+
+    // Prefixes are sorted, so the ones that start with another prefix come right after it
+    const std::string* last_prefix = nullptr;
+
+    for (const auto& prefix : topic_name_prefixes_)
+    {
+        if (last_prefix == nullptr || prefix.compare(0, last_prefix->size(), *last_prefix) != 0)
+        {
+            prefixes.insert(prefix);
+            last_prefix = &prefix;
+        }
+    }
+
+    return true;
+}
+
+void TopicFilterMatcher::GlobAutomaton::add(
+        const std::string& pattern,
+        std::size_t filter_index)
+{
+    if (pattern.find_first_of("*?") == std::string::npos)
+    {
+        literals_[pattern].push_back(filter_index);
+        return;
+    }
+
+    initial_states_.push_back(transitions_.size());
+
+    for (char c : pattern)
+    {
+        switch (c)
+        {
+            case '*':
+                transitions_.push_back(Transition::star);
+                break;
+
+            case '?':
+                transitions_.push_back(Transition::any);
+                break;
+
+            default:
+                transitions_.push_back(Transition::literal);
+                break;
+        }
+        characters_.push_back(c);
+        filters_.push_back(filter_index);
+    }
+
+    transitions_.push_back(Transition::accept);
+    characters_.push_back('\0');
+    filters_.push_back(filter_index);
+}
+
+void TopicFilterMatcher::GlobAutomaton::match(
+        const std::string& value,
+        std::vector<bool>& matched) const noexcept
+{
+    auto it = literals_.find(value);
+    if (it != literals_.end())
+    {
+        for (std::size_t filter_index : it->second)
+        {
+            matched[filter_index] = true;
+        }
+    }
+
+    if (initial_states_.empty())
+    {
+        return;
+    }
+
+    // Step in which each state was last added, so each one is added once per step
+    std::vector<std::size_t> visited(transitions_.size(), 0);
+    std::size_t step = 1;
+
+    std::vector<std::size_t> current;
+    std::vector<std::size_t> next;
+
+    for (std::size_t state : initial_states_)
+    {
+        add_with_closure_(state, current, visited, step);
+    }
+
+    for (char c : value)
+    {
+        step++;
+        next.clear();
+
+        for (std::size_t state : current)
+        {
+            switch (transitions_[state])
+            {
+                case Transition::star:
+                    add_with_closure_(state, next, visited, step);
+                    break;
+
+                case Transition::any:
+                    add_with_closure_(state + 1, next, visited, step);
+                    break;
+
+                case Transition::literal:
+                    if (characters_[state] == c)
+                    {
+                        add_with_closure_(state + 1, next, visited, step);
+                    }
+                    break;
+
+                case Transition::accept:
+                    break;
+            }
+        }
+
+        std::swap(current, next);
+
+        if (current.empty())
+        {
+            return;
+        }
+    }
+
+    for (std::size_t state : current)
+    {
+        if (transitions_[state] == Transition::accept)
+        {
+            matched[filters_[state]] = true;
+        }
+    }
+}
+
+bool TopicFilterMatcher::GlobAutomaton::is_compilable(
+        const std::string& pattern) noexcept
+{
+#if defined(_WIN32)
+    // utils::match_pattern is case insensitive in Windows (PathMatchSpecA), so every pattern is checked with it
+    static_cast<void>(pattern);
+    return false;
+#else
+    return pattern.find_first_of("[\\") == std::string::npos;
+#endif // if defined(_WIN32)
+}
+
+void TopicFilterMatcher::GlobAutomaton::add_with_closure_(
+        std::size_t state,
+        std::vector<std::size_t>& states,
+        std::vector<std::size_t>& visited,
+        std::size_t step) const noexcept
+{
+    // A star can also be skipped without consuming characters
+    while (visited[state] != step)
+    {
+        visited[state] = step;
+        states.push_back(state);
+
+        if (transitions_[state] != Transition::star)
+        {
+            break;
+        }
+        state++;
+    }
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
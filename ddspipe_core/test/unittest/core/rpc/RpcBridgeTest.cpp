@@ -0,0 +1,487 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/rpc/RpcBridge.hpp>
+#include <ddspipe_core/dynamic/ParticipantsDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/WorkStealingThreadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/data/RpcPayloadData.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 3;
+constexpr const unsigned int N_REQUESTS = 10;
+constexpr const std::chrono::seconds TIMEOUT(5);
+
+const ParticipantId CLIENT_ID("client");
+const ParticipantId SLOW_SERVER_ID("slow_server");
+const ParticipantId FAST_SERVER_ID("fast_server");
+
+RpcTopic rpc_topic()
+{
+    DdsTopic request_topic;
+    request_topic.m_topic_name = "rq/ServiceRequest";
+    request_topic.type_name = "Service_Request_";
+    return RpcTopic(request_topic);
+}
+
+//! Guid different for every call
+Guid new_guid()
+{
+    static unsigned int n_guids = 0;
+
+    Guid guid;
+    guid.guidPrefix.value[0] = static_cast<fastrtps::rtps::octet>(++n_guids);
+    guid.entityId.value[3] = 1;
+    return guid;
+}
+
+//! Reader of a service topic whose samples are simulated by the test
+class RpcMockReader : public IReader
+{
+public:
+
+    RpcMockReader(
+            const ParticipantId& participant_id,
+            const DdsTopic& topic)
+        : participant_id_(participant_id)
+        , topic_(topic)
+        , guid_(new_guid())
+    {
+    }
+
+    //! Add \c data to the samples to take and notify it, as an RTPS Reader does
+    void simulate_data_reception(
+            std::unique_ptr<RpcPayloadData>&& data)
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(rtps_mutex_);
+        data_.push(std::move(data));
+
+        if (on_data_available_)
+        {
+            on_data_available_();
+        }
+    }
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(rtps_mutex_);
+        on_data_available_ = on_data_available_lambda;
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(rtps_mutex_);
+        on_data_available_ = nullptr;
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<IRoutingData>& data) noexcept override
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(rtps_mutex_);
+
+        if (data_.empty())
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        data = std::move(data_.front());
+        data_.pop();
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    utils::ReturnCode take_batch(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<IRoutingData>>& data) noexcept override
+    {
+        std::unique_ptr<IRoutingData> sample;
+        while (data.size() < max_samples && take(sample))
+        {
+            data.push_back(std::move(sample));
+        }
+        return data.empty() ? utils::ReturnCode::RETCODE_NO_DATA : utils::ReturnCode::RETCODE_OK;
+    }
+
+    uint64_t rejected_samples() const noexcept override
+    {
+        return 0;
+    }
+
+    Guid guid() const override
+    {
+        return guid_;
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return rtps_mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(rtps_mutex_);
+        return data_.size();
+    }
+
+    DdsTopic topic() const override
+    {
+        return topic_;
+    }
+
+    ParticipantId participant_id() const override
+    {
+        return participant_id_;
+    }
+
+protected:
+
+    const ParticipantId participant_id_;
+    const DdsTopic topic_;
+    const Guid guid_;
+    std::queue<std::unique_ptr<RpcPayloadData>> data_;
+    std::function<void()> on_data_available_;
+    mutable fastrtps::RecursiveTimedMutex rtps_mutex_;
+};
+
+//! What a RpcMockWriter has written
+struct WrittenSample
+{
+    SequenceNumber sent_sequence_number;
+    SampleIdentity related_sample_identity;
+};
+
+//! Writer of a service topic that assigns a sequence number to each sample, as an RTPS Writer does
+class RpcMockWriter : public IWriter
+{
+public:
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    utils::ReturnCode write(
+            IRoutingData& data) noexcept override
+    {
+        RpcPayloadData& rpc_data = dynamic_cast<RpcPayloadData&>(data);
+
+        if (before_write)
+        {
+            before_write();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            rpc_data.sent_sequence_number = SequenceNumber(0, static_cast<uint32_t>(written_.size() + 1));
+            written_.push_back({rpc_data.sent_sequence_number,
+                                rpc_data.write_params.get_reference().related_sample_identity()});
+        }
+        written_cv_.notify_all();
+
+        if (after_write)
+        {
+            after_write(rpc_data.sent_sequence_number);
+        }
+
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    utils::ReturnCode write_batch(
+            const std::vector<std::unique_ptr<IRoutingData>>& data) noexcept override
+    {
+        for (const auto& sample : data)
+        {
+            write(*sample);
+        }
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    //! Wait until \c n_samples have been written, and return them (empty if they are not written on time)
+    std::vector<WrittenSample> wait_written(
+            std::size_t n_samples)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!written_cv_.wait_for(lock, TIMEOUT, [this, n_samples]()
+                {
+                    return written_.size() >= n_samples;
+                }))
+        {
+            return {};
+        }
+        return written_;
+    }
+
+    std::size_t n_written()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return written_.size();
+    }
+
+    //! Called in \c write before the sample is written
+    std::function<void()> before_write;
+
+    //! Called in \c write after the sample is written, with its sequence number
+    std::function<void(const SequenceNumber&)> after_write;
+
+protected:
+
+    std::vector<WrittenSample> written_;
+    std::mutex mutex_;
+    std::condition_variable written_cv_;
+};
+
+//! RTPS Participant that creates a mock Reader and Writer per service topic
+class RpcMockParticipant : public IParticipant
+{
+public:
+
+    RpcMockParticipant(
+            const ParticipantId& id)
+        : id_(id)
+    {
+    }
+
+    ParticipantId id() const noexcept override
+    {
+        return id_;
+    }
+
+    bool is_rtps_kind() const noexcept override
+    {
+        return true;
+    }
+
+    bool is_repeater() const noexcept override
+    {
+        return false;
+    }
+
+    std::shared_ptr<IWriter> create_writer(
+            const ITopic& topic) override
+    {
+        auto writer = std::make_shared<RpcMockWriter>();
+        writers_[topic.topic_name()] = writer;
+        return writer;
+    }
+
+    std::shared_ptr<IReader> create_reader(
+            const ITopic& topic) override
+    {
+        auto reader = std::make_shared<RpcMockReader>(id_, dynamic_cast<const DdsTopic&>(topic));
+        readers_[topic.topic_name()] = reader;
+        return reader;
+    }
+
+    std::map<std::string, std::shared_ptr<RpcMockWriter>> writers_;
+    std::map<std::string, std::shared_ptr<RpcMockReader>> readers_;
+
+protected:
+
+    const ParticipantId id_;
+};
+
+//! Sample of the service with a payload of \c pool
+std::unique_ptr<RpcPayloadData> new_sample(
+        PayloadPool& pool,
+        const SampleIdentity& sample_identity,
+        const ParticipantId& participant_receiver)
+{
+    std::unique_ptr<RpcPayloadData> data = std::make_unique<RpcPayloadData>();
+    pool.get_payload(4, data->payload);
+    data->payload.length = 4;
+    data->participant_receiver = participant_receiver;
+    data->origin_sequence_number = sample_identity.sequence_number();
+    data->write_params.set_level();
+    data->write_params.get_reference().sample_identity(sample_identity);
+    return data;
+}
+
+//! Identity of request \c index of the client
+SampleIdentity request_identity(
+        const Guid& client_guid,
+        unsigned int index)
+{
+    SampleIdentity identity;
+    identity.writer_guid(client_guid);
+    identity.sequence_number(SequenceNumber(0, index));
+    return identity;
+}
+
+} // test
+
+/**
+ * Forward requests to two servers, one of them blocked while writing, and check that the other one receives every
+ * request without waiting for it.
+ */
+TEST(RpcBridgeTest, slow_server_does_not_delay_others)
+{
+    auto pool = std::make_shared<FastPayloadPool>();
+    auto thread_pool = std::make_shared<WorkStealingThreadPool>(test::N_THREADS);
+    thread_pool->enable();
+
+    auto client = std::make_shared<test::RpcMockParticipant>(test::CLIENT_ID);
+    auto slow_server = std::make_shared<test::RpcMockParticipant>(test::SLOW_SERVER_ID);
+    auto fast_server = std::make_shared<test::RpcMockParticipant>(test::FAST_SERVER_ID);
+    auto participants = std::make_shared<ParticipantsDatabase>();
+    participants->add_participant(test::CLIENT_ID, client);
+    participants->add_participant(test::SLOW_SERVER_ID, slow_server);
+    participants->add_participant(test::FAST_SERVER_ID, fast_server);
+
+    RpcTopic topic = test::rpc_topic();
+    std::promise<void> release_slow_server;
+    std::shared_future<void> slow_server_released = release_slow_server.get_future().share();
+
+    {
+        RpcBridge bridge(topic, participants, pool, thread_pool);
+        bridge.discovered_service(test::SLOW_SERVER_ID, GuidPrefix());
+        bridge.discovered_service(test::FAST_SERVER_ID, GuidPrefix());
+        bridge.enable();
+
+        auto slow_writer = slow_server->writers_.at(topic.request_topic().topic_name());
+        auto fast_writer = fast_server->writers_.at(topic.request_topic().topic_name());
+        slow_writer->before_write = [slow_server_released]()
+                {
+                    slow_server_released.wait();
+                };
+
+        Guid client_guid = test::new_guid();
+        auto request_reader = client->readers_.at(topic.request_topic().topic_name());
+        for (unsigned int i = 1; i <= test::N_REQUESTS; i++)
+        {
+            request_reader->simulate_data_reception(
+                test::new_sample(*pool, test::request_identity(client_guid, i), test::CLIENT_ID));
+        }
+
+        // Every request reaches the fast server while the slow one is still writing the first one
+        std::vector<test::WrittenSample> fast_requests = fast_writer->wait_written(test::N_REQUESTS);
+        ASSERT_EQ(fast_requests.size(), test::N_REQUESTS);
+        ASSERT_EQ(slow_writer->n_written(), 0u);
+
+        for (unsigned int i = 0; i < test::N_REQUESTS; i++)
+        {
+            ASSERT_EQ(fast_requests[i].related_sample_identity.writer_guid(),
+                    fast_server->readers_.at(topic.reply_topic().topic_name())->guid());
+        }
+
+        release_slow_server.set_value();
+        ASSERT_EQ(slow_writer->wait_written(test::N_REQUESTS).size(), test::N_REQUESTS);
+    }
+
+    thread_pool->disable();
+}
+
+/**
+ * Receive the reply of a request while the request is still being written, before it is added to the registry,
+ * and check that the reply waits for it and is forwarded to the client.
+ */
+TEST(RpcBridgeTest, reply_before_request_added)
+{
+    auto pool = std::make_shared<FastPayloadPool>();
+    auto thread_pool = std::make_shared<WorkStealingThreadPool>(test::N_THREADS);
+    thread_pool->enable();
+
+    auto client = std::make_shared<test::RpcMockParticipant>(test::CLIENT_ID);
+    auto server = std::make_shared<test::RpcMockParticipant>(test::FAST_SERVER_ID);
+    auto participants = std::make_shared<ParticipantsDatabase>();
+    participants->add_participant(test::CLIENT_ID, client);
+    participants->add_participant(test::FAST_SERVER_ID, server);
+
+    RpcTopic topic = test::rpc_topic();
+
+    {
+        RpcBridge bridge(topic, participants, pool, thread_pool);
+        bridge.discovered_service(test::FAST_SERVER_ID, GuidPrefix());
+        bridge.enable();
+
+        // The server replies before the write of the request returns
+        auto reply_reader = server->readers_.at(topic.reply_topic().topic_name());
+        server->writers_.at(topic.request_topic().topic_name())->after_write =
+                [&pool, reply_reader](const SequenceNumber& sequence_number)
+                {
+                    SampleIdentity reply_identity;
+                    reply_identity.writer_guid(reply_reader->guid());
+                    reply_identity.sequence_number(sequence_number);
+                    reply_reader->simulate_data_reception(
+                        test::new_sample(*pool, reply_identity, test::FAST_SERVER_ID));
+
+                    // Give the reply time to be looked up in the registry before the request is added
+                    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                };
+
+        Guid client_guid = test::new_guid();
+        client->readers_.at(topic.request_topic().topic_name())->simulate_data_reception(
+            test::new_sample(*pool, test::request_identity(client_guid, 1), test::CLIENT_ID));
+
+        std::vector<test::WrittenSample> replies =
+                client->writers_.at(topic.reply_topic().topic_name())->wait_written(1);
+        ASSERT_EQ(replies.size(), 1u);
+        ASSERT_EQ(replies[0].related_sample_identity, test::request_identity(client_guid, 1));
+
+        // The request is erased from the registry right after its reply is written
+        auto deadline = std::chrono::steady_clock::now() + test::TIMEOUT;
+        while (bridge.registry_metrics().at(test::FAST_SERVER_ID).correlated_replies == 0 &&
+                std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        auto metrics = bridge.registry_metrics().at(test::FAST_SERVER_ID);
+        ASSERT_EQ(metrics.requests, 1u);
+        ASSERT_EQ(metrics.correlated_replies, 1u);
+        ASSERT_EQ(metrics.uncorrelated_replies, 0u);
+    }
+
+    thread_pool->disable();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,264 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/rpc/ServiceRegistry.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+const ParticipantId PARTICIPANT_ID("participant");
+const ParticipantId REQUESTER_ID("requester");
+
+RpcTopic rpc_topic()
+{
+    DdsTopic request_topic;
+    request_topic.m_topic_name = "rq/ServiceRequest";
+    request_topic.type_name = "Service_Request_";
+    return RpcTopic(request_topic);
+}
+
+SequenceNumber sequence_number(
+        uint32_t value)
+{
+    return SequenceNumber(0, value);
+}
+
+} // test
+
+/**
+ * Add requests, correlate their replies and check that they are no longer in the registry.
+ */
+TEST(ServiceRegistryTest, correlate_reply)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16);
+
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        registry.add(test::sequence_number(i), {test::REQUESTER_ID, SampleIdentity()});
+    }
+
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        auto entry = registry.get(test::sequence_number(i));
+        ASSERT_EQ(entry.first, test::REQUESTER_ID);
+        registry.erase(test::sequence_number(i));
+        ASSERT_TRUE(registry.get(test::sequence_number(i)).first.empty());
+    }
+
+    auto metrics = registry.metrics();
+    ASSERT_EQ(metrics.requests, 10u);
+    ASSERT_EQ(metrics.correlated_replies, 10u);
+    ASSERT_EQ(metrics.pending, 0u);
+}
+
+/**
+ * Look up a reply whose request has never been added, and one whose request has already been replied.
+ */
+TEST(ServiceRegistryTest, uncorrelated_reply)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16);
+
+    ASSERT_TRUE(registry.get(test::sequence_number(1)).first.empty());
+
+    registry.add(test::sequence_number(2), {test::REQUESTER_ID, SampleIdentity()});
+    registry.erase(test::sequence_number(2));
+    ASSERT_TRUE(registry.get(test::sequence_number(2)).first.empty());
+
+    // Same entry of the ring, different sequence number
+    registry.add(test::sequence_number(3), {test::REQUESTER_ID, SampleIdentity()});
+    ASSERT_TRUE(registry.get(test::sequence_number(3 + 16)).first.empty());
+
+    ASSERT_FALSE(registry.wait_pending_request(test::sequence_number(3 + 16)));
+}
+
+/**
+ * Add a request, wait longer than the expiry time and check that its reply is not correlated.
+ */
+TEST(ServiceRegistryTest, expire_request)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16, 10);
+
+    registry.add(test::sequence_number(1), {test::REQUESTER_ID, SampleIdentity()});
+    registry.add(test::sequence_number(2), {test::REQUESTER_ID, SampleIdentity()});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(registry.get(test::sequence_number(1)).first.empty());
+
+    // Expired request replaced by a new one in the same entry
+    registry.add(test::sequence_number(2 + 16), {test::REQUESTER_ID, SampleIdentity()});
+    ASSERT_EQ(registry.get(test::sequence_number(2 + 16)).first, test::REQUESTER_ID);
+
+    auto metrics = registry.metrics();
+    ASSERT_EQ(metrics.requests, 3u);
+    ASSERT_EQ(metrics.expired, 2u);
+    ASSERT_EQ(metrics.overwritten, 0u);
+    ASSERT_EQ(metrics.pending, 1u);
+}
+
+/**
+ * Add a request with the default expiry, wait and check that its reply is still correlated.
+ */
+TEST(ServiceRegistryTest, never_expire_request)
+{
+    ASSERT_EQ(ServiceRegistry::DEFAULT_EXPIRY_MS, 0u);
+
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16);
+
+    registry.add(test::sequence_number(1), {test::REQUESTER_ID, SampleIdentity()});
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ASSERT_EQ(registry.get(test::sequence_number(1)).first, test::REQUESTER_ID);
+
+    auto metrics = registry.metrics();
+    ASSERT_EQ(metrics.expired, 0u);
+    ASSERT_EQ(metrics.pending, 1u);
+}
+
+/**
+ * Add more requests than the capacity of the ring and check that the oldest ones are overwritten.
+ */
+TEST(ServiceRegistryTest, overwrite_request)
+{
+    // Capacity rounded up to 16
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 10);
+
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        registry.add(test::sequence_number(i), {test::REQUESTER_ID, SampleIdentity()});
+    }
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(registry.get(test::sequence_number(i)).first.empty());
+    }
+    for (uint32_t i = 4; i < 20; i++)
+    {
+        ASSERT_EQ(registry.get(test::sequence_number(i)).first, test::REQUESTER_ID);
+    }
+
+    auto metrics = registry.metrics();
+    ASSERT_EQ(metrics.requests, 20u);
+    ASSERT_EQ(metrics.overwritten, 4u);
+    ASSERT_EQ(metrics.pending, 16u);
+}
+
+/**
+ * Check that the times of a request are returned with it, and not once it has been replied.
+ */
+TEST(ServiceRegistryTest, request_timestamps)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16);
+
+    RpcRequestTimestamps timestamps;
+    timestamps.received_ns = 1000;
+    timestamps.sent_ns = 2000;
+    registry.add(test::sequence_number(1), {test::REQUESTER_ID, SampleIdentity()}, timestamps);
+
+    RpcRequestTimestamps result;
+    ASSERT_EQ(registry.get(test::sequence_number(1), result).first, test::REQUESTER_ID);
+    ASSERT_EQ(result.received_ns, 1000);
+    ASSERT_EQ(result.sent_ns, 2000);
+
+    registry.erase(test::sequence_number(1));
+
+    RpcRequestTimestamps after_erase;
+    ASSERT_TRUE(registry.get(test::sequence_number(1), after_erase).first.empty());
+    ASSERT_EQ(after_erase.sent_ns, 0);
+}
+
+/**
+ * Look up a reply while its request is being sent from another thread, and check that it is found after waiting.
+ */
+TEST(ServiceRegistryTest, wait_pending_request)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID);
+    std::atomic<bool> started(false);
+
+    registry.request_sending();
+
+    std::thread sender([&]()
+            {
+                while (!started)
+                {
+                    std::this_thread::yield();
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                registry.add(test::sequence_number(1), {test::REQUESTER_ID, SampleIdentity()});
+                registry.request_added();
+            });
+
+    ASSERT_TRUE(registry.get(test::sequence_number(1)).first.empty());
+    started = true;
+
+    ASSERT_TRUE(registry.wait_pending_request(test::sequence_number(1)));
+    ASSERT_EQ(registry.get(test::sequence_number(1)).first, test::REQUESTER_ID);
+
+    sender.join();
+    ASSERT_FALSE(registry.wait_pending_request(test::sequence_number(1)));
+}
+
+/**
+ * Look up replies of requests older than the last one added while another request is being sent, and check that
+ * they do not wait for it.
+ *
+ * CASES:
+ *  Reply of the last request added
+ *  Reply of a request already replied
+ *  Reply of the request being sent, once it is not sent
+ */
+TEST(ServiceRegistryTest, wait_only_newer_request)
+{
+    ServiceRegistry registry(test::rpc_topic(), test::PARTICIPANT_ID, 16);
+
+    registry.add(test::sequence_number(1), {test::REQUESTER_ID, SampleIdentity()});
+    registry.add(test::sequence_number(2), {test::REQUESTER_ID, SampleIdentity()});
+    registry.erase(test::sequence_number(1));
+
+    registry.request_sending();
+
+    // Reply of the last request added
+    ASSERT_FALSE(registry.wait_pending_request(test::sequence_number(2)));
+
+    // Reply of a request already replied
+    ASSERT_FALSE(registry.wait_pending_request(test::sequence_number(1)));
+
+    // Reply of the request being sent, once it is not sent
+    std::thread sender([&]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                registry.request_added();
+            });
+
+    ASSERT_TRUE(registry.wait_pending_request(test::sequence_number(3)));
+    ASSERT_TRUE(registry.get(test::sequence_number(3)).first.empty());
+
+    sender.join();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
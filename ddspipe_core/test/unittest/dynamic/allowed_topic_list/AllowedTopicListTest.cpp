@@ -12,6 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -504,6 +509,155 @@ TEST(AllowedTopicListTest, is_topic_allowed__complex_allowlist_and_blocklist_ent
         real_topics_negative);
 }
 
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case checking the same topics several times, so the later verdicts come from the cache,
+ * and after assigning other lists, so the cached verdicts are discarded
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__cached_verdicts)
+{
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+    test::add_topics_to_list(allowlist, {{"rt/*", "*"}});
+    test::add_topics_to_list(blocklist, {{"rt/blocked*", "*"}});
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    DdsTopic allowed_topic;
+    allowed_topic.m_topic_name = "rt/chatter";
+    allowed_topic.type_name = "std::string";
+
+    DdsTopic blocked_topic;
+    blocked_topic.m_topic_name = "rt/blocked_chatter";
+    blocked_topic.type_name = "std::string";
+
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(atl.is_topic_allowed(allowed_topic));
+        ASSERT_FALSE(atl.is_topic_allowed(blocked_topic));
+    }
+
+    // Swap the lists
+    atl = AllowedTopicList(blocklist, allowlist);
+
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ASSERT_FALSE(atl.is_topic_allowed(allowed_topic));
+        ASSERT_FALSE(atl.is_topic_allowed(blocked_topic));
+    }
+
+    // Remove the lists
+    atl.clear();
+
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(atl.is_topic_allowed(allowed_topic));
+        ASSERT_TRUE(atl.is_topic_allowed(blocked_topic));
+    }
+}
+
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case checking many topics from several threads at the same time
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__concurrent)
+{
+    constexpr const unsigned int N_THREADS = 4;
+    constexpr const unsigned int N_TOPICS = 200;
+
+    std::set<utils::Heritable<IFilterTopic>> allowlist;
+    std::set<utils::Heritable<IFilterTopic>> blocklist;
+    test::add_topics_to_list(allowlist, {{"topic_*", "type"}});
+    test::add_topics_to_list(blocklist, {{"topic_*0", "type"}});
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    std::vector<std::thread> threads;
+    std::atomic<unsigned int> errors(0);
+
+    for (unsigned int t = 0; t < N_THREADS; t++)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (unsigned int i = 0; i < N_TOPICS; i++)
+                    {
+                        DdsTopic topic;
+                        topic.m_topic_name = "topic_" + std::to_string(i);
+                        topic.type_name = "type";
+
+                        if (atl.is_topic_allowed(topic) != (i % 10 != 0))
+                        {
+                            errors++;
+                        }
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(errors, 0u);
+}
+
+/**
+ * Test \c AllowedTopicList \c changed_filters method
+ *
+ * Case with filters added to and removed from both lists: every topic whose verdict changes must match them,
+ * and a topic that does not match them must keep its verdict
+ */
+TEST(AllowedTopicListTest, changed_filters)
+{
+    std::set<utils::Heritable<IFilterTopic>> old_allowlist;
+    std::set<utils::Heritable<IFilterTopic>> old_blocklist;
+    test::add_topics_to_list(old_allowlist, {{"rt/*", "*"}, {"topic", "type"}});
+    test::add_topics_to_list(old_blocklist, {{"rt/blocked*", "*"}});
+
+    std::set<utils::Heritable<IFilterTopic>> new_allowlist;
+    std::set<utils::Heritable<IFilterTopic>> new_blocklist;
+    test::add_topics_to_list(new_allowlist, {{"rt/*", "*"}, {"other_topic", "type"}});
+    test::add_topics_to_list(new_blocklist, {{"rt/hidden*", "*"}});
+
+    AllowedTopicList old_atl(old_allowlist, old_blocklist);
+    AllowedTopicList new_atl(new_allowlist, new_blocklist);
+
+    TopicFilterMatcher changed;
+    ASSERT_TRUE(old_atl.changed_filters(new_atl, changed));
+
+    std::vector<pair_topic_type> topics = {
+        {"rt/chatter", "type"},
+        {"rt/blocked_chatter", "type"},
+        {"rt/hidden_chatter", "type"},
+        {"topic", "type"},
+        {"other_topic", "type"},
+        {"unknown", "type"},
+    };
+
+    std::vector<bool> expected_changed = {false, true, true, true, true, false};
+
+    for (std::size_t i = 0; i < topics.size(); i++)
+    {
+        DdsTopic topic;
+        topic.m_topic_name = topics[i].first;
+        topic.type_name = topics[i].second;
+
+        bool verdict_changed = old_atl.is_topic_allowed(topic) != new_atl.is_topic_allowed(topic);
+        ASSERT_EQ(verdict_changed, expected_changed[i]) << topic;
+        ASSERT_EQ(changed.matches(topic), expected_changed[i]) << topic;
+    }
+
+    // The same lists do not change any verdict
+    ASSERT_TRUE(new_atl.changed_filters(new_atl, changed));
+    ASSERT_TRUE(changed.empty());
+
+    // Removing the allowlist may change any verdict
+    AllowedTopicList only_blocklist_atl({}, new_blocklist);
+    ASSERT_FALSE(new_atl.changed_filters(only_blocklist_atl, changed));
+}
+
 int main(
         int argc,
         char** argv)
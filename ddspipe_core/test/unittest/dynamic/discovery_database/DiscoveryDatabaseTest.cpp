@@ -0,0 +1,293 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/testing/random_values.hpp>
+
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+using namespace eprosima::ddspipe::core::testing;
+
+namespace test {
+
+constexpr const unsigned int N_TOPICS = 5;
+constexpr const unsigned int N_PARTICIPANTS = 3;
+
+//! DiscoveryDatabase that performs the operations synchronously (without the queue processing thread)
+class DiscoveryDatabaseTestClass : public DiscoveryDatabase
+{
+public:
+
+    using DiscoveryDatabase::add_endpoint_;
+    using DiscoveryDatabase::update_endpoint_;
+    using DiscoveryDatabase::erase_endpoint_;
+    using DiscoveryDatabase::process_queue_;
+};
+
+//! Register a callback in \c database that stores every batch of changes
+void record_batches(
+        DiscoveryDatabase& database,
+        std::vector<std::vector<EndpointChange>>& batches)
+{
+    database.add_endpoints_changed_callback(
+        [&batches](const std::vector<EndpointChange>& changes)
+        {
+            batches.push_back(changes);
+        });
+}
+
+//! Endpoint with a unique guid from \c id in the given topic and participant
+Endpoint endpoint(
+        unsigned int id,
+        unsigned int topic,
+        unsigned int participant,
+        EndpointKind kind = EndpointKind::reader,
+        bool active = true)
+{
+    Endpoint endpoint;
+    endpoint.guid = random_guid(id);
+    endpoint.topic = random_dds_topic(topic);
+    endpoint.discoverer_participant_id = random_participant_id(participant);
+    endpoint.kind = kind;
+    endpoint.active = active;
+    return endpoint;
+}
+
+} // test
+
+/**
+ * Test \c count_endpoints and \c topic_exists by topic.
+ *
+ * CASES:
+ *  Topic without endpoints
+ *  Topics with several endpoints from different participants
+ */
+TEST(DiscoveryDatabaseTest, topic_index)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    ASSERT_FALSE(database.topic_exists(random_dds_topic(0)));
+    ASSERT_EQ(database.count_endpoints(random_dds_topic(0)), 0u);
+
+    // Topic i has i+1 endpoints
+    unsigned int id = 1;
+    for (unsigned int topic = 0; topic < test::N_TOPICS; topic++)
+    {
+        for (unsigned int i = 0; i <= topic; i++)
+        {
+            database.add_endpoint_(test::endpoint(id++, topic, i % test::N_PARTICIPANTS));
+        }
+    }
+
+    for (unsigned int topic = 0; topic < test::N_TOPICS; topic++)
+    {
+        ASSERT_TRUE(database.topic_exists(random_dds_topic(topic)));
+        ASSERT_EQ(database.count_endpoints(random_dds_topic(topic)), topic + 1);
+    }
+
+    ASSERT_FALSE(database.topic_exists(random_dds_topic(test::N_TOPICS)));
+}
+
+/**
+ * Test \c count_endpoints by discoverer participant.
+ */
+TEST(DiscoveryDatabaseTest, participant_index)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    unsigned int id = 1;
+    for (unsigned int topic = 0; topic < test::N_TOPICS; topic++)
+    {
+        for (unsigned int participant = 0; participant < test::N_PARTICIPANTS; participant++)
+        {
+            database.add_endpoint_(test::endpoint(id++, topic, participant));
+        }
+    }
+
+    for (unsigned int participant = 0; participant < test::N_PARTICIPANTS; participant++)
+    {
+        ASSERT_EQ(database.count_endpoints(random_participant_id(participant)), test::N_TOPICS);
+    }
+
+    ASSERT_EQ(database.count_endpoints(random_participant_id(test::N_PARTICIPANTS)), 0u);
+}
+
+/**
+ * Test \c count_active_endpoints and \c get_active_endpoint_guids .
+ *
+ * CASES:
+ *  Only active endpoints of the kind, topic and participant requested are counted
+ */
+TEST(DiscoveryDatabaseTest, active_index)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    database.add_endpoint_(test::endpoint(1, 0, 0, EndpointKind::reader));
+    database.add_endpoint_(test::endpoint(2, 0, 0, EndpointKind::reader));
+    database.add_endpoint_(test::endpoint(3, 0, 0, EndpointKind::reader, false));
+    database.add_endpoint_(test::endpoint(4, 0, 0, EndpointKind::writer));
+    database.add_endpoint_(test::endpoint(5, 0, 1, EndpointKind::reader));
+    database.add_endpoint_(test::endpoint(6, 1, 0, EndpointKind::reader));
+
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, random_dds_topic(0), random_participant_id(0)), 2u);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::writer, random_dds_topic(0), random_participant_id(0)), 1u);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, random_dds_topic(0), random_participant_id(1)), 1u);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::writer, random_dds_topic(1), random_participant_id(0)), 0u);
+
+    std::vector<Guid> expected = {random_guid(1), random_guid(2)};
+    ASSERT_EQ(
+        database.get_active_endpoint_guids(EndpointKind::reader, random_dds_topic(0), random_participant_id(0)),
+        expected);
+}
+
+/**
+ * Test that the indexes are kept updated when endpoints are updated and erased.
+ *
+ * CASES:
+ *  Endpoint becomes inactive
+ *  Inactive endpoint is added again
+ *  Endpoint is erased
+ */
+TEST(DiscoveryDatabaseTest, update_and_erase)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    Endpoint reader = test::endpoint(1, 0, 0);
+    database.add_endpoint_(reader);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, reader.topic, reader.discoverer_participant_id), 1u);
+
+    // Becomes inactive
+    reader.active = false;
+    database.update_endpoint_(reader);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, reader.topic, reader.discoverer_participant_id), 0u);
+    ASSERT_TRUE(database.topic_exists(reader.topic));
+
+    // Rediscovered
+    reader.active = true;
+    database.add_endpoint_(reader);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, reader.topic, reader.discoverer_participant_id), 1u);
+    ASSERT_EQ(database.count_endpoints(reader.topic), 1u);
+
+    // Erased (with a stale copy of the endpoint)
+    reader.active = false;
+    database.erase_endpoint_(reader);
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, reader.topic, reader.discoverer_participant_id), 0u);
+    ASSERT_FALSE(database.topic_exists(reader.topic));
+    ASSERT_EQ(database.count_endpoints(reader.discoverer_participant_id), 0u);
+}
+
+/**
+ * Test that the operations queued for an endpoint that does not exist are coalesced.
+ *
+ * CASES:
+ *  Added and updated: a single add with the last endpoint
+ *  Added, updated and erased: nothing
+ */
+TEST(DiscoveryDatabaseTest, coalesce_new_endpoint)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    std::vector<std::vector<EndpointChange>> batches;
+    test::record_batches(database, batches);
+
+    unsigned int added = 0;
+    database.add_endpoint_discovered_callback([&added](Endpoint)
+            {
+                added++;
+            });
+
+    Endpoint reader = test::endpoint(1, 0, 0);
+    Endpoint dropped = test::endpoint(2, 0, 0);
+
+    database.add_endpoint(reader);
+    database.add_endpoint(dropped);
+    reader.topic.topic_qos.history_depth = 1;
+    database.update_endpoint(reader);
+    database.update_endpoint(dropped);
+    database.erase_endpoint(dropped);
+
+    database.process_queue_();
+
+    ASSERT_EQ(added, 1u);
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 1u);
+    ASSERT_EQ(std::get<0>(batches[0][0]), DatabaseOperation::add);
+    ASSERT_EQ(std::get<1>(batches[0][0]).topic.topic_qos.history_depth, 1u);
+
+    ASSERT_TRUE(database.endpoint_exists(reader.guid));
+    ASSERT_FALSE(database.endpoint_exists(dropped.guid));
+}
+
+/**
+ * Test that the operations queued for an endpoint already in the database are coalesced.
+ *
+ * CASES:
+ *  Erased and added again while active: update
+ *  Updated to inactive and erased: erase
+ *  Inactive added again: add
+ *  No operation applied: no batch
+ */
+TEST(DiscoveryDatabaseTest, coalesce_existing_endpoint)
+{
+    test::DiscoveryDatabaseTestClass database;
+
+    Endpoint readded = test::endpoint(1, 0, 0);
+    Endpoint erased = test::endpoint(2, 0, 0);
+    Endpoint inactive = test::endpoint(3, 0, 0, EndpointKind::reader, false);
+    database.add_endpoint_(readded);
+    database.add_endpoint_(erased);
+    database.add_endpoint_(inactive);
+
+    std::vector<std::vector<EndpointChange>> batches;
+    test::record_batches(database, batches);
+
+    database.erase_endpoint(readded);
+    database.add_endpoint(readded);
+
+    erased.active = false;
+    database.update_endpoint(erased);
+    database.erase_endpoint(erased);
+
+    inactive.active = true;
+    database.add_endpoint(inactive);
+
+    database.process_queue_();
+
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 3u);
+    ASSERT_EQ(std::get<0>(batches[0][0]), DatabaseOperation::update);
+    ASSERT_EQ(std::get<1>(batches[0][0]).guid, readded.guid);
+    ASSERT_EQ(std::get<0>(batches[0][1]), DatabaseOperation::erase);
+    ASSERT_EQ(std::get<1>(batches[0][1]).guid, erased.guid);
+    ASSERT_EQ(std::get<0>(batches[0][2]), DatabaseOperation::add);
+    ASSERT_EQ(std::get<1>(batches[0][2]).guid, inactive.guid);
+
+    ASSERT_EQ(database.count_active_endpoints(EndpointKind::reader, readded.topic, readded.discoverer_participant_id),
+            2u);
+
+    // Nothing queued
+    database.process_queue_();
+    ASSERT_EQ(batches.size(), 1u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
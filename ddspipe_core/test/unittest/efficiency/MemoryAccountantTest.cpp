@@ -0,0 +1,214 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/memory/MemoryAccountant.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const uint32_t PAYLOAD_SIZE = 100;
+
+} // test
+
+/**
+ * Check that the bytes of the payloads reserved and released by the pool are counted.
+ *
+ * CASES:
+ *  Reserve payloads and check the bytes reserved
+ *  Reference a payload and check it is not counted twice
+ *  Release every payload and check nothing is reserved
+ */
+TEST(MemoryAccountantTest, count_reserved_bytes)
+{
+    FastPayloadPool pool;
+    auto accountant = std::make_shared<MemoryAccountant>();
+    ASSERT_TRUE(pool.set_memory_accountant(accountant));
+    ASSERT_EQ(pool.memory_accountant(), accountant);
+
+    Payload payload0;
+    Payload payload1;
+    pool.get_payload(test::PAYLOAD_SIZE, payload0);
+    pool.get_payload(test::PAYLOAD_SIZE * 2, payload1);
+    ASSERT_EQ(accountant->reserved_bytes(), test::PAYLOAD_SIZE * 3);
+
+    Payload payload2;
+    eprosima::fastrtps::rtps::IPayloadPool* owner = &pool;
+    pool.get_payload(payload0, owner, payload2);
+    ASSERT_EQ(accountant->reserved_bytes(), test::PAYLOAD_SIZE * 3);
+
+    pool.release_payload(payload0);
+    ASSERT_EQ(accountant->reserved_bytes(), test::PAYLOAD_SIZE * 3);
+
+    pool.release_payload(payload1);
+    pool.release_payload(payload2);
+    ASSERT_EQ(accountant->reserved_bytes(), 0u);
+}
+
+/**
+ * Check that only one accountant can be set in a pool.
+ */
+TEST(MemoryAccountantTest, set_accountant_once)
+{
+    FastPayloadPool pool;
+    auto accountant = std::make_shared<MemoryAccountant>();
+    ASSERT_TRUE(pool.set_memory_accountant(accountant));
+    ASSERT_FALSE(pool.set_memory_accountant(std::make_shared<MemoryAccountant>()));
+    ASSERT_EQ(pool.memory_accountant(), accountant);
+}
+
+/**
+ * Check that a payload charged to a topic and a Participant is discharged when the pool releases it.
+ *
+ * STEPS:
+ *  Charge a payload twice and check it is charged once
+ *  Release a reference and check it is still charged
+ *  Release the last reference and check it is discharged
+ */
+TEST(MemoryAccountantTest, charge_until_released)
+{
+    FastPayloadPool pool;
+    auto accountant = std::make_shared<MemoryAccountant>();
+    pool.set_memory_accountant(accountant);
+
+    auto topic = accountant->topic_account("topic");
+    auto participant = accountant->participant_account("participant");
+    ASSERT_EQ(accountant->topic_account("topic"), topic);
+
+    Payload payload0;
+    pool.get_payload(test::PAYLOAD_SIZE, payload0);
+    Payload payload1;
+    eprosima::fastrtps::rtps::IPayloadPool* owner = &pool;
+    pool.get_payload(payload0, owner, payload1);
+
+    accountant->charge(payload0, *topic, *participant);
+    accountant->charge(payload1, *topic, *participant);
+    ASSERT_EQ(topic->bytes.load(), test::PAYLOAD_SIZE);
+    ASSERT_EQ(participant->bytes.load(), test::PAYLOAD_SIZE);
+
+    pool.release_payload(payload0);
+    ASSERT_EQ(topic->bytes.load(), test::PAYLOAD_SIZE);
+
+    pool.release_payload(payload1);
+    ASSERT_EQ(topic->bytes.load(), 0u);
+    ASSERT_EQ(participant->bytes.load(), 0u);
+
+    auto usage = accountant->usage();
+    ASSERT_EQ(usage.reserved_bytes, 0u);
+    ASSERT_EQ(usage.topics.size(), 1u);
+    ASSERT_EQ(usage.topics["topic"].bytes, 0u);
+    ASSERT_EQ(usage.participants.size(), 1u);
+}
+
+/**
+ * Check that the global budget is exceeded only when the bytes reserved are over the maximum.
+ *
+ * CASES:
+ *  Unlimited budget
+ *  Reserve up to the budget
+ *  Reserve over the budget
+ *  Release under the budget
+ */
+TEST(MemoryAccountantTest, over_budget)
+{
+    // Unlimited budget
+    {
+        FastPayloadPool pool;
+        auto accountant = std::make_shared<MemoryAccountant>();
+        pool.set_memory_accountant(accountant);
+
+        Payload payload;
+        pool.get_payload(test::PAYLOAD_SIZE, payload);
+        ASSERT_FALSE(accountant->over_budget());
+        pool.release_payload(payload);
+    }
+
+    MemoryBudgetConfiguration configuration;
+    configuration.max_bytes = test::PAYLOAD_SIZE * 2;
+
+    FastPayloadPool pool;
+    auto accountant = std::make_shared<MemoryAccountant>(configuration);
+    pool.set_memory_accountant(accountant);
+
+    // Reserve up to the budget
+    Payload payload0;
+    Payload payload1;
+    pool.get_payload(test::PAYLOAD_SIZE, payload0);
+    pool.get_payload(test::PAYLOAD_SIZE, payload1);
+    ASSERT_FALSE(accountant->over_budget());
+
+    // Reserve over the budget
+    Payload payload2;
+    pool.get_payload(test::PAYLOAD_SIZE, payload2);
+    ASSERT_TRUE(accountant->over_budget());
+    ASSERT_EQ(accountant->usage().max_bytes, configuration.max_bytes);
+
+    // Release under the budget
+    pool.release_payload(payload2);
+    ASSERT_FALSE(accountant->over_budget());
+
+    pool.release_payload(payload0);
+    pool.release_payload(payload1);
+}
+
+/**
+ * Check that the global budget is shared evenly between the topics accounted.
+ *
+ * CASES:
+ *  Unlimited budget
+ *  No topic accounted
+ *  Several topics accounted
+ *  Topic accounted twice
+ */
+TEST(MemoryAccountantTest, topic_share)
+{
+    // Unlimited budget
+    {
+        MemoryAccountant accountant;
+        accountant.topic_account("topic");
+        ASSERT_EQ(accountant.topic_share(), 0u);
+    }
+
+    MemoryBudgetConfiguration configuration;
+    configuration.max_bytes = test::PAYLOAD_SIZE * 4;
+    MemoryAccountant accountant(configuration);
+
+    // No topic accounted
+    ASSERT_EQ(accountant.topic_share(), configuration.max_bytes);
+
+    // Several topics accounted
+    accountant.topic_account("topic0");
+    accountant.topic_account("topic1");
+    ASSERT_EQ(accountant.topic_share(), test::PAYLOAD_SIZE * 2);
+
+    // Topic accounted twice
+    accountant.topic_account("topic0");
+    ASSERT_EQ(accountant.topic_share(), test::PAYLOAD_SIZE * 2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
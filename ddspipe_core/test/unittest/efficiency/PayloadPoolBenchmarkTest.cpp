@@ -0,0 +1,141 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/MapPayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/ShardedMapPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const unsigned int ITERATIONS_PER_THREAD = 20000;
+constexpr const unsigned int REFERENCES_PER_PAYLOAD = 3;
+constexpr const uint32_t PAYLOAD_SIZE = 64;
+const std::vector<unsigned int> THREADS_TO_TEST = {1, 2, 4, 8};
+
+/**
+ * @brief Run the same get / reference / release workload in \c n_threads threads over \c pool .
+ *
+ * Each iteration reserves a payload, references it \c REFERENCES_PER_PAYLOAD times as if it was forwarded to
+ * that many writers, and releases every reference.
+ * Every operation must succeed, and every reference must point to the data of its payload.
+ *
+ * @return nanoseconds per pool operation
+ */
+double run_contention_workload(
+        PayloadPool& pool,
+        unsigned int n_threads)
+{
+    std::atomic<unsigned int> failures(0);
+
+    eprosima::fastrtps::rtps::IPayloadPool* owner = &pool;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < n_threads; t++)
+    {
+        threads.emplace_back(
+            [&pool, owner, &failures]()
+            {
+                eprosima::fastrtps::rtps::IPayloadPool* data_owner = owner;
+                Payload payload;
+                std::vector<Payload> references(REFERENCES_PER_PAYLOAD);
+
+                for (unsigned int i = 0; i < ITERATIONS_PER_THREAD; i++)
+                {
+                    bool ok = pool.get_payload(PAYLOAD_SIZE, payload);
+                    for (auto& reference : references)
+                    {
+                        ok = pool.get_payload(payload, data_owner, reference) && ok;
+                        ok = reference.data == payload.data && ok;
+                    }
+                    for (auto& reference : references)
+                    {
+                        ok = pool.release_payload(reference) && ok;
+                    }
+                    ok = pool.release_payload(payload) && ok;
+
+                    if (!ok)
+                    {
+                        failures++;
+                    }
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(failures.load(), 0u);
+
+    // Each iteration makes 1 reserve, N references and N+1 releases
+    double operations =
+            static_cast<double>(n_threads) * ITERATIONS_PER_THREAD * (2 + 2 * REFERENCES_PER_PAYLOAD);
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / operations;
+}
+
+} // test
+
+/**
+ * Compare the contention of MapPayloadPool (one global mutex) and ShardedMapPayloadPool under the same
+ * workload with an increasing number of threads.
+ *
+ * It prints the time per operation of each implementation.
+ * Timing depends on the machine, so it only asserts that every operation succeeds and both pools end clean.
+ */
+TEST(PayloadPoolBenchmarkTest, map_payload_pool_contention)
+{
+    std::cout << "threads | MapPayloadPool ns/op | ShardedMapPayloadPool ns/op" << std::endl;
+
+    for (unsigned int n_threads : test::THREADS_TO_TEST)
+    {
+        auto map_pool = std::make_shared<MapPayloadPool>();
+        auto sharded_pool = std::make_shared<ShardedMapPayloadPool>();
+
+        double map_ns = test::run_contention_workload(*map_pool, n_threads);
+        double sharded_ns = test::run_contention_workload(*sharded_pool, n_threads);
+
+        std::cout << n_threads << " | " << map_ns << " | " << sharded_ns << std::endl;
+
+        ASSERT_TRUE(map_pool->is_clean());
+        ASSERT_TRUE(sharded_pool->is_clean());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
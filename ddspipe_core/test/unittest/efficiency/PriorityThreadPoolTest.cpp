@@ -0,0 +1,273 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+#include <ddspipe_core/efficiency/thread_pool/PriorityThreadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/thread_pool_factory.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 4;
+constexpr const unsigned int N_EMISSIONS = 10000;
+constexpr const unsigned int LONG_STARVATION_TIMEOUT_MS = 60000;
+constexpr const std::chrono::seconds TIMEOUT(5);
+
+//! Record of the order in which the tasks are executed
+class ExecutionOrder
+{
+public:
+
+    void add(
+            unsigned int value)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            values_.push_back(value);
+        }
+        cv_.notify_all();
+    }
+
+    bool wait_for_size(
+            unsigned int size)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, TIMEOUT, [this, size]()
+                       {
+                           return values_.size() >= size;
+                       });
+    }
+
+    std::vector<unsigned int> values()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return values_;
+    }
+
+private:
+
+    std::vector<unsigned int> values_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+//! Register one task per value of \c ids that adds its index to \c order
+void slot_tasks(
+        PriorityThreadPool& pool,
+        ExecutionOrder& order,
+        std::vector<utils::TaskId>& ids,
+        unsigned int n_tasks)
+{
+    for (unsigned int i = 0; i < n_tasks; i++)
+    {
+        ids.push_back(utils::new_unique_task_id());
+        pool.slot(ids.back(), [&order, i]()
+                {
+                    order.add(i);
+                });
+    }
+}
+
+} // test
+
+/**
+ * Emit a task many times from several priorities and check that it is executed once per emission.
+ */
+TEST(PriorityThreadPoolTest, execute_every_emission)
+{
+    test::ExecutionOrder order;
+    std::vector<utils::TaskId> ids;
+
+    PriorityThreadPool pool(test::N_THREADS);
+    test::slot_tasks(pool, order, ids, 1);
+    pool.enable();
+
+    for (unsigned int i = 0; i < test::N_EMISSIONS; i++)
+    {
+        pool.emit(ids[0], i % pool.priority_classes());
+    }
+
+    ASSERT_TRUE(order.wait_for_size(test::N_EMISSIONS));
+    pool.disable();
+
+    uint64_t executed = 0;
+    for (const auto& priority_class : pool.metrics())
+    {
+        executed += priority_class.executed;
+        ASSERT_EQ(priority_class.queue_depth, 0u);
+        ASSERT_EQ(priority_class.queueing_delay.count, priority_class.executed);
+    }
+    ASSERT_EQ(executed, test::N_EMISSIONS);
+}
+
+/**
+ * Emit tasks of every class before enabling a pool with one thread, and check that the tasks of higher classes
+ * are executed first, and in FIFO order within the same class.
+ */
+TEST(PriorityThreadPoolTest, higher_priority_first)
+{
+    test::ExecutionOrder order;
+    std::vector<utils::TaskId> ids;
+
+    PriorityThreadPool pool(1, 0, 3, test::LONG_STARVATION_TIMEOUT_MS);
+    test::slot_tasks(pool, order, ids, 6);
+
+    // Task i has priority i / 2
+    pool.emit(ids[0], 0);
+    pool.emit(ids[2], 1);
+    pool.emit(ids[4], 2);
+    pool.emit(ids[1], 0);
+    pool.emit(ids[3], 1);
+    pool.emit(ids[5], 2);
+
+    pool.enable();
+    ASSERT_TRUE(order.wait_for_size(6));
+
+    std::vector<unsigned int> expected = {4, 5, 2, 3, 0, 1};
+    ASSERT_EQ(order.values(), expected);
+
+    for (const auto& priority_class : pool.metrics())
+    {
+        ASSERT_EQ(priority_class.executed, 2u);
+        ASSERT_EQ(priority_class.starvation_promotions, 0u);
+    }
+}
+
+/**
+ * Emit a low priority task and, once it has waited longer than the starvation timeout, a high priority one.
+ * Check that the low priority task is executed first and counted as promoted.
+ */
+TEST(PriorityThreadPoolTest, starvation_guard)
+{
+    test::ExecutionOrder order;
+    std::vector<utils::TaskId> ids;
+
+    PriorityThreadPool pool(1, 0, 2, 10);
+    test::slot_tasks(pool, order, ids, 2);
+
+    pool.emit(ids[0], 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    pool.emit(ids[1], 1);
+
+    pool.enable();
+    ASSERT_TRUE(order.wait_for_size(2));
+
+    std::vector<unsigned int> expected = {0, 1};
+    ASSERT_EQ(order.values(), expected);
+
+    auto metrics = pool.metrics();
+    ASSERT_EQ(metrics[0].starvation_promotions, 1u);
+    ASSERT_EQ(metrics[1].starvation_promotions, 0u);
+    ASSERT_GE(metrics[0].queueing_delay.min, 20000000u);
+}
+
+/**
+ * Check that a priority over the highest class is executed in the highest class.
+ */
+TEST(PriorityThreadPoolTest, priority_over_highest_class)
+{
+    test::ExecutionOrder order;
+    std::vector<utils::TaskId> ids;
+
+    PriorityThreadPool pool(1, 0, 2, test::LONG_STARVATION_TIMEOUT_MS);
+    test::slot_tasks(pool, order, ids, 2);
+
+    pool.emit(ids[0], 1);
+    pool.emit(ids[1], 10);
+
+    pool.enable();
+    ASSERT_TRUE(order.wait_for_size(2));
+
+    auto metrics = pool.metrics();
+    ASSERT_EQ(metrics.size(), 2u);
+    ASSERT_EQ(metrics[0].executed, 0u);
+    ASSERT_EQ(metrics[1].executed, 2u);
+}
+
+/**
+ * Check that the metrics of each class are reachable through the \c IThreadPool interface.
+ */
+TEST(PriorityThreadPoolTest, metrics_through_interface)
+{
+    test::ExecutionOrder order;
+
+    std::unique_ptr<PriorityThreadPool> priority_pool(new PriorityThreadPool(1, 0, 2));
+    std::vector<utils::TaskId> ids;
+    test::slot_tasks(*priority_pool, order, ids, 1);
+
+    std::unique_ptr<IThreadPool> pool(std::move(priority_pool));
+    pool->enable();
+
+    for (unsigned int i = 0; i < test::N_THREADS; i++)
+    {
+        pool->emit(ids[0], 1);
+    }
+
+    ASSERT_TRUE(order.wait_for_size(test::N_THREADS));
+    pool->disable();
+
+    std::vector<PriorityClassMetricsSnapshot> metrics = pool->metrics();
+    ASSERT_EQ(metrics.size(), 2u);
+    ASSERT_EQ(metrics[0].executed, 0u);
+    ASSERT_EQ(metrics[1].executed, test::N_THREADS);
+    ASSERT_EQ(metrics[1].queueing_delay.count, test::N_THREADS);
+}
+
+/**
+ * Check that the factory creates a priority thread pool, and rejects a configuration without classes.
+ */
+TEST(PriorityThreadPoolTest, factory)
+{
+    ThreadPoolConfiguration configuration;
+    configuration.kind = ThreadPoolKind::priority;
+    configuration.n_threads = 2;
+    configuration.messages_per_turn = 5;
+    configuration.priority_classes = 4;
+
+    {
+        auto pool = create_thread_pool(configuration);
+        auto priority_pool = std::dynamic_pointer_cast<PriorityThreadPool>(pool);
+        ASSERT_NE(priority_pool, nullptr);
+        ASSERT_EQ(priority_pool->messages_per_turn(), 5u);
+        ASSERT_EQ(priority_pool->priority_classes(), 4u);
+        ASSERT_EQ(pool->metrics().size(), 4u);
+    }
+
+    {
+        configuration.priority_classes = 0;
+        ASSERT_THROW(create_thread_pool(configuration), utils::ConfigurationException);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,261 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/testing/LogChecker.hpp>
+#include <cpp_utils/exception/InconsistencyException.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/ShardedMapPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+const constexpr unsigned int TEST_NUMBER = 5;
+const constexpr unsigned int TEST_THREADS = 4;
+const constexpr size_t DEFAULT_SIZE = sizeof(PayloadUnit);
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace test {
+
+/**
+ * @brief Mock over ShardedMapPayloadPool implementing public access to private variables.
+ *
+ */
+class MockShardedMapPayloadPool : public ShardedMapPayloadPool
+{
+public:
+
+    using ShardedMapPayloadPool::ShardedMapPayloadPool;
+
+    uint64_t pointers_stored()
+    {
+        uint64_t stored = 0;
+        for (auto& shard : shards_)
+        {
+            stored += shard.reserved_payloads.size();
+        }
+        return stored;
+    }
+
+    uint64_t reference_count(
+            const Payload& payload)
+    {
+        return shard_(payload.data).reserved_payloads[payload.data];
+    }
+
+    void clean_all(
+            std::vector<Payload>& payloads)
+    {
+        for (Payload& payload : payloads)
+        {
+            release_payload(payload);
+        }
+    }
+
+};
+
+} /* namespace test */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+/**
+ * Test get_payload method for new changes
+ *
+ * CASES:
+ *  Get N different pointers
+ *  fail reserve memory
+ */
+TEST(ShardedMapPayloadPoolTest, get_payload)
+{
+    // Get N different pointers
+    {
+        test::MockShardedMapPayloadPool pool;
+        std::vector<Payload> payloads(TEST_NUMBER);
+
+        for (unsigned int i = 0; i < TEST_NUMBER; i++)
+        {
+            ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payloads[i]));
+
+            ASSERT_EQ(payloads[i].max_size, DEFAULT_SIZE);
+            ASSERT_EQ(pool.pointers_stored(), i + 1);
+            ASSERT_EQ(pool.reference_count(payloads[i]), 1u);
+        }
+
+        // END : Clean all remaining payloads
+        pool.clean_all(payloads);
+        ASSERT_EQ(pool.pointers_stored(), 0u);
+    }
+
+    // fail reserve memory
+    {
+        test::MockShardedMapPayloadPool pool;
+        Payload payload;
+
+        ASSERT_FALSE(pool.get_payload(0, payload));
+    }
+}
+
+/**
+ * Get some payloads from pool from src and release each of them separatly checking reference count
+ *
+ * STEPS:
+ *  get first payload
+ *  get N-1 payloads from first
+ *  release N-1 payloads
+ *  release first payload
+ */
+TEST(ShardedMapPayloadPoolTest, release_payload)
+{
+    eprosima::fastrtps::rtps::IPayloadPool* pool = new test::MockShardedMapPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockShardedMapPayloadPool* pool_ = static_cast<test::MockShardedMapPayloadPool*>(pool);
+    std::vector<Payload> payloads(TEST_NUMBER);
+
+    // get first payload
+    pool_->get_payload(DEFAULT_SIZE, payloads[0]);
+
+    // get N-1 payloads from first
+    for (unsigned int i = 1; i < TEST_NUMBER; i++)
+    {
+        pool_->get_payload(payloads[0], pool, payloads[i]);
+        ASSERT_EQ(pool_->reference_count(payloads[0]), i + 1) << i;
+        ASSERT_EQ(payloads[i].data, payloads[0].data);
+    }
+
+    // release N-1 payloads
+    for (unsigned int i = 1; i < TEST_NUMBER; i++)
+    {
+        ASSERT_TRUE(pool_->release_payload(payloads[i]));
+        ASSERT_EQ(pool_->reference_count(payloads[0]), TEST_NUMBER - i) << i;
+    }
+
+    // release first payload
+    ASSERT_TRUE(pool_->release_payload(payloads[0]));
+    ASSERT_EQ(pool_->pointers_stored(), 0u);
+    ASSERT_TRUE(pool_->is_clean());
+
+    delete pool;
+}
+
+/**
+ * Check ownership validation in get_payload from source and release
+ *
+ * CASES:
+ *  The source says the owner is the same pool, but is not
+ *  Release a payload that has been get from a different payload pool
+ */
+TEST(ShardedMapPayloadPoolTest, ownership_negative)
+{
+    // The source says the owner is the same pool, but is not
+    {
+        // 1 log error expected
+        INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 1, 1);
+
+        eprosima::fastrtps::rtps::IPayloadPool* pool = new test::MockShardedMapPayloadPool(); // Requires to be ptr to pass it to get_payload
+        test::MockShardedMapPayloadPool* pool_ = static_cast<test::MockShardedMapPayloadPool*>(pool);
+        test::MockShardedMapPayloadPool pool_aux;
+
+        Payload payload_src;
+        Payload payload_target;
+
+        // Get payload for source
+        pool_aux.get_payload(DEFAULT_SIZE, payload_src);
+
+        // In a different pool, try to source it as if it was from same pool
+        ASSERT_THROW(pool_->get_payload(payload_src, pool, payload_target), eprosima::utils::InconsistencyException);
+
+        // END : release payload
+        pool_aux.release_payload(payload_src);
+
+        delete pool;
+    }
+
+    // Release a payload that has been get from a different payload pool
+    {
+        // 1 log error expected
+        INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 1, 1);
+
+        test::MockShardedMapPayloadPool pool;
+        test::MockShardedMapPayloadPool pool_aux;
+        Payload payload;
+
+        pool_aux.get_payload(DEFAULT_SIZE, payload);
+
+        ASSERT_THROW(pool.release_payload(payload), eprosima::utils::InconsistencyException);
+
+        // END : release payload
+        pool_aux.release_payload(payload);
+    }
+}
+
+/**
+ * Get, reference and release payloads from several threads at the same time.
+ */
+TEST(ShardedMapPayloadPoolTest, multithread)
+{
+    eprosima::fastrtps::rtps::IPayloadPool* pool = new test::MockShardedMapPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockShardedMapPayloadPool* pool_ = static_cast<test::MockShardedMapPayloadPool*>(pool);
+
+    // Payload shared by every thread
+    Payload shared_payload;
+    ASSERT_TRUE(pool_->get_payload(DEFAULT_SIZE, shared_payload));
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < TEST_THREADS; t++)
+    {
+        threads.emplace_back(
+            [pool, pool_, &shared_payload]()
+            {
+                eprosima::fastrtps::rtps::IPayloadPool* data_owner = pool;
+                for (unsigned int iteration = 0; iteration < 100; iteration++)
+                {
+                    std::vector<Payload> payloads(TEST_NUMBER * 2);
+                    for (unsigned int i = 0; i < TEST_NUMBER; i++)
+                    {
+                        pool_->get_payload(DEFAULT_SIZE, payloads[i]);
+                        pool_->get_payload(shared_payload, data_owner, payloads[TEST_NUMBER + i]);
+                    }
+                    pool_->clean_all(payloads);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(pool_->reference_count(shared_payload), 1u);
+    ASSERT_TRUE(pool_->release_payload(shared_payload));
+    ASSERT_EQ(pool_->pointers_stored(), 0u);
+    ASSERT_TRUE(pool_->is_clean());
+
+    delete pool;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,449 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+
+#include <ddspipe_core/efficiency/payload/SharedMemoryPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const unsigned int TEST_NUMBER = 5;
+constexpr const uint32_t BLOCK_SIZE = 1024;
+constexpr const uint32_t N_BLOCKS = 8;
+constexpr const uint32_t DATA_SIZE = 100;
+
+//! Segment name unique for this test process, so tests running in parallel do not share segments
+std::string segment_name(
+        const std::string& test_name)
+{
+    return "ddspipe_test_" + test_name + "_" + std::to_string(getpid());
+}
+
+//! Wait for child \c pid and return its exit code (-1 if it did not exit normally)
+int wait_child(
+        pid_t pid)
+{
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+    {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+/**
+ * @brief Mock over SharedMemoryPayloadPool implementing public access to the segment initialization.
+ */
+class MockSharedMemoryPayloadPool : public SharedMemoryPayloadPool
+{
+public:
+
+    using SharedMemoryPayloadPool::SharedMemoryPayloadPool;
+
+    //! Take the segment to initialize it, as a process that starts initializing it
+    bool begin_initialization()
+    {
+        return begin_initialization_(control_());
+    }
+
+    //! Mark the segment as ready, as a process that finishes initializing it
+    void end_initialization()
+    {
+        end_initialization_();
+    }
+
+};
+
+} // test
+
+/**
+ * Reserve payloads in the segment and release them, checking the free blocks of the segment.
+ */
+TEST(SharedMemoryPayloadPoolTest, get_payload)
+{
+    SharedMemoryPayloadPool pool(test::segment_name("get_payload"), test::BLOCK_SIZE, test::N_BLOCKS);
+    ASSERT_FALSE(pool.recovered_stale_segment());
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+    std::vector<Payload> payloads(test::TEST_NUMBER);
+    for (unsigned int i = 0; i < test::TEST_NUMBER; i++)
+    {
+        ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payloads[i]));
+        ASSERT_EQ(payloads[i].max_size, test::DATA_SIZE);
+        ASSERT_TRUE(pool.is_shared(payloads[i]));
+        ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - i - 1);
+    }
+
+    for (auto& payload : payloads)
+    {
+        ASSERT_TRUE(pool.release_payload(payload));
+    }
+
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+    ASSERT_TRUE(pool.is_clean());
+
+    // fail reserve memory
+    Payload payload;
+    ASSERT_FALSE(pool.get_payload(0, payload));
+}
+
+/**
+ * Reference a payload of the same pool several times: the data is shared and the block is only returned to the
+ * segment when the last reference is released.
+ */
+TEST(SharedMemoryPayloadPoolTest, get_payload_from_src)
+{
+    eprosima::fastrtps::rtps::IPayloadPool* pool =
+            new SharedMemoryPayloadPool(test::segment_name("get_payload_from_src"), test::BLOCK_SIZE, test::N_BLOCKS);
+    SharedMemoryPayloadPool* pool_ = static_cast<SharedMemoryPayloadPool*>(pool);
+
+    std::vector<Payload> payloads(test::TEST_NUMBER);
+    ASSERT_TRUE(pool_->get_payload(test::DATA_SIZE, payloads[0]));
+
+    for (unsigned int i = 1; i < test::TEST_NUMBER; i++)
+    {
+        ASSERT_TRUE(pool_->get_payload(payloads[0], pool, payloads[i]));
+        ASSERT_EQ(payloads[i].data, payloads[0].data);
+    }
+    ASSERT_EQ(pool_->free_blocks(), test::N_BLOCKS - 1);
+
+    for (unsigned int i = test::TEST_NUMBER; i > 1; i--)
+    {
+        ASSERT_TRUE(pool_->release_payload(payloads[i - 1]));
+        ASSERT_EQ(pool_->free_blocks(), test::N_BLOCKS - 1);
+    }
+
+    ASSERT_TRUE(pool_->release_payload(payloads[0]));
+    ASSERT_EQ(pool_->free_blocks(), test::N_BLOCKS);
+    ASSERT_TRUE(pool_->is_clean());
+
+    delete pool;
+}
+
+/**
+ * Payloads that do not fit in a block, or reserved when the segment is full, are reserved in local memory.
+ *
+ * CASES:
+ *  payload bigger than a block
+ *  segment full
+ */
+TEST(SharedMemoryPayloadPoolTest, local_fallback)
+{
+    SharedMemoryPayloadPool pool(test::segment_name("local_fallback"), test::BLOCK_SIZE, test::N_BLOCKS);
+
+    // payload bigger than a block
+    {
+        Payload payload;
+        ASSERT_TRUE(pool.get_payload(test::BLOCK_SIZE + 1, payload));
+        ASSERT_FALSE(pool.is_shared(payload));
+        ASSERT_THROW(pool.offset_of(payload), eprosima::utils::InconsistencyException);
+        ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+        ASSERT_TRUE(pool.release_payload(payload));
+    }
+
+    // segment full
+    {
+        std::vector<Payload> payloads(test::N_BLOCKS + 1);
+        for (auto& payload : payloads)
+        {
+            ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+        }
+        ASSERT_EQ(pool.free_blocks(), 0u);
+        ASSERT_FALSE(pool.is_shared(payloads.back()));
+
+        for (auto& payload : payloads)
+        {
+            ASSERT_TRUE(pool.release_payload(payload));
+        }
+        ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+    }
+
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * A different process maps the same segment, references a payload by its offset and modifies it.
+ * The changes are seen by this process without any copy, and the block is only freed after both release it.
+ */
+TEST(SharedMemoryPayloadPoolTest, cross_process)
+{
+    const std::string name = test::segment_name("cross_process");
+    SharedMemoryPayloadPool pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+
+    Payload payload;
+    ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+    std::memset(payload.data, 'a', test::DATA_SIZE);
+    payload.length = test::DATA_SIZE;
+
+    uint64_t offset = pool.offset_of(payload);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        // Child process: do not use gtest asserts, report by exit code
+        int result = 0;
+        {
+            SharedMemoryPayloadPool child_pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+            Payload child_payload;
+
+            if (child_pool.recovered_stale_segment())
+            {
+                result = 1;
+            }
+            else if (!child_pool.get_payload_from_offset(offset, test::DATA_SIZE, child_payload))
+            {
+                result = 2;
+            }
+            else
+            {
+                if (child_payload.data[0] != 'a' || child_payload.data[test::DATA_SIZE - 1] != 'a')
+                {
+                    result = 3;
+                }
+                child_payload.data[0] = 'b';
+                child_pool.release_payload(child_payload);
+            }
+        }
+        _exit(result);
+    }
+
+    ASSERT_EQ(test::wait_child(pid), 0);
+
+    // Data modified by the other process, and still referenced by this one
+    ASSERT_EQ(payload.data[0], 'b');
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - 1);
+
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+    // Released data cannot be referenced anymore
+    Payload released_payload;
+    ASSERT_FALSE(pool.get_payload_from_offset(offset, test::DATA_SIZE, released_payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * A process creates the segment, reserves payloads and finishes without detaching (as if it crashed).
+ * The next process opening the segment finds it stale and recovers every block.
+ */
+TEST(SharedMemoryPayloadPoolTest, crash_recovery)
+{
+    const std::string name = test::segment_name("crash_recovery");
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        // Child process: leak the pool so the segment is never detached
+        SharedMemoryPayloadPool* child_pool = new SharedMemoryPayloadPool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+        for (unsigned int i = 0; i < test::TEST_NUMBER; i++)
+        {
+            Payload payload;
+            child_pool->get_payload(test::DATA_SIZE, payload);
+        }
+        _exit(child_pool->free_blocks() == test::N_BLOCKS - test::TEST_NUMBER ? 0 : 1);
+    }
+
+    ASSERT_EQ(test::wait_child(pid), 0);
+
+    SharedMemoryPayloadPool pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+    ASSERT_TRUE(pool.recovered_stale_segment());
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+    Payload payload;
+    ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+    ASSERT_TRUE(pool.is_shared(payload));
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * A process crashes while initializing the segment (its pid is still in the segment as initializer).
+ * The next process opening the segment does not wait for it forever, and recovers it.
+ */
+TEST(SharedMemoryPayloadPoolTest, crash_during_initialization)
+{
+    const std::string name = test::segment_name("crash_during_initialization");
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        // Child process: start initializing the segment and finish without detaching
+        test::MockSharedMemoryPayloadPool* child_pool =
+                new test::MockSharedMemoryPayloadPool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+        Payload payload;
+        child_pool->get_payload(test::DATA_SIZE, payload);
+        _exit(child_pool->begin_initialization() ? 0 : 1);
+    }
+
+    ASSERT_EQ(test::wait_child(pid), 0);
+
+    SharedMemoryPayloadPool pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+    ASSERT_TRUE(pool.recovered_stale_segment());
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+    Payload payload;
+    ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+    ASSERT_TRUE(pool.is_shared(payload));
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * A process is initializing the segment (slowly) when another one opens it.
+ * The second process waits for it to finish instead of recovering the segment, and both share it.
+ */
+TEST(SharedMemoryPayloadPoolTest, wait_alive_initializer)
+{
+    const std::string name = test::segment_name("wait_alive_initializer");
+
+    int initializing_pipe[2];
+    int done_pipe[2];
+    ASSERT_EQ(pipe(initializing_pipe), 0);
+    ASSERT_EQ(pipe(done_pipe), 0);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        // Child process: initialize the segment slowly, and detach once the parent has joined it
+        int result = 0;
+        {
+            test::MockSharedMemoryPayloadPool child_pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+            if (!child_pool.begin_initialization())
+            {
+                result = 1;
+            }
+
+            char signal = 'i';
+            if (write(initializing_pipe[1], &signal, 1) != 1)
+            {
+                result = 2;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            child_pool.end_initialization();
+
+            if (read(done_pipe[0], &signal, 1) != 1)
+            {
+                result = 3;
+            }
+        }
+        _exit(result);
+    }
+
+    char signal;
+    ASSERT_EQ(read(initializing_pipe[0], &signal, 1), 1);
+
+    {
+        SharedMemoryPayloadPool pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+        ASSERT_FALSE(pool.recovered_stale_segment());
+
+        Payload payload;
+        ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+        ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - 1);
+
+        signal = 'd';
+        ASSERT_EQ(write(done_pipe[1], &signal, 1), 1);
+        ASSERT_EQ(test::wait_child(pid), 0);
+
+        // The child detached without removing the segment, as this process is still attached
+        ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - 1);
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    for (int fd : {initializing_pipe[0], initializing_pipe[1], done_pipe[0], done_pipe[1]})
+    {
+        close(fd);
+    }
+}
+
+/**
+ * A process references blocks (its own and one of this process) and crashes while this process is attached.
+ * This process releases the references of the dead process, freeing its blocks but keeping the shared one.
+ */
+TEST(SharedMemoryPayloadPoolTest, reclaim_dead_process)
+{
+    const std::string name = test::segment_name("reclaim_dead_process");
+    SharedMemoryPayloadPool pool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+
+    Payload payload;
+    ASSERT_TRUE(pool.get_payload(test::DATA_SIZE, payload));
+    payload.length = test::DATA_SIZE;
+    uint64_t offset = pool.offset_of(payload);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+
+    if (pid == 0)
+    {
+        // Child process: reference blocks and finish without releasing them nor detaching
+        SharedMemoryPayloadPool* child_pool = new SharedMemoryPayloadPool(name, test::BLOCK_SIZE, test::N_BLOCKS);
+        for (unsigned int i = 0; i < test::TEST_NUMBER; i++)
+        {
+            Payload child_payload;
+            child_pool->get_payload(test::DATA_SIZE, child_payload);
+        }
+
+        Payload shared_payload;
+        _exit(child_pool->get_payload_from_offset(offset, test::DATA_SIZE, shared_payload) ? 0 : 1);
+    }
+
+    ASSERT_EQ(test::wait_child(pid), 0);
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - 1 - test::TEST_NUMBER);
+
+    // Blocks of the dead process are freed, the shared one is still referenced by this process
+    ASSERT_EQ(pool.reclaim_dead_processes(), test::TEST_NUMBER);
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS - 1);
+    ASSERT_EQ(pool.reclaim_dead_processes(), 0u);
+
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_EQ(pool.free_blocks(), test::N_BLOCKS);
+
+    Payload released_payload;
+    ASSERT_FALSE(pool.get_payload_from_offset(offset, test::DATA_SIZE, released_payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,460 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/efficiency/payload/SlabPayloadPool.hpp>
+
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+const constexpr unsigned int TEST_NUMBER = 5;
+const constexpr unsigned int TEST_THREADS = 4;
+const constexpr size_t DEFAULT_SIZE = sizeof(PayloadUnit);
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+namespace test {
+
+/**
+ * @brief Mock over SlabPayloadPool implementing public access to private variables.
+ */
+class MockSlabPayloadPool : public SlabPayloadPool
+{
+public:
+
+    using SlabPayloadPool::SlabPayloadPool;
+
+    uint64_t pointers_stored()
+    {
+        return reserve_count_ - release_count_;
+    }
+
+    uint64_t reservoir_bytes()
+    {
+        std::lock_guard<std::mutex> lock(reservoir_mutex_);
+        return reservoir_bytes_;
+    }
+
+    size_t thread_caches_registered()
+    {
+        std::lock_guard<std::mutex> lock(thread_caches_mutex_);
+        return thread_caches_registered_.size();
+    }
+
+    void release_all(
+            std::vector<Payload>& payloads)
+    {
+        for (auto& payload : payloads)
+        {
+            release_payload(payload);
+        }
+    }
+
+};
+
+} /* namespace test */
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+/**
+ * Test get_payload method for new changes
+ *
+ * CASES:
+ *  Get N different pointers
+ *  Get a payload bigger than the greatest size class
+ *  fail reserve memory
+ */
+TEST(SlabPayloadPoolTest, get_payload)
+{
+    // Get N different pointers
+    {
+        test::MockSlabPayloadPool pool;
+        std::vector<Payload> payloads(TEST_NUMBER);
+
+        for (unsigned int i = 0; i < TEST_NUMBER; i++)
+        {
+            ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payloads[i]));
+
+            ASSERT_EQ(payloads[i].max_size, DEFAULT_SIZE);
+            ASSERT_EQ(pool.pointers_stored(), i + 1);
+
+            for (unsigned int j = 0; j < i; j++)
+            {
+                ASSERT_NE(payloads[i].data, payloads[j].data);
+            }
+        }
+
+        // END : Clean all remaining payloads
+        pool.release_all(payloads);
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    // Get a payload bigger than the greatest size class
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+        uint32_t size = (1u << SlabPayloadPool::MAX_SIZE_CLASS_SHIFT) + 1;
+
+        ASSERT_TRUE(pool.get_payload(size, payload));
+        ASSERT_EQ(payload.max_size, size);
+
+        // Write the whole payload to check it is allocated
+        std::memset(payload.data, 0xAB, size);
+
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_TRUE(pool.is_clean());
+    }
+
+    // fail reserve memory
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+
+        ASSERT_FALSE(pool.get_payload(0, payload));
+    }
+}
+
+/**
+ * Check to get_payload from a source that has been created in same pool increase references,
+ * and from a different pool copies the data.
+ *
+ * STEPS:
+ *  get payload0
+ *  get payload1 from src payload0
+ *  get payload2 from src payload0 in a different pool
+ *  release all
+ */
+TEST(SlabPayloadPoolTest, get_payload_from_src)
+{
+    eprosima::fastrtps::rtps::IPayloadPool* pool = new test::MockSlabPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockSlabPayloadPool* pool_ = static_cast<test::MockSlabPayloadPool*>(pool);
+    test::MockSlabPayloadPool pool_aux;
+
+    Payload payload0;
+    Payload payload1;
+    Payload payload2;
+
+    // get payload0
+    ASSERT_TRUE(pool_->get_payload(DEFAULT_SIZE, payload0));
+    std::memset(payload0.data, 0x42, DEFAULT_SIZE);
+    payload0.length = DEFAULT_SIZE;
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+
+    // get payload1 from src payload0
+    ASSERT_TRUE(pool_->get_payload(payload0, pool, payload1));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+    ASSERT_EQ(payload1.data, payload0.data);
+
+    // get payload2 from src payload0 in a different pool
+    ASSERT_TRUE(pool_aux.get_payload(payload0, pool, payload2));
+    ASSERT_EQ(pool_aux.pointers_stored(), 1u);
+    ASSERT_NE(payload2.data, payload0.data);
+    ASSERT_EQ(std::memcmp(payload2.data, payload0.data, DEFAULT_SIZE), 0);
+
+    // release all
+    ASSERT_TRUE(pool_->release_payload(payload0));
+    ASSERT_EQ(pool_->pointers_stored(), 1u);
+    ASSERT_TRUE(pool_->release_payload(payload1));
+    ASSERT_TRUE(pool_aux.release_payload(payload2));
+
+    ASSERT_TRUE(pool_->is_clean());
+    ASSERT_TRUE(pool_aux.is_clean());
+
+    delete pool;
+}
+
+/**
+ * Check that released blocks are reused for payloads of the same size class
+ *
+ * CASES:
+ *  Same size
+ *  Different size in same size class
+ *  Different size class
+ */
+TEST(SlabPayloadPoolTest, reuse_released_payload)
+{
+    // Same size
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+        auto data = payload.data;
+        ASSERT_TRUE(pool.release_payload(payload));
+
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+        ASSERT_EQ(payload.data, data);
+        ASSERT_TRUE(pool.release_payload(payload));
+    }
+
+    // Different size in same size class
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload;
+
+        ASSERT_TRUE(pool.get_payload(1000, payload));
+        auto data = payload.data;
+        ASSERT_TRUE(pool.release_payload(payload));
+
+        ASSERT_TRUE(pool.get_payload(1024, payload));
+        ASSERT_EQ(payload.data, data);
+        ASSERT_EQ(payload.max_size, 1024u);
+        ASSERT_TRUE(pool.release_payload(payload));
+    }
+
+    // Different size class
+    {
+        test::MockSlabPayloadPool pool;
+        Payload payload_small;
+        Payload payload_big;
+
+        ASSERT_TRUE(pool.get_payload(1024, payload_small));
+        auto data = payload_small.data;
+        ASSERT_TRUE(pool.release_payload(payload_small));
+
+        ASSERT_TRUE(pool.get_payload(1025, payload_big));
+        ASSERT_NE(payload_big.data, data);
+
+        // Block of the small class is still cached and can be reused
+        ASSERT_TRUE(pool.get_payload(1024, payload_small));
+        ASSERT_EQ(payload_small.data, data);
+
+        ASSERT_TRUE(pool.release_payload(payload_small));
+        ASSERT_TRUE(pool.release_payload(payload_big));
+    }
+}
+
+/**
+ * Check that blocks that do not fit in the thread cache go to the reservoir, and are reused from other threads.
+ *
+ * STEPS:
+ *  create pool with no thread cache
+ *  get payload and release it
+ *  check it is in the reservoir
+ *  get payload from a different thread and check it is the one in the reservoir
+ */
+TEST(SlabPayloadPoolTest, reservoir)
+{
+    // create pool with no thread cache
+    test::MockSlabPayloadPool pool(0);
+    Payload payload;
+
+    // get payload and release it
+    ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+    auto data = payload.data;
+    ASSERT_TRUE(pool.release_payload(payload));
+
+    // check it is in the reservoir
+    ASSERT_EQ(pool.reservoir_bytes(), 1u << SlabPayloadPool::MIN_SIZE_CLASS_SHIFT);
+
+    // get payload from a different thread and check it is the one in the reservoir
+    std::thread thread(
+        [&pool, &payload]()
+        {
+            pool.get_payload(DEFAULT_SIZE, payload);
+        });
+    thread.join();
+
+    ASSERT_EQ(payload.data, data);
+    ASSERT_EQ(pool.reservoir_bytes(), 0u);
+
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * Check that blocks released in a thread other than the one that reserved them go back to the reservoir in
+ * batches, without waiting for the thread cache to be full.
+ *
+ * STEPS:
+ *  reserve 2 * THREAD_CACHE_TRANSFER_BLOCKS + 1 payloads
+ *  release them from a different thread and check a batch of them is in the reservoir
+ *  check the rest are moved to the reservoir when that thread finishes
+ *  reserve again and check a batch is taken from the reservoir at once
+ */
+TEST(SlabPayloadPoolTest, cross_thread_batches)
+{
+    const uint64_t block_bytes = 1u << SlabPayloadPool::MIN_SIZE_CLASS_SHIFT;
+    const unsigned int n_payloads = 2 * SlabPayloadPool::THREAD_CACHE_TRANSFER_BLOCKS + 1;
+
+    test::MockSlabPayloadPool pool;
+
+    // reserve 2 * THREAD_CACHE_TRANSFER_BLOCKS + 1 payloads
+    std::vector<Payload> payloads(n_payloads);
+    for (auto& payload : payloads)
+    {
+        ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+    }
+
+    // release them from a different thread and check a batch of them is in the reservoir
+    uint64_t reservoir_bytes_before_finishing = 0;
+    std::thread thread(
+        [&pool, &payloads, &reservoir_bytes_before_finishing]()
+        {
+            pool.release_all(payloads);
+            reservoir_bytes_before_finishing = pool.reservoir_bytes();
+        });
+    thread.join();
+
+    ASSERT_EQ(reservoir_bytes_before_finishing, SlabPayloadPool::THREAD_CACHE_TRANSFER_BLOCKS * block_bytes);
+
+    // check the rest are moved to the reservoir when that thread finishes
+    ASSERT_EQ(pool.reservoir_bytes(), n_payloads * block_bytes);
+
+    // reserve again and check a batch is taken from the reservoir at once
+    Payload payload;
+    ASSERT_TRUE(pool.get_payload(DEFAULT_SIZE, payload));
+    ASSERT_EQ(pool.reservoir_bytes(), (n_payloads - SlabPayloadPool::THREAD_CACHE_TRANSFER_BLOCKS) * block_bytes);
+
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_TRUE(pool.is_clean());
+}
+
+/**
+ * Check that destroying a pool frees the blocks cached by threads that are still running.
+ *
+ * STEPS:
+ *  release payloads in a different thread that keeps running
+ *  check the cache of that thread is registered in the pool
+ *  destroy the pool while the thread is running
+ *  let the thread finish and use a new pool (it must not touch the destroyed one)
+ */
+TEST(SlabPayloadPoolTest, destroy_with_thread_caches)
+{
+    auto pool = std::make_unique<test::MockSlabPayloadPool>();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool released = false;
+    bool pool_destroyed = false;
+
+    std::vector<Payload> payloads(TEST_NUMBER);
+    for (auto& payload : payloads)
+    {
+        ASSERT_TRUE(pool->get_payload(DEFAULT_SIZE, payload));
+    }
+
+    // release payloads in a different thread that keeps running
+    std::thread thread(
+        [&]()
+        {
+            pool->release_all(payloads);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            released = true;
+            cv.notify_all();
+            cv.wait(lock, [&pool_destroyed]()
+            {
+                return pool_destroyed;
+            });
+            lock.unlock();
+
+            // use a new pool (it must not touch the destroyed one)
+            test::MockSlabPayloadPool other_pool;
+            Payload payload;
+            other_pool.get_payload(DEFAULT_SIZE, payload);
+            other_pool.release_payload(payload);
+        });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&released]()
+        {
+            return released;
+        });
+    }
+
+    // check the cache of that thread is registered in the pool (and the one of this thread)
+    ASSERT_EQ(pool->thread_caches_registered(), 2u);
+    ASSERT_TRUE(pool->is_clean());
+
+    // destroy the pool while the thread is running
+    pool.reset();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pool_destroyed = true;
+    }
+    cv.notify_all();
+
+    thread.join();
+}
+
+/**
+ * Get and release payloads from several threads at the same time, sharing payloads between them.
+ */
+TEST(SlabPayloadPoolTest, multithread)
+{
+    eprosima::fastrtps::rtps::IPayloadPool* pool = new test::MockSlabPayloadPool(); // Requires to be ptr to pass it to get_payload
+    test::MockSlabPayloadPool* pool_ = static_cast<test::MockSlabPayloadPool*>(pool);
+
+    // Payloads shared by every thread
+    std::vector<Payload> shared_payloads(TEST_NUMBER);
+    for (unsigned int i = 0; i < TEST_NUMBER; i++)
+    {
+        ASSERT_TRUE(pool_->get_payload(DEFAULT_SIZE << i, shared_payloads[i]));
+    }
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < TEST_THREADS; t++)
+    {
+        threads.emplace_back(
+            [pool, pool_, &shared_payloads]()
+            {
+                eprosima::fastrtps::rtps::IPayloadPool* data_owner = pool;
+                for (unsigned int iteration = 0; iteration < 100; iteration++)
+                {
+                    std::vector<Payload> payloads(TEST_NUMBER * 2);
+                    for (unsigned int i = 0; i < TEST_NUMBER; i++)
+                    {
+                        // New payload
+                        pool_->get_payload(DEFAULT_SIZE << i, payloads[i]);
+                        // Reference to shared payload
+                        pool_->get_payload(shared_payloads[i], data_owner, payloads[TEST_NUMBER + i]);
+                    }
+                    pool_->release_all(payloads);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    pool_->release_all(shared_payloads);
+    ASSERT_TRUE(pool_->is_clean());
+
+    delete pool;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
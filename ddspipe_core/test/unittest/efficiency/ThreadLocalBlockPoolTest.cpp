@@ -0,0 +1,121 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/memory/ThreadLocalBlockPool.hpp>
+
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const std::size_t BLOCK_SIZE = 200;
+constexpr const std::size_t MAX_CACHED_BLOCKS = 8;
+constexpr const unsigned int TEST_THREADS = 4;
+
+using TestPool = ThreadLocalBlockPool<BLOCK_SIZE, MAX_CACHED_BLOCKS>;
+
+} // test
+
+/**
+ * A released block is reused by the next allocation in the same thread.
+ */
+TEST(ThreadLocalBlockPoolTest, reuse_released_block)
+{
+    void* block = test::TestPool::allocate();
+    ASSERT_NE(block, nullptr);
+    std::memset(block, 0, test::BLOCK_SIZE);
+
+    test::TestPool::release(block);
+    ASSERT_EQ(test::TestPool::cached_blocks(), 1u);
+
+    void* reused_block = test::TestPool::allocate();
+    ASSERT_EQ(reused_block, block);
+    ASSERT_EQ(test::TestPool::cached_blocks(), 0u);
+
+    test::TestPool::release(reused_block);
+}
+
+/**
+ * The cache of a thread never keeps more than MAX_CACHED_BLOCKS blocks.
+ */
+TEST(ThreadLocalBlockPoolTest, cache_limit)
+{
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < test::MAX_CACHED_BLOCKS * 2; i++)
+    {
+        blocks.push_back(test::TestPool::allocate());
+    }
+
+    for (void* block : blocks)
+    {
+        test::TestPool::release(block);
+    }
+
+    ASSERT_EQ(test::TestPool::cached_blocks(), test::MAX_CACHED_BLOCKS);
+}
+
+/**
+ * Blocks allocated in one thread can be released in another one, and each thread keeps its own cache.
+ */
+TEST(ThreadLocalBlockPoolTest, multithread)
+{
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < test::MAX_CACHED_BLOCKS; i++)
+    {
+        blocks.push_back(test::TestPool::allocate());
+    }
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < test::TEST_THREADS; t++)
+    {
+        threads.emplace_back(
+            [t, &blocks]()
+            {
+                // Each thread starts with an empty cache
+                if (t == 0)
+                {
+                    for (void* block : blocks)
+                    {
+                        test::TestPool::release(block);
+                    }
+                }
+
+                for (unsigned int iteration = 0; iteration < 1000; iteration++)
+                {
+                    void* block = test::TestPool::allocate();
+                    std::memset(block, t, test::BLOCK_SIZE);
+                    test::TestPool::release(block);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,316 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/thread_pool/task/TaskId.hpp>
+
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/thread_pool_factory.hpp>
+#include <ddspipe_core/efficiency/thread_pool/WorkStealingThreadPool.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 4;
+constexpr const unsigned int N_EMISSIONS = 10000;
+constexpr const std::chrono::seconds TIMEOUT(5);
+
+//! Counter that can be waited until it reaches a value
+class WaitableCounter
+{
+public:
+
+    void increment()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            value_++;
+        }
+        cv_.notify_all();
+    }
+
+    bool wait_for_value(
+            unsigned int value)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, TIMEOUT, [this, value]()
+                       {
+                           return value_ >= value;
+                       });
+    }
+
+    unsigned int value()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return value_;
+    }
+
+private:
+
+    unsigned int value_ = 0;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+} // test
+
+/**
+ * Emit a task many times from outside the pool and check that it is executed once per emission.
+ */
+TEST(WorkStealingThreadPoolTest, execute_every_emission)
+{
+    test::WaitableCounter counter;
+
+    WorkStealingThreadPool pool(test::N_THREADS);
+    pool.enable();
+
+    utils::TaskId task_id = utils::new_unique_task_id();
+    pool.slot(task_id, [&counter]()
+            {
+                counter.increment();
+            });
+
+    for (unsigned int i = 0; i < test::N_EMISSIONS; i++)
+    {
+        pool.emit(task_id);
+    }
+
+    ASSERT_TRUE(counter.wait_for_value(test::N_EMISSIONS));
+
+    pool.disable();
+    ASSERT_EQ(counter.value(), test::N_EMISSIONS);
+}
+
+/**
+ * Emit tasks before enabling the pool and check that they are executed once it is enabled.
+ */
+TEST(WorkStealingThreadPoolTest, emitted_before_enable)
+{
+    test::WaitableCounter counter;
+
+    WorkStealingThreadPool pool(test::N_THREADS);
+
+    utils::TaskId task_id = utils::new_unique_task_id();
+    pool.slot(task_id, [&counter]()
+            {
+                counter.increment();
+            });
+
+    for (unsigned int i = 0; i < test::N_THREADS * 2; i++)
+    {
+        pool.emit(task_id);
+    }
+
+    pool.enable();
+    ASSERT_TRUE(counter.wait_for_value(test::N_THREADS * 2));
+}
+
+/**
+ * A task emitted from a thread of the pool is queued in its own queue.
+ * Check that another thread steals it while the first one is still busy.
+ */
+TEST(WorkStealingThreadPoolTest, steal_from_busy_thread)
+{
+    test::WaitableCounter stolen;
+    std::atomic<bool> stolen_while_busy(false);
+
+    WorkStealingThreadPool pool(2);
+    pool.enable();
+
+    utils::TaskId stolen_task_id = utils::new_unique_task_id();
+    pool.slot(stolen_task_id, [&stolen]()
+            {
+                stolen.increment();
+            });
+
+    utils::TaskId busy_task_id = utils::new_unique_task_id();
+    pool.slot(busy_task_id, [&]()
+            {
+                pool.emit(stolen_task_id);
+
+                // Keep this thread busy until the other thread executes the task
+                stolen_while_busy = stolen.wait_for_value(1);
+            });
+
+    pool.emit(busy_task_id);
+
+    ASSERT_TRUE(stolen.wait_for_value(1));
+    pool.disable();
+    ASSERT_TRUE(stolen_while_busy);
+}
+
+/**
+ * A task that emits itself again in every execution (as a Track yielding its thread) must not prevent
+ * other tasks from being executed, even with a single thread.
+ */
+TEST(WorkStealingThreadPoolTest, reemitted_task_does_not_starve_others)
+{
+    std::atomic<bool> stop(false);
+    test::WaitableCounter busy_turns;
+    test::WaitableCounter other;
+
+    WorkStealingThreadPool pool(1, 10);
+    ASSERT_EQ(pool.messages_per_turn(), 10u);
+
+    utils::TaskId busy_task_id = utils::new_unique_task_id();
+    pool.slot(busy_task_id, [&]()
+            {
+                busy_turns.increment();
+                if (!stop)
+                {
+                    pool.emit(busy_task_id);
+                }
+            });
+
+    utils::TaskId other_task_id = utils::new_unique_task_id();
+    pool.slot(other_task_id, [&other]()
+            {
+                other.increment();
+            });
+
+    pool.enable();
+    pool.emit(busy_task_id);
+    ASSERT_TRUE(busy_turns.wait_for_value(100));
+
+    pool.emit(other_task_id);
+    ASSERT_TRUE(other.wait_for_value(1));
+
+    stop = true;
+    pool.disable();
+}
+
+/**
+ * Enable a pool with its threads pinned to CPU cores and check that tasks are executed.
+ */
+TEST(WorkStealingThreadPoolTest, cpu_pinning)
+{
+    test::WaitableCounter counter;
+
+    WorkStealingThreadPool pool(test::N_THREADS, 0, true);
+    pool.enable();
+
+    utils::TaskId task_id = utils::new_unique_task_id();
+    pool.slot(task_id, [&counter]()
+            {
+                counter.increment();
+            });
+
+    for (unsigned int i = 0; i < test::N_THREADS * 10; i++)
+    {
+        pool.emit(task_id);
+    }
+
+    ASSERT_TRUE(counter.wait_for_value(test::N_THREADS * 10));
+}
+
+/**
+ * Remove a slot from every kind of thread pool and check that its task is released and not executed again.
+ */
+TEST(WorkStealingThreadPoolTest, unslot)
+{
+    ThreadPoolConfiguration configuration;
+    configuration.n_threads = 1;
+
+    for (ThreadPoolKind kind : {ThreadPoolKind::fifo, ThreadPoolKind::work_stealing, ThreadPoolKind::priority})
+    {
+        configuration.kind = kind;
+        auto pool = create_thread_pool(configuration);
+        pool->enable();
+
+        test::WaitableCounter counter;
+        test::WaitableCounter marker;
+        auto token = std::make_shared<int>(0);
+
+        utils::TaskId task_id = utils::new_unique_task_id();
+        pool->slot(task_id, [&counter, token]()
+                {
+                    counter.increment();
+                });
+
+        utils::TaskId marker_id = utils::new_unique_task_id();
+        pool->slot(marker_id, [&marker]()
+                {
+                    marker.increment();
+                });
+
+        // With a single thread, the marker is executed after the task has finished
+        pool->emit(task_id);
+        pool->emit(marker_id);
+        ASSERT_TRUE(marker.wait_for_value(1));
+        ASSERT_EQ(counter.value(), 1u);
+
+        pool->unslot(task_id);
+        ASSERT_EQ(token.use_count(), 1);
+
+        pool->emit(task_id);
+        pool->emit(marker_id);
+        ASSERT_TRUE(marker.wait_for_value(2));
+        ASSERT_EQ(counter.value(), 1u);
+
+        pool->disable();
+    }
+}
+
+/**
+ * Check that the factory creates the thread pool of the kind configured, and rejects invalid configurations.
+ */
+TEST(WorkStealingThreadPoolTest, factory)
+{
+    ThreadPoolConfiguration configuration;
+    configuration.n_threads = 2;
+    configuration.messages_per_turn = 5;
+
+    // Default kind
+    {
+        auto pool = create_thread_pool(configuration);
+        ASSERT_NE(std::dynamic_pointer_cast<FifoThreadPool>(pool), nullptr);
+        ASSERT_EQ(pool->messages_per_turn(), 5u);
+        ASSERT_TRUE(pool->metrics().empty());
+    }
+
+    // Work stealing with pinning
+    {
+        configuration.kind = ThreadPoolKind::work_stealing;
+        configuration.cpu_pinning = true;
+        auto pool = create_thread_pool(configuration);
+        ASSERT_NE(std::dynamic_pointer_cast<WorkStealingThreadPool>(pool), nullptr);
+        ASSERT_EQ(pool->messages_per_turn(), 5u);
+        ASSERT_TRUE(pool->metrics().empty());
+    }
+
+    // Pinning not available in FIFO
+    {
+        configuration.kind = ThreadPoolKind::fifo;
+        ASSERT_THROW(create_thread_pool(configuration), utils::ConfigurationException);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,180 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/metrics/LatencyHistogram.hpp>
+
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const unsigned int TEST_THREADS = 4;
+constexpr const unsigned int VALUES_PER_THREAD = 10000;
+
+} // test
+
+/**
+ * Check that every bucket index is valid and its lower bound is the lowest value counted in it.
+ *
+ * CASES:
+ *  small values have a bucket each
+ *  lower bound of each bucket is in the bucket, and the previous value is not
+ *  huge values go to the last bucket
+ */
+TEST(LatencyHistogramTest, bucket_index)
+{
+    // small values have a bucket each
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKETS; value++)
+    {
+        ASSERT_EQ(LatencyHistogram::bucket_index(value), value);
+    }
+
+    // lower bound of each bucket is in the bucket, and the previous value is not
+    for (unsigned int index = 1; index < LatencyHistogram::N_BUCKETS; index++)
+    {
+        uint64_t lower_bound = LatencyHistogram::bucket_lower_bound(index);
+        ASSERT_EQ(LatencyHistogram::bucket_index(lower_bound), index);
+        ASSERT_EQ(LatencyHistogram::bucket_index(lower_bound - 1), index - 1);
+    }
+
+    // huge values go to the last bucket
+    ASSERT_EQ(LatencyHistogram::bucket_index(UINT64_MAX), LatencyHistogram::N_BUCKETS - 1);
+}
+
+/**
+ * Check that the lower bound of the bucket of a value is never further than 1 / SUB_BUCKETS from the value.
+ */
+TEST(LatencyHistogramTest, relative_error)
+{
+    for (uint64_t value = 1; value < (uint64_t(1) << 40); value = value * 3 + 7)
+    {
+        uint64_t lower_bound = LatencyHistogram::bucket_lower_bound(LatencyHistogram::bucket_index(value));
+        ASSERT_LE(lower_bound, value);
+        ASSERT_LE(static_cast<double>(value - lower_bound) / value, 1.0 / LatencyHistogram::SUB_BUCKETS) << value;
+    }
+}
+
+/**
+ * Check count, sum, min and max of a snapshot.
+ *
+ * CASES:
+ *  empty histogram
+ *  histogram with values
+ */
+TEST(LatencyHistogramTest, snapshot)
+{
+    LatencyHistogram histogram;
+
+    // empty histogram
+    {
+        LatencyHistogramSnapshot snapshot = histogram.snapshot();
+        ASSERT_EQ(snapshot.count, 0u);
+        ASSERT_EQ(snapshot.min, 0u);
+        ASSERT_EQ(snapshot.max, 0u);
+        ASSERT_EQ(snapshot.mean(), 0);
+        ASSERT_EQ(snapshot.percentile(50), 0u);
+        ASSERT_EQ(snapshot.buckets.size(), LatencyHistogram::N_BUCKETS);
+    }
+
+    // histogram with values
+    {
+        histogram.record(1000);
+        histogram.record(10);
+        histogram.record(100000);
+
+        LatencyHistogramSnapshot snapshot = histogram.snapshot();
+        ASSERT_EQ(snapshot.count, 3u);
+        ASSERT_EQ(snapshot.sum, 101010u);
+        ASSERT_EQ(snapshot.min, 10u);
+        ASSERT_EQ(snapshot.max, 100000u);
+        ASSERT_EQ(snapshot.buckets[LatencyHistogram::bucket_index(1000)], 1u);
+    }
+}
+
+/**
+ * Record values 1..N and check main percentiles are within the histogram precision.
+ */
+TEST(LatencyHistogramTest, percentile)
+{
+    LatencyHistogram histogram;
+    const uint64_t n_values = 100000;
+
+    for (uint64_t value = 1; value <= n_values; value++)
+    {
+        histogram.record(value);
+    }
+
+    LatencyHistogramSnapshot snapshot = histogram.snapshot();
+    const double precision = 1.0 / LatencyHistogram::SUB_BUCKETS;
+
+    for (double percentile : {1.0, 50.0, 90.0, 99.0, 99.9})
+    {
+        double expected = percentile * n_values / 100.0;
+        double result = static_cast<double>(snapshot.percentile(percentile));
+        ASSERT_NEAR(result, expected, expected * precision) << percentile;
+    }
+
+    ASSERT_EQ(snapshot.percentile(100), n_values);
+}
+
+/**
+ * Record values from several threads at the same time and check that none is lost.
+ */
+TEST(LatencyHistogramTest, multithread)
+{
+    LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < test::TEST_THREADS; t++)
+    {
+        threads.emplace_back(
+            [&histogram, t]()
+            {
+                for (unsigned int i = 1; i <= test::VALUES_PER_THREAD; i++)
+                {
+                    histogram.record(i * (t + 1));
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    LatencyHistogramSnapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, test::TEST_THREADS * test::VALUES_PER_THREAD);
+    ASSERT_EQ(snapshot.min, 1u);
+    ASSERT_EQ(snapshot.max, test::TEST_THREADS * test::VALUES_PER_THREAD);
+
+    uint64_t total = 0;
+    for (uint64_t bucket : snapshot.buckets)
+    {
+        total += bucket;
+    }
+    ASSERT_EQ(total, snapshot.count);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/metrics/RpcMetrics.hpp>
+
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const int64_t MS = 1000000;
+
+//! Times of a request received at 1 s and sent \c bridge_ms later
+RpcRequestTimestamps request(
+        int64_t bridge_ms)
+{
+    RpcRequestTimestamps result;
+    result.received_ns = 1000 * MS;
+    result.sent_ns = result.received_ns + bridge_ms * MS;
+    return result;
+}
+
+} // test
+
+/**
+ * Record the replies of several requests and check the latencies recorded.
+ *
+ * CASES:
+ *  bridge latency adds the time of the request and the time of the reply in the bridge
+ *  server round trip is the time from the request sent until the reply received
+ */
+TEST(RpcMetricsTest, record_reply)
+{
+    RpcMetrics metrics;
+
+    for (int64_t i = 1; i <= 10; i++)
+    {
+        RpcRequestTimestamps request = test::request(i);
+        int64_t reply_received_ns = request.sent_ns + 100 * test::MS;
+        metrics.record_reply(request, reply_received_ns, reply_received_ns + i * test::MS);
+    }
+
+    RpcMetricsSnapshot snapshot = metrics.snapshot();
+
+    ASSERT_EQ(snapshot.bridge_latency.count, 10u);
+    ASSERT_EQ(snapshot.bridge_latency.min, static_cast<uint64_t>(2 * test::MS));
+    ASSERT_EQ(snapshot.bridge_latency.max, static_cast<uint64_t>(20 * test::MS));
+
+    ASSERT_EQ(snapshot.server_round_trip.count, 10u);
+    ASSERT_EQ(snapshot.server_round_trip.min, static_cast<uint64_t>(100 * test::MS));
+    ASSERT_EQ(snapshot.server_round_trip.max, static_cast<uint64_t>(100 * test::MS));
+}
+
+/**
+ * Check that latencies whose times are not set are not recorded.
+ *
+ * CASES:
+ *  request without times
+ *  request without reception time: only the round trip is recorded
+ */
+TEST(RpcMetricsTest, ignore_unset_timestamps)
+{
+    RpcMetrics metrics;
+
+    metrics.record_reply(RpcRequestTimestamps(), 2000 * test::MS, 2001 * test::MS);
+
+    RpcRequestTimestamps request = test::request(1);
+    request.received_ns = 0;
+    metrics.record_reply(request, request.sent_ns + 5 * test::MS, request.sent_ns + 6 * test::MS);
+
+    RpcMetricsSnapshot snapshot = metrics.snapshot();
+    ASSERT_EQ(snapshot.bridge_latency.count, 0u);
+    ASSERT_EQ(snapshot.server_round_trip.count, 1u);
+    ASSERT_EQ(snapshot.server_round_trip.min, static_cast<uint64_t>(5 * test::MS));
+}
+
+/**
+ * Check that latencies with times out of order (e.g. clock adjusted meanwhile) are not recorded.
+ *
+ * CASES:
+ *  reply received before the request is sent
+ *  reply sent before it is received
+ */
+TEST(RpcMetricsTest, ignore_unordered_timestamps)
+{
+    RpcMetrics metrics;
+    RpcRequestTimestamps request = test::request(1);
+
+    metrics.record_reply(request, request.sent_ns - test::MS, request.sent_ns);
+    metrics.record_reply(request, request.sent_ns + test::MS, request.sent_ns);
+
+    RpcMetricsSnapshot snapshot = metrics.snapshot();
+    ASSERT_EQ(snapshot.bridge_latency.count, 0u);
+    ASSERT_EQ(snapshot.server_round_trip.count, 1u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
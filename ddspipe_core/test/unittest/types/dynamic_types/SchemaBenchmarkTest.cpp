@@ -0,0 +1,176 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/file/file_utils.hpp>
+
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+#include <fastrtps/types/TypeObject.h>
+
+#include <ddspipe_core/types/dynamic_types/schema.hpp>
+
+#include "types/all_types.hpp"
+
+using namespace eprosima;
+
+namespace test {
+
+constexpr const unsigned int ITERATIONS = 1000;
+
+const std::vector<SupportedType> TYPES_TO_TEST = {
+    SupportedType::hello_world,
+    SupportedType::numeric_array,
+    SupportedType::char_sequence,
+    SupportedType::basic_struct,
+    SupportedType::basic_array_struct,
+    SupportedType::float_bounded_sequence,
+    SupportedType::arrays_and_sequences,
+    SupportedType::complex_nested_arrays,
+    SupportedType::enum_struct,
+    SupportedType::union_struct,
+    SupportedType::map_struct
+};
+
+/**
+ * @brief Generate the schema of every type in \c types \c ITERATIONS times.
+ *
+ * Every schema generated must be equal to the one of the same index in \c expected_schemas .
+ *
+ * @param clear_cache whether to clear the schema cache before every iteration, so nothing is reused.
+ *
+ * @return nanoseconds per generated schema
+ */
+double run_schema_workload(
+        const std::vector<fastrtps::types::DynamicType_ptr>& types,
+        const std::vector<std::string>& expected_schemas,
+        bool clear_cache)
+{
+    unsigned int mismatches = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < ITERATIONS; i++)
+    {
+        if (clear_cache)
+        {
+            ddspipe::core::types::clear_idl_schema_cache();
+        }
+
+        for (std::size_t t = 0; t < types.size(); t++)
+        {
+            if (ddspipe::core::types::generate_idl_schema(types[t]) != expected_schemas[t])
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(mismatches, 0u);
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() /
+           (static_cast<double>(ITERATIONS) * types.size());
+}
+
+//! Struct \c type_name with an int32 member for each name in \c member_names
+fastrtps::types::DynamicType_ptr build_struct(
+        const std::string& type_name,
+        const std::vector<std::string>& member_names)
+{
+    fastrtps::types::DynamicTypeBuilderFactory* factory = fastrtps::types::DynamicTypeBuilderFactory::get_instance();
+
+    fastrtps::types::DynamicTypeBuilder_ptr builder = factory->create_struct_builder();
+    for (std::size_t i = 0; i < member_names.size(); i++)
+    {
+        builder->add_member(static_cast<uint32_t>(i), member_names[i], factory->create_int32_type());
+    }
+    builder->set_name(type_name);
+
+    return builder->build();
+}
+
+} // namespace test
+
+/**
+ * Compare the generation of the schemas of every IDL in types/idls with the schema cache cleared on every
+ * iteration and with the schema cache kept.
+ *
+ * It prints the time per schema of each run.
+ * Timing depends on the machine, so it only asserts that every schema generated in both runs is the expected IDL.
+ */
+TEST(SchemaBenchmarkTest, idl_schema_generation)
+{
+    std::vector<fastrtps::types::DynamicType_ptr> types;
+    std::vector<std::string> expected_schemas;
+
+    for (const auto& type : test::TYPES_TO_TEST)
+    {
+        types.push_back(test::get_dynamic_type(type));
+
+        std::string file_name = std::string("types/idls/") + test::to_string(type) + ".idl";
+        expected_schemas.push_back(utils::file_to_string(file_name.c_str()));
+    }
+
+    double uncached_ns = test::run_schema_workload(types, expected_schemas, true);
+    double cached_ns = test::run_schema_workload(types, expected_schemas, false);
+
+    std::cout << "types | uncached ns/schema | cached ns/schema" << std::endl;
+    std::cout << types.size() << " | " << uncached_ns << " | " << cached_ns << std::endl;
+}
+
+/**
+ * Generate the schemas of two different definitions of a type with the same name, with the first one registered in
+ * the TypeObjectFactory, and check that each schema matches its own definition.
+ */
+TEST(SchemaBenchmarkTest, redefined_type_schema)
+{
+    fastrtps::types::DynamicType_ptr first_type = test::build_struct("RedefinedType", {"first_member"});
+
+    // Register the first definition, as a participant discovering it would
+    fastrtps::types::TypeObject first_object;
+    fastrtps::types::DynamicTypeBuilderFactory::get_instance()->build_type_object(first_type, first_object);
+
+    std::string first_schema = ddspipe::core::types::generate_idl_schema(first_type);
+    ASSERT_NE(first_schema.find("first_member"), std::string::npos);
+    ASSERT_EQ(first_schema.find("second_member"), std::string::npos);
+
+    fastrtps::types::DynamicType_ptr second_type =
+            test::build_struct("RedefinedType", {"first_member", "second_member"});
+
+    std::string second_schema = ddspipe::core::types::generate_idl_schema(second_type);
+    ASSERT_NE(second_schema.find("first_member"), std::string::npos);
+    ASSERT_NE(second_schema.find("second_member"), std::string::npos);
+
+    // The fragment of the first definition is still used for it
+    ASSERT_EQ(ddspipe::core::types::generate_idl_schema(first_type), first_schema);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
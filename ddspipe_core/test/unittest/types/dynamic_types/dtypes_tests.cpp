@@ -63,6 +63,9 @@ void execute_test_by_type(
 
     // Compare schemas
     compare_schemas(idl_file, schema);
+
+    // Generate it again, now from the cached type definitions
+    compare_schemas(idl_file, ddspipe::core::types::generate_idl_schema(dyn_type));
 }
 
 } // namespace test
@@ -77,6 +77,45 @@ TEST(EndpointTest, is_reader_writer)
     }
 }
 
+/**
+ * Test \c SpecificEndpointQoS \c hash method
+ *
+ * CASES:
+ *  Equal QoS have equal hashes
+ *  Partitions split differently have different hashes
+ *  Different ownership strength have different hashes
+ */
+TEST(EndpointTest, specific_qos_hash)
+{
+    SpecificEndpointQoS qos;
+    qos.partitions.push_back("ab");
+    qos.ownership_strength.value = 5;
+
+    // Equal QoS
+    {
+        SpecificEndpointQoS other = qos;
+        ASSERT_EQ(other, qos);
+        ASSERT_EQ(other.hash(), qos.hash());
+        ASSERT_NE(qos.hash(), 0u);
+    }
+
+    // Partitions split differently
+    {
+        SpecificEndpointQoS other;
+        other.partitions.push_back("a");
+        other.partitions.push_back("b");
+        other.ownership_strength.value = 5;
+        ASSERT_NE(other.hash(), qos.hash());
+    }
+
+    // Different ownership strength
+    {
+        SpecificEndpointQoS other = qos;
+        other.ownership_strength.value = 6;
+        ASSERT_NE(other.hash(), qos.hash());
+    }
+}
+
 int main(
         int argc,
         char** argv)
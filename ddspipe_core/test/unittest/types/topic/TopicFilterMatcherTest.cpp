@@ -0,0 +1,214 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/topic/filter/TopicFilterMatcher.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+using namespace eprosima::ddspipe::core::types;
+
+using pair_topic_type = std::pair<std::string, std::string>;
+
+namespace test {
+
+//! Patterns of the filters, an empty string means the name is not set
+const std::vector<pair_topic_type> FILTERS = {
+    {"topic", "type"},
+    {"topic", ""},
+    {"", "std::*"},
+    {"rt/*", "*"},
+    {"*topic", "type?"},
+    {"*/*/status", ""},
+    {"a*b*c", "*"},
+    {"??", "?*?"},
+    {"*", "*_"},
+    {"sensor_[0-9]", "type"},
+    {"Rt/Chat*", "Type"},
+};
+
+//! Topics to check
+const std::vector<pair_topic_type> TOPICS = {
+    {"topic", "type"},
+    {"topic", "other"},
+    {"topic1", "type"},
+    {"std_topic", "type1"},
+    {"std_topic", "type12"},
+    {"rt/topic", "type"},
+    {"rt", "type"},
+    {"any", "std::string"},
+    {"robot/arm/status", "status"},
+    {"robot/status", "status"},
+    {"abc", "x"},
+    {"aXbYc", "x"},
+    {"acb", "x"},
+    {"ab", "xy"},
+    {"ab", "x"},
+    {"a", "xy"},
+    {"type_", "type_"},
+    {"sensor_1", "type"},
+    {"sensor_a", "type"},
+    {"", ""},
+    {"rt/chatter", "type"},
+    {"RT/CHATTER", "TYPE"},
+};
+
+utils::Heritable<IFilterTopic> filter(
+        const pair_topic_type& names)
+{
+    auto new_filter = utils::Heritable<WildcardDdsFilterTopic>::make_heritable();
+    if (!names.first.empty())
+    {
+        new_filter->topic_name = names.first;
+    }
+    if (!names.second.empty())
+    {
+        new_filter->type_name = names.second;
+    }
+    return new_filter;
+}
+
+DdsTopic topic(
+        const pair_topic_type& names)
+{
+    DdsTopic new_topic;
+    new_topic.m_topic_name = names.first;
+    new_topic.type_name = names.second;
+    return new_topic;
+}
+
+} // test
+
+/**
+ * Test that a matcher without filters does not match any topic
+ */
+TEST(TopicFilterMatcherTest, empty)
+{
+    TopicFilterMatcher matcher;
+    ASSERT_TRUE(matcher.empty());
+
+    TopicFilterMatcher compiled_matcher(std::set<utils::Heritable<IFilterTopic>>{});
+    ASSERT_TRUE(compiled_matcher.empty());
+
+    for (const auto& names : test::TOPICS)
+    {
+        ASSERT_FALSE(matcher.matches(test::topic(names)));
+        ASSERT_FALSE(compiled_matcher.matches(test::topic(names)));
+    }
+}
+
+/**
+ * Test that a matcher of a single filter gives the same result as the filter for every topic
+ */
+TEST(TopicFilterMatcherTest, matches_as_each_filter)
+{
+    for (const auto& filter_names : test::FILTERS)
+    {
+        auto filter = test::filter(filter_names);
+        TopicFilterMatcher matcher({filter});
+        ASSERT_FALSE(matcher.empty());
+
+        for (const auto& topic_names : test::TOPICS)
+        {
+            DdsTopic topic = test::topic(topic_names);
+            ASSERT_EQ(matcher.matches(topic), filter->matches(topic))
+                << "filter: " << filter << " ; topic: " << topic;
+        }
+    }
+}
+
+/**
+ * Test that a matcher of every filter matches a topic if and only if any filter matches it
+ */
+TEST(TopicFilterMatcherTest, matches_as_any_filter)
+{
+    std::set<utils::Heritable<IFilterTopic>> filters;
+    for (const auto& filter_names : test::FILTERS)
+    {
+        filters.insert(test::filter(filter_names));
+    }
+
+    TopicFilterMatcher matcher(filters);
+
+    for (const auto& topic_names : test::TOPICS)
+    {
+        DdsTopic topic = test::topic(topic_names);
+
+        bool expected = false;
+        for (const auto& filter : filters)
+        {
+            expected = expected || filter->matches(topic);
+        }
+
+        ASSERT_EQ(matcher.matches(topic), expected) << "topic: " << topic;
+    }
+}
+
+/**
+ * Test that the prefixes of the topic names are the literal part of each pattern before the first wildcard,
+ * without the prefixes that start with another one, and that they are not given if any topic name may match
+ */
+TEST(TopicFilterMatcherTest, topic_name_prefixes)
+{
+    // Prefixes of literal names and patterns
+    {
+        std::set<utils::Heritable<IFilterTopic>> filters = {
+            test::filter({"rt/chatter", ""}),
+            test::filter({"rt/chat*", "type"}),
+            test::filter({"sensor_[0-9]", ""}),
+            test::filter({"sensor_?", ""}),
+            test::filter({"topic", "type"}),
+        };
+
+        TopicFilterMatcher matcher(filters);
+
+        std::set<std::string> prefixes;
+#if defined(_WIN32)
+        // Names are matched case insensitively, so they do not start with the prefix of the patterns
+        ASSERT_FALSE(matcher.topic_name_prefixes(prefixes));
+#else
+        ASSERT_TRUE(matcher.topic_name_prefixes(prefixes));
+
+        std::set<std::string> expected = {"rt/chat", "sensor_", "topic"};
+        ASSERT_EQ(prefixes, expected);
+#endif // if defined(_WIN32)
+    }
+
+    // Pattern starting with a wildcard
+    {
+        TopicFilterMatcher matcher({test::filter({"topic", ""}), test::filter({"*topic", ""})});
+
+        std::set<std::string> prefixes;
+        ASSERT_FALSE(matcher.topic_name_prefixes(prefixes));
+    }
+
+    // Filter without topic name
+    {
+        TopicFilterMatcher matcher({test::filter({"topic", ""}), test::filter({"", "type"})});
+
+        std::set<std::string> prefixes;
+        ASSERT_FALSE(matcher.topic_name_prefixes(prefixes));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <ddspipe_core/types/dds/CustomTransport.hpp>
 #include <ddspipe_core/types/dds/DomainId.hpp>
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
@@ -56,6 +58,9 @@ public:
     core::types::TransportDescriptors transport {core::types::TransportDescriptors::builtin};
 
     core::types::IgnoreParticipantFlags ignore_participant_flags {core::types::IgnoreParticipantFlags::no_filter};
+
+    //! File where the types discovered are cached between executions (only DynTypesParticipant, empty for none)
+    std::string type_cache_file {};
 };
 
 } /* namespace participants */
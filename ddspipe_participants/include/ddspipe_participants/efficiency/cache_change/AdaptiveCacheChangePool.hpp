@@ -0,0 +1,127 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/history/IChangePool.h>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+/**
+ * @brief Pool of CacheChanges that grows and shrinks with the number of changes in use.
+ *
+ * It starts with \c initial_size changes reserved and creates a new one whenever none is free, as long as there are
+ * less than \c maximum_size changes in use (0 for no limit).
+ *
+ * When a change is released, the free changes exceeding twice the peak of changes in use of the last operations
+ * (and \c initial_size ) are destroyed, so the memory reserved follows the backlog of the history.
+ */
+class AdaptiveCacheChangePool : public fastrtps::rtps::IChangePool
+{
+public:
+
+    /**
+     * @brief Construct a new AdaptiveCacheChangePool.
+     *
+     * @param initial_size number of changes reserved at creation, and kept reserved at least
+     * @param maximum_size maximum number of changes in use at the same time (0 for no limit)
+     * @param router_cache_changes whether the changes are \c RouterCacheChange (required by repeater writers)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    AdaptiveCacheChangePool(
+            unsigned int initial_size,
+            unsigned int maximum_size = 0,
+            bool router_cache_changes = false);
+
+    //! Destroy every change reserved (every change must have been released before)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    ~AdaptiveCacheChangePool();
+
+    //! Take a free change, or create a new one if there is none. False if \c maximum_size changes are in use.
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool reserve_cache(
+            fastrtps::rtps::CacheChange_t*& cache_change) override;
+
+    //! Return a change to the pool, and destroy free changes exceeding the recent needs
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool release_cache(
+            fastrtps::rtps::CacheChange_t* cache_change) override;
+
+    //! Number of changes currently reserved (in use or free). Lock-free.
+    DDSPIPE_PARTICIPANTS_DllAPI
+    uint64_t reserved() const noexcept;
+
+    //! Size in bytes of each change of the pool (payloads excluded)
+    DDSPIPE_PARTICIPANTS_DllAPI
+    uint64_t element_size() const noexcept;
+
+    //! Number of operations after which the peak of changes in use of the oldest operations is forgotten
+    static constexpr unsigned int PEAK_WINDOW = 1024;
+
+protected:
+
+    //! Create a new change of the kind of the pool
+    fastrtps::rtps::CacheChange_t* new_element_() const;
+
+    //! Destroy a change created by \c new_element_
+    void delete_element_(
+            fastrtps::rtps::CacheChange_t* cache_change) const noexcept;
+
+    //! Count an operation, and move to a new window of operations if the current one is complete
+    void count_operation_nts_() noexcept;
+
+    //! Changes kept reserved at least
+    const unsigned int initial_size_;
+
+    //! Changes in use at most (0 for no limit)
+    const unsigned int maximum_size_;
+
+    //! Whether the changes are \c RouterCacheChange
+    const bool router_cache_changes_;
+
+    //! Changes reserved and not in use
+    std::vector<fastrtps::rtps::CacheChange_t*> free_;
+
+    //! Changes currently in use
+    uint64_t in_use_;
+
+    //! Peak of changes in use in the current window of operations
+    uint64_t window_peak_;
+
+    //! Peak of changes in use in the previous window of operations
+    uint64_t previous_window_peak_;
+
+    //! Operations done in the current window
+    unsigned int window_operations_;
+
+    //! Changes currently reserved (in use or free), readable without taking \c mutex_
+    std::atomic<uint64_t> reserved_;
+
+    //! Guards every other attribute
+    std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -80,6 +80,9 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual bool is_repeater() const noexcept override;
 
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool reports_discovery() const noexcept override;
+
     /**
      * @brief Create a writer object
      *
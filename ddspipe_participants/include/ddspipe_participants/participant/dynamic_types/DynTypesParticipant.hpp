@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantListener.hpp>
 
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/participant/dynamic_types/TypeObjectCache.hpp>
 #include <ddspipe_participants/participant/rtps/SimpleParticipant.hpp>
 #include <ddspipe_participants/reader/auxiliar/InternalReader.hpp>
 
@@ -34,6 +38,9 @@ namespace participants {
  * This is an abomination Participant that is a Simple RTPS Participant with a built-in DDS Participant.
  * The DDS Part that is only used to read type objects and type lookup services.
  *
+ * If a type cache file is configured, the types discovered are stored in it and registered again at \c init ,
+ * so after a restart the types are available without waiting for the type lookup service.
+ *
  * TODO: separate these 2 participants
  */
 class DynTypesParticipant : public rtps::SimpleParticipant, public eprosima::fastdds::dds::DomainParticipantListener
@@ -50,6 +57,7 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     ~DynTypesParticipant();
 
+    //! Register the types of the type cache (if any) and create the internal DDS Participant
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual void init() override;
 
@@ -94,10 +102,35 @@ protected:
 
     void initialize_internal_dds_participant_();
 
+    /**
+     * Get from the \c TypeObjectFactory the identifier and object of type \c type_name (complete, or minimal if not
+     * found) that match \c type_information .
+     *
+     * @return whether they have been found
+     */
+    bool find_type_object_(
+            const std::string& type_name,
+            const eprosima::fastrtps::types::TypeInformation* type_information,
+            const eprosima::fastrtps::types::TypeIdentifier*& type_identifier,
+            const eprosima::fastrtps::types::TypeObject*& type_object) const;
+
+    /**
+     * Store type \c type_name of the \c TypeObjectFactory , and the types it depends on, in the type cache (if any).
+     *
+     * The type object stored is the one of the identifiers in \c type_information , or the one registered with
+     * \c type_name if no \c type_information is given.
+     */
+    void cache_type_object_(
+            const std::string& type_name,
+            const eprosima::fastrtps::types::TypeInformation* type_information);
+
     eprosima::fastdds::dds::DomainParticipant* dds_participant_;
 
     //! Type Object Internal Reader
     std::shared_ptr<InternalReader> type_object_reader_;
+
+    //! Persistent cache of the types discovered (nullptr if not configured)
+    std::unique_ptr<TypeObjectCache> type_cache_;
 };
 
 } /* namespace participants */
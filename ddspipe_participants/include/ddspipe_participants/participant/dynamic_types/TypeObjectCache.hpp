@@ -0,0 +1,152 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeObjectCache.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fastrtps/types/TypeIdentifier.h>
+#include <fastrtps/types/TypeObject.h>
+
+#include <ddspipe_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * @brief Persistent cache of the type objects discovered, so they are available right away after a restart.
+ *
+ * Each type is stored in a file as a record with its name and its \c TypeIdentifier and \c TypeObject serialized
+ * in CDR. The identifier of a hashed type holds the hash of its definition, so a type is stored again if its
+ * definition changes. The types a type depends on (e.g. the structs of its members) are stored as records of their
+ * own, so every type needed to build it is registered when loaded.
+ *
+ * Records are appended when stored, and the whole file is read when loaded. A record truncated (e.g. the process
+ * was killed while storing it) and every record after it are ignored.
+ *
+ * Thread safe.
+ */
+class TypeObjectCache
+{
+public:
+
+    /**
+     * @brief Construct a new TypeObjectCache.
+     *
+     * @param file_path file where the types are stored (created when the first type is stored)
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    TypeObjectCache(
+            const std::string& file_path);
+
+    /**
+     * @brief Read the types of the file and register them in the \c TypeObjectFactory .
+     *
+     * If the file ends in a truncated or unreadable record, it is cut after the last valid one, so the types
+     * stored afterwards can be read.
+     *
+     * @return number of types registered
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    unsigned int load();
+
+    /**
+     * @brief Append a type to the file, unless it is already stored with the same identifier.
+     *
+     * @return whether the type has been stored
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool store(
+            const std::string& type_name,
+            const eprosima::fastrtps::types::TypeIdentifier& identifier,
+            const eprosima::fastrtps::types::TypeObject& object);
+
+    /**
+     * @brief Append a type and every type it depends on, unless they are already stored with the same identifier.
+     *
+     * The types it depends on are taken from the \c TypeObjectFactory , where the type lookup registers them when
+     * resolving a remote type. The ones not registered are skipped.
+     *
+     * @return number of types stored
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    unsigned int store_with_dependencies(
+            const std::string& type_name,
+            const eprosima::fastrtps::types::TypeIdentifier& identifier,
+            const eprosima::fastrtps::types::TypeObject& object);
+
+    //! Number of types (by name and kind of identifier) loaded or stored
+    DDSPIPE_PARTICIPANTS_DllAPI
+    std::size_t size() const;
+
+    /**
+     * @brief Whether \c identifier is the identifier of the same kind (complete or minimal) in \c type_information .
+     *
+     * A type information without identifier of that kind does not invalidate it.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    static bool is_valid(
+            const eprosima::fastrtps::types::TypeIdentifier& identifier,
+            const eprosima::fastrtps::types::TypeInformation& type_information);
+
+    //! First bytes of a cache file
+    static constexpr const char* FILE_MAGIC = "DDSPIPE_TYPES";
+
+    //! Version of the format of the records
+    static constexpr uint32_t FILE_VERSION = 1;
+
+protected:
+
+    //! Key of a type: its name and the kind of its identifier (complete or minimal)
+    using TypeKey = std::pair<std::string, uint8_t>;
+
+    //! Identifiers of every type \c identifier depends on (directly or through other types) in the factory
+    static std::vector<eprosima::fastrtps::types::TypeIdentifier> dependencies_(
+            const eprosima::fastrtps::types::TypeIdentifier& identifier);
+
+    /**
+     * @brief Parse the records in \c content and register them.
+     *
+     * @param [in] content : whole content of the file
+     * @param [out] valid_size : bytes of \c content up to the end of the last valid record (all if not a cache)
+     *
+     * @return number of types registered
+     */
+    unsigned int load_records_(
+            const std::vector<char>& content,
+            std::size_t& valid_size);
+
+    //! File where the types are stored
+    const std::string file_path_;
+
+    //! Identifier of each type stored (or loaded)
+    std::map<TypeKey, eprosima::fastrtps::types::TypeIdentifier> identifiers_;
+
+    //! Guards \c identifiers_ and the file
+    mutable std::mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -92,6 +92,10 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual bool is_rtps_kind() const noexcept override;
 
+    //! Override parent method \c reports_discovery , as every endpoint discovered is added to the database.
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual bool reports_discovery() const noexcept override;
+
     /**
      * @brief Create a writer object
      *
@@ -21,6 +21,7 @@
 #include <ddspipe_core/interface/IReader.hpp>
 #include <ddspipe_core/interface/ITopic.hpp>
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/metrics/PaddedCounter.hpp>
 
 #include <ddspipe_participants/library/library_dll.h>
 
@@ -115,6 +116,23 @@ public:
     utils::ReturnCode take(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Override take_batch() IReader method
+     *
+     * This method calls the protected method \c take_batch_nts_ to make the actual take function.
+     * It only manages the enable/disable status.
+     *
+     * Thread safe with mutex \c mutex_ (taken once for the whole batch).
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_batch(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
+
+    //! Override rejected_samples() IReader method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    uint64_t rejected_samples() const noexcept override;
+
     /////////////////////////
     // AUXILIARY METHODS
     /////////////////////////
@@ -197,6 +215,16 @@ protected:
     virtual utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept = 0;
 
+    /**
+     * @brief Take up to \c max_samples samples
+     *
+     * By default it calls \c take_nts_ until \c max_samples are taken or it does not return OK.
+     * Override this method in Readers that could take the whole batch in a cheaper way.
+     */
+    virtual utils::ReturnCode take_batch_nts_(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept;
+
     /////////////////////////
     // INTERNAL VARIABLES
     /////////////////////////
@@ -213,6 +241,9 @@ protected:
     //! Whether the Reader is currently enabled
     std::atomic<bool> enabled_;
 
+    //! Samples discarded before being taken. Increase it from subclasses whenever a sample is rejected.
+    core::PaddedCounter rejected_samples_;
+
     //! Mutex that guards every access to the Reader
     mutable std::recursive_mutex mutex_;
 
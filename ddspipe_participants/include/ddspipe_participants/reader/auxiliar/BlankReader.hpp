@@ -53,6 +53,16 @@ public:
     utils::ReturnCode take(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    //! Override take_batch() IReader method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode take_batch(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
+
+    //! Override rejected_samples() IReader method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    uint64_t rejected_samples() const noexcept override;
+
     /////////////////////////
     // RPC REQUIRED METHODS
     /////////////////////////
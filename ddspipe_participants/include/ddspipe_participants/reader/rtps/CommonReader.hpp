@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include <cpp_utils/time/time_utils.hpp>
@@ -81,6 +82,14 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     void init();
 
+    /**
+     * @brief Override \c history_metrics() IReader method
+     *
+     * The reserved changes are the highest history size reached, as the pool of the history never releases them.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    core::HistoryMetricsSnapshot history_metrics() const noexcept override;
+
     /////////////////////////
     // RTPS LISTENER METHODS
     /////////////////////////
@@ -239,6 +248,19 @@ protected:
     virtual utils::ReturnCode take_nts_(
             std::unique_ptr<core::IRoutingData>& data) noexcept override;
 
+    /**
+     * @brief Take up to \c max_samples changes from the internal RTPS Reader
+     *
+     * Same as \c take_nts_ but holding the RTPS Reader mutex during the whole batch, so the reception of new
+     * changes does not interleave with each sample taken.
+     *
+     * @note guard by mutex \c rtps_mutex_
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode take_batch_nts_(
+            unsigned int max_samples,
+            std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
+
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual void enable_nts_() noexcept override;
 
@@ -306,6 +328,9 @@ protected:
     //! RTPS Reader History associated to \c rtps_reader_
     fastrtps::rtps::ReaderHistory* rtps_history_;
 
+    //! Highest size reached by \c rtps_history_
+    std::atomic<uint64_t> history_peak_;
+
     //! History attributes to create the History for the internal RTPS Reader.
     fastrtps::rtps::HistoryAttributes history_attributes_;
 
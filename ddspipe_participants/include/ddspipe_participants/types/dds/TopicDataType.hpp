@@ -15,6 +15,7 @@
 #pragma once
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastrtps/config.h>
 
 #include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
@@ -22,6 +23,18 @@
 
 #include <ddspipe_participants/library/library_dll.h>
 
+/**
+ * Whether Fast DDS DataWriters and DataReaders accept an external payload pool (Fast DDS 2.11 onwards).
+ *
+ * If so, the DDS participants create their entities with the \c PayloadPool of the pipe, so the payloads are
+ * loaned between the pipe and Fast DDS instead of copied (see \c TopicDataType ).
+ */
+#if FASTRTPS_VERSION_MAJOR > 2 || (FASTRTPS_VERSION_MAJOR == 2 && FASTRTPS_VERSION_MINOR >= 11)
+#define DDSPIPE_DDS_PAYLOAD_POOL_LOANS 1
+#else
+#define DDSPIPE_DDS_PAYLOAD_POOL_LOANS 0
+#endif // if FASTRTPS_VERSION_MAJOR > 2 || (FASTRTPS_VERSION_MAJOR == 2 && FASTRTPS_VERSION_MINOR >= 11)
+
 namespace eprosima {
 namespace ddspipe {
 namespace participants {
@@ -29,6 +42,19 @@ namespace dds {
 
 using DataType = core::types::RtpsPayloadData;
 
+/**
+ * @brief Type support of the DDS participants, that moves the serialized payloads as they are.
+ *
+ * With \c DDSPIPE_DDS_PAYLOAD_POOL_LOANS , every DataWriter and DataReader of this type reserves its payloads in
+ * \c payload_pool :
+ * - \c serialize references the payload of the data in the DataWriter history, instead of copying it.
+ * - \c deserialize references the payload of the DataReader history in the data, instead of copying it.
+ *
+ * A payload is only loaned if Fast DDS records that it belongs to \c payload_pool (payloads of other pools, as with
+ * data sharing, are copied). Versions of Fast DDS that do not record the pool of each payload always copy them.
+ *
+ * Without \c DDSPIPE_DDS_PAYLOAD_POOL_LOANS , each payload is copied from (or to) the histories of Fast DDS.
+ */
 class TopicDataType : public eprosima::fastdds::dds::TopicDataType
 {
 public:
@@ -87,6 +87,18 @@ public:
     virtual utils::ReturnCode write(
             core::IRoutingData& data) noexcept override;
 
+    /**
+     * @brief Override write_batch() IWriter method
+     *
+     * This method calls the protected method \c write_batch_nts_ to make the actual write function.
+     * It only manages the enable/disable status.
+     *
+     * Thread safe with mutex \c mutex_ (taken once for the whole batch).
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode write_batch(
+            const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
+
 protected:
 
     /////////////////////////
@@ -130,6 +142,16 @@ protected:
     virtual utils::ReturnCode write_nts_(
             core::IRoutingData& data) noexcept  = 0;
 
+    /**
+     * @brief Write every sample in \c data
+     *
+     * By default it calls \c write_nts_ for every sample, and returns the last error found (if any).
+     * Override this method in Writers that could write the whole batch in a cheaper way.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode write_batch_nts_(
+            const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept;
+
     /////////////////////////
     // INTERNAL VARIABLES
     /////////////////////////
@@ -42,6 +42,11 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     utils::ReturnCode write(
             core::IRoutingData& data) noexcept override;
+
+    //! Override write_batch() IWriter method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    utils::ReturnCode write_batch(
+            const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
 };
 
 } /* namespace participants */
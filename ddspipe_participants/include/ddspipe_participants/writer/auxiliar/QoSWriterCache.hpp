@@ -0,0 +1,116 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include <ddspipe_core/types/dds/SpecificEndpointQoS.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+/**
+ * @brief Lock-free lookup of the QoS specific Writers of a MultiWriter, by the hash of their QoS.
+ *
+ * It is an open addressing table with linear probing and a fixed capacity.
+ * Lookups do not take any lock, so the Tracks writing in a MultiWriter do not contend with each other.
+ * Insertions must be serialized by the user (the MultiWriter inserts while holding its exclusive lock, only
+ * when a new Writer is created). Entries are never removed, so a lookup never sees an entry being destroyed.
+ *
+ * When the table is 3/4 full, insertions are refused and the user must fall back to its own map.
+ *
+ * @tparam Writer type of the QoS specific Writers
+ */
+template <typename Writer>
+class QoSWriterCache
+{
+public:
+
+    //! Default number of slots
+    static constexpr unsigned int DEFAULT_CAPACITY = 64;
+
+    /**
+     * @brief Construct a new empty QoSWriterCache.
+     *
+     * @param capacity number of slots, rounded up to a power of 2
+     */
+    QoSWriterCache(
+            unsigned int capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Writer of QoS \c qos , without locking.
+     *
+     * @param hash \c qos.hash()
+     * @param qos  QoS of the Writer
+     *
+     * @return the Writer, or nullptr if it is not in the cache
+     */
+    Writer* find(
+            std::size_t hash,
+            const core::types::SpecificEndpointQoS& qos) const noexcept;
+
+    /**
+     * @brief Add the Writer of QoS \c qos .
+     *
+     * @param hash   \c qos.hash() (never 0)
+     * @param qos    QoS of the Writer. It is referenced, so it must outlive this object (e.g. a key of a map).
+     * @param writer Writer to add
+     *
+     * @return whether it has been added (false if the cache is full)
+     *
+     * @warning Insertions must not be concurrent with each other (lookups may be concurrent with them).
+     */
+    bool insert(
+            std::size_t hash,
+            const core::types::SpecificEndpointQoS& qos,
+            Writer* writer) noexcept;
+
+    //! Number of Writers in the cache
+    unsigned int size() const noexcept;
+
+protected:
+
+    //! Entry of the table, published by setting its \c hash
+    struct Slot
+    {
+        //! Hash of the QoS (0 while the slot is empty)
+        std::atomic<std::size_t> hash{0};
+
+        //! QoS of the Writer (owned by the user)
+        const core::types::SpecificEndpointQoS* qos{nullptr};
+
+        //! Writer of the QoS
+        Writer* writer{nullptr};
+    };
+
+    //! Number of slots (power of 2)
+    const unsigned int capacity_;
+
+    //! Slots of the table
+    std::unique_ptr<Slot[]> slots_;
+
+    //! Number of slots used
+    std::atomic<unsigned int> size_;
+};
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <ddspipe_participants/writer/auxiliar/impl/QoSWriterCache.ipp>
@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+namespace detail {
+
+//! Smallest power of 2 not lower than \c value
+inline unsigned int next_power_of_two(
+        unsigned int value) noexcept
+{
+    unsigned int result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+} /* namespace detail */
+
+template <typename Writer>
+constexpr unsigned int QoSWriterCache<Writer>::DEFAULT_CAPACITY;
+
+template <typename Writer>
+QoSWriterCache<Writer>::QoSWriterCache(
+        unsigned int capacity /* = DEFAULT_CAPACITY */)
+    : capacity_(detail::next_power_of_two(capacity > 0 ? capacity : 1))
+    , slots_(new Slot[capacity_])
+    , size_(0)
+{
+}
+
+template <typename Writer>
+Writer* QoSWriterCache<Writer>::find(
+        std::size_t hash,
+        const core::types::SpecificEndpointQoS& qos) const noexcept
+{
+    for (unsigned int i = 0; i < capacity_; ++i)
+    {
+        const Slot& slot = slots_[(hash + i) & (capacity_ - 1)];
+
+        // Acquire, so the qos and writer of the slot are visible once its hash is
+        std::size_t slot_hash = slot.hash.load(std::memory_order_acquire);
+        if (slot_hash == 0)
+        {
+            return nullptr;
+        }
+
+        if (slot_hash == hash && *slot.qos == qos)
+        {
+            return slot.writer;
+        }
+    }
+
+    return nullptr;
+}
+
+template <typename Writer>
+bool QoSWriterCache<Writer>::insert(
+        std::size_t hash,
+        const core::types::SpecificEndpointQoS& qos,
+        Writer* writer) noexcept
+{
+    // Keep some slots empty, so lookups of QoS not in the cache end soon
+    if ((size_ + 1) * 4 > capacity_ * 3)
+    {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < capacity_; ++i)
+    {
+        Slot& slot = slots_[(hash + i) & (capacity_ - 1)];
+
+        if (slot.hash.load(std::memory_order_relaxed) != 0)
+        {
+            continue;
+        }
+
+        slot.qos = &qos;
+        slot.writer = writer;
+
+        // Release, so lookups that see the hash see the qos and writer too
+        slot.hash.store(hash, std::memory_order_release);
+        size_++;
+        return true;
+    }
+
+    return false;
+}
+
+template <typename Writer>
+unsigned int QoSWriterCache<Writer>::size() const noexcept
+{
+    return size_;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
@@ -21,6 +21,7 @@
 
 #include <ddspipe_participants/library/library_dll.h>
 #include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+#include <ddspipe_participants/writer/auxiliar/QoSWriterCache.hpp>
 #include <ddspipe_participants/writer/dds/QoSSpecificWriter.hpp>
 
 namespace eprosima {
@@ -88,8 +89,18 @@ protected:
     // INTERNAL METHODS
     /////////////////////////
 
+    /**
+     * @brief Writer of QoS \c data_qos , created if it does not exist.
+     *
+     * It looks for it in \c writers_cache_ without locking, then in \c writers_map_ with a shared lock
+     * (only if the cache is full), and only takes the exclusive lock to create it.
+     *
+     * @param data_qos      QoS of the data to write
+     * @param data_qos_hash \c data_qos.hash()
+     */
     QoSSpecificWriter* get_writer_or_create_(
-            const core::types::SpecificEndpointQoS& data_qos);
+            const core::types::SpecificEndpointQoS& data_qos,
+            std::size_t data_qos_hash);
     QoSSpecificWriter* create_writer_nts_(
             const core::types::SpecificEndpointQoS& data_qos);
 
@@ -113,6 +124,9 @@ protected:
     //! Map of writer indexed by Specific QoS of each.
     WritersMapType writers_map_;
 
+    //! Lock-free lookup of the writers of \c writers_map_ by the hash of their QoS.
+    QoSWriterCache<QoSSpecificWriter> writers_cache_;
+
     const std::shared_ptr<core::PayloadPool>& payload_pool_;
 
     core::types::DdsTopic topic_;
@@ -30,6 +30,7 @@
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 #include <ddspipe_participants/library/library_dll.h>
+#include <ddspipe_participants/efficiency/cache_change/AdaptiveCacheChangePool.hpp>
 #include <ddspipe_participants/efficiency/cache_change/CacheChangePool.hpp>
 #include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
 
@@ -91,6 +92,19 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     void init();
 
+    /**
+     * @brief Override \c history_metrics() IWriter method
+     *
+     * With adaptive history the reserved changes are the ones of its pool.
+     * Otherwise, they are the highest history size reached, as the pool never releases its changes.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    core::HistoryMetricsSnapshot history_metrics() const noexcept override;
+
+    //! Override \c drop_oldest() IWriter method
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool drop_oldest() noexcept override;
+
     /////////////////////////
     // RTPS LISTENER METHODS
     /////////////////////////
@@ -108,6 +122,16 @@ public:
             fastrtps::rtps::RTPSWriter*,
             fastrtps::rtps::MatchingInfo& info) noexcept override;
 
+    /**
+     * @brief CommonWriter Listener callback when every matched Reader has acknowledged a change
+     *
+     * With adaptive history and volatile durability, the change is removed from the history.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    void onWriterChangeReceivedByAll(
+            fastrtps::rtps::RTPSWriter*,
+            fastrtps::rtps::CacheChange_t* change) noexcept override;
+
     /**
      * This method is called when a new Reader is discovered, with a Topic that
      * matches that of a local writer, but with a requested QoS that is incompatible
@@ -172,6 +196,20 @@ protected:
     virtual utils::ReturnCode write_nts_(
             core::IRoutingData& data) noexcept override;
 
+    /**
+     * @brief Write every sample in \c data
+     *
+     * Same as \c write_nts_ but holding the RTPS Writer mutex during the whole batch, so the history
+     * is locked once per batch and not once per sample.
+     *
+     * @param data : samples to write
+     * @return \c RETCODE_OK if every data has been correctly written
+     * @return \c RETCODE_ERROR if any error occurred
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    virtual utils::ReturnCode write_batch_nts_(
+            const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept override;
+
     /**
      * @brief Auxiliary method used in \c write to fill the cache change to send.
      *
@@ -264,6 +302,12 @@ protected:
     //! RTPS CommonWriter History associated to \c rtps_reader_
     fastrtps::rtps::WriterHistory* rtps_history_;
 
+    //! Pool of changes of \c rtps_history_ when the history is adaptive (nullptr otherwise)
+    std::shared_ptr<core::AdaptiveCacheChangePool> adaptive_pool_;
+
+    //! Highest size reached by \c rtps_history_
+    std::atomic<uint64_t> history_peak_;
+
     //! Data Filter used to filter cache changes at the RTPSWriter level.
     std::unique_ptr<fastdds::rtps::IReaderDataFilter> data_filter_;
 
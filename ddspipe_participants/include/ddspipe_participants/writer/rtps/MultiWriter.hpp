@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <cpp_utils/types/Atomicable.hpp>
 
 #include <ddspipe_core/types/participant/ParticipantId.hpp>
@@ -21,6 +23,7 @@
 
 #include <ddspipe_participants/library/library_dll.h>
 #include <ddspipe_participants/writer/auxiliar/BaseWriter.hpp>
+#include <ddspipe_participants/writer/auxiliar/QoSWriterCache.hpp>
 #include <ddspipe_participants/writer/rtps/QoSSpecificWriter.hpp>
 
 namespace eprosima {
@@ -69,6 +72,15 @@ public:
     DDSPIPE_PARTICIPANTS_DllAPI
     virtual ~MultiWriter();
 
+    /**
+     * @brief Override \c drop_oldest() IWriter method
+     *
+     * It removes the oldest sample of one of its internal writers, starting each call from the next one,
+     * so the histories of every QoS are reduced evenly.
+     */
+    DDSPIPE_PARTICIPANTS_DllAPI
+    bool drop_oldest() noexcept override;
+
 protected:
 
     //! Override specific enable to call enable in internal writers.
@@ -84,8 +96,18 @@ protected:
 
     bool exist_partition_(
             const core::types::SpecificEndpointQoS& data_qos);
+    /**
+     * @brief Writer of QoS \c data_qos , created if it does not exist.
+     *
+     * It looks for it in \c writers_cache_ without locking, then in \c writers_map_ with a shared lock
+     * (only if the cache is full), and only takes the exclusive lock to create it.
+     *
+     * @param data_qos      QoS of the data to write
+     * @param data_qos_hash \c data_qos.hash()
+     */
     QoSSpecificWriter* get_writer_or_create_(
-            const core::types::SpecificEndpointQoS& data_qos);
+            const core::types::SpecificEndpointQoS& data_qos,
+            std::size_t data_qos_hash);
     QoSSpecificWriter* create_writer_nts_(
             const core::types::SpecificEndpointQoS& data_qos);
 
@@ -97,6 +119,9 @@ protected:
     //! Map of writer indexed by Specific QoS of each.
     WritersMapType writers_map_;
 
+    //! Lock-free lookup of the writers of \c writers_map_ by the hash of their QoS.
+    QoSWriterCache<QoSSpecificWriter> writers_cache_;
+
     const std::shared_ptr<core::PayloadPool>& payload_pool_;
 
     core::types::DdsTopic topic_;
@@ -106,6 +131,9 @@ protected:
 
     //! Whether this Writer is a repeater.
     bool repeater_;
+
+    //! Internal writer to remove the next sample from in \c drop_oldest
+    std::atomic<std::size_t> next_drop_writer_{0};
 };
 
 } /* namespace rtps */
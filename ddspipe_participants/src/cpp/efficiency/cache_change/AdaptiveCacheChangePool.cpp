@@ -0,0 +1,173 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+
+#include <ddspipe_participants/efficiency/cache_change/AdaptiveCacheChangePool.hpp>
+#include <ddspipe_participants/types/dds/RouterCacheChange.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace core {
+
+constexpr unsigned int AdaptiveCacheChangePool::PEAK_WINDOW;
+
+AdaptiveCacheChangePool::AdaptiveCacheChangePool(
+        unsigned int initial_size,
+        unsigned int maximum_size /* = 0 */,
+        bool router_cache_changes /* = false */)
+    : initial_size_(initial_size)
+    , maximum_size_(maximum_size)
+    , router_cache_changes_(router_cache_changes)
+    , in_use_(0)
+    , window_peak_(0)
+    , previous_window_peak_(0)
+    , window_operations_(0)
+    , reserved_(0)
+{
+    free_.reserve(initial_size_);
+    for (unsigned int i = 0; i < initial_size_; i++)
+    {
+        free_.push_back(new_element_());
+    }
+    reserved_ = initial_size_;
+}
+
+AdaptiveCacheChangePool::~AdaptiveCacheChangePool()
+{
+    for (auto cache_change : free_)
+    {
+        delete_element_(cache_change);
+    }
+}
+
+bool AdaptiveCacheChangePool::reserve_cache(
+        fastrtps::rtps::CacheChange_t*& cache_change)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (maximum_size_ > 0 && in_use_ >= maximum_size_)
+    {
+        return false;
+    }
+
+    if (free_.empty())
+    {
+        cache_change = new_element_();
+        reserved_++;
+    }
+    else
+    {
+        cache_change = free_.back();
+        free_.pop_back();
+    }
+
+    in_use_++;
+    window_peak_ = std::max(window_peak_, in_use_);
+    count_operation_nts_();
+
+    return true;
+}
+
+bool AdaptiveCacheChangePool::release_cache(
+        fastrtps::rtps::CacheChange_t* cache_change)
+{
+    // Leave the change as new, so it can be reused
+    cache_change->kind = fastrtps::rtps::ALIVE;
+    cache_change->sequenceNumber = fastrtps::rtps::SequenceNumber_t();
+    cache_change->writerGUID = fastrtps::rtps::c_Guid_Unknown;
+    cache_change->instanceHandle = fastrtps::rtps::InstanceHandle_t();
+    cache_change->isRead = false;
+    cache_change->serializedPayload.length = 0;
+    cache_change->serializedPayload.pos = 0;
+    cache_change->setFragmentSize(0);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    in_use_--;
+    count_operation_nts_();
+
+    // Keep reserved twice the recent peak, so a backlog similar to the recent ones does not create changes
+    uint64_t to_keep = std::max<uint64_t>(initial_size_, 2 * std::max(window_peak_, previous_window_peak_));
+
+    if (in_use_ + free_.size() >= to_keep)
+    {
+        delete_element_(cache_change);
+        reserved_--;
+    }
+    else
+    {
+        free_.push_back(cache_change);
+    }
+
+    // Free changes left by a higher peak already forgotten
+    while (!free_.empty() && in_use_ + free_.size() > to_keep)
+    {
+        delete_element_(free_.back());
+        free_.pop_back();
+        reserved_--;
+    }
+
+    return true;
+}
+
+uint64_t AdaptiveCacheChangePool::reserved() const noexcept
+{
+    return reserved_.load(std::memory_order_relaxed);
+}
+
+uint64_t AdaptiveCacheChangePool::element_size() const noexcept
+{
+    return router_cache_changes_ ? sizeof(types::RouterCacheChange) : sizeof(fastrtps::rtps::CacheChange_t);
+}
+
+fastrtps::rtps::CacheChange_t* AdaptiveCacheChangePool::new_element_() const
+{
+    if (router_cache_changes_)
+    {
+        return new types::RouterCacheChange();
+    }
+
+    return new fastrtps::rtps::CacheChange_t();
+}
+
+void AdaptiveCacheChangePool::delete_element_(
+        fastrtps::rtps::CacheChange_t* cache_change) const noexcept
+{
+    if (router_cache_changes_)
+    {
+        delete static_cast<types::RouterCacheChange*>(cache_change);
+    }
+    else
+    {
+        delete cache_change;
+    }
+}
+
+void AdaptiveCacheChangePool::count_operation_nts_() noexcept
+{
+    if (++window_operations_ < PEAK_WINDOW)
+    {
+        return;
+    }
+
+    previous_window_peak_ = window_peak_;
+    window_peak_ = in_use_;
+    window_operations_ = 0;
+}
+
+} /* namespace core */
+} /* namespace ddspipe */
+} /* namespace eprosima */
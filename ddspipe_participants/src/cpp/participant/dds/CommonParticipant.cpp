@@ -111,6 +111,11 @@ bool CommonParticipant::is_repeater() const noexcept
     return false;
 }
 
+bool CommonParticipant::reports_discovery() const noexcept
+{
+    return true;
+}
+
 std::shared_ptr<core::IWriter> CommonParticipant::create_writer(
         const core::ITopic& topic)
 {
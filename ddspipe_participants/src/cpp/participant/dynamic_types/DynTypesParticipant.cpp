@@ -57,7 +57,10 @@ DynTypesParticipant::DynTypesParticipant(
     , type_object_reader_(std::make_shared<InternalReader>(
                 this->id()))
 {
-    // Do nothing
+    if (!participant_configuration->type_cache_file.empty())
+    {
+        type_cache_ = std::make_unique<TypeObjectCache>(participant_configuration->type_cache_file);
+    }
 }
 
 DynTypesParticipant::~DynTypesParticipant()
@@ -70,6 +73,13 @@ DynTypesParticipant::~DynTypesParticipant()
 void DynTypesParticipant::init()
 {
     CommonParticipant::init();
+
+    // Types registered before any type information is received, so they are built without type lookup
+    if (type_cache_)
+    {
+        type_cache_->load();
+    }
+
     initialize_internal_dds_participant_();
 }
 
@@ -106,6 +116,12 @@ void DynTypesParticipant::on_type_discovery(
         // Register type obj in singleton factory
         TypeObjectFactory::get_instance()->add_type_object(
             dyn_type->get_name(), identifier, object);
+
+        if (type_cache_ && identifier && object)
+        {
+            type_cache_->store_with_dependencies(dyn_type->get_name(), *identifier, *object);
+        }
+
         internal_notify_type_object_(dyn_type);
     }
 }
@@ -121,25 +137,8 @@ void DynTypesParticipant::on_type_information_received(
     const TypeObject* type_object = nullptr;
     DynamicType_ptr dynamic_type(nullptr);
 
-    // Check if complete identifier already present in factory
-    type_identifier = TypeObjectFactory::get_instance()->get_type_identifier(type_name_, true);
-    if (type_identifier)
-    {
-        type_object = TypeObjectFactory::get_instance()->get_type_object(type_name_, true);
-    }
-
-    // If complete not found, try with minimal
-    if (!type_object)
-    {
-        type_identifier = TypeObjectFactory::get_instance()->get_type_identifier(type_name_, false);
-        if (type_identifier)
-        {
-            type_object = TypeObjectFactory::get_instance()->get_type_object(type_name_, false);
-        }
-    }
-
-    // Build dynamic type if type identifier and object found in factory
-    if (type_identifier && type_object)
+    // Build dynamic type if type identifier and object found in factory (e.g. loaded from the type cache)
+    if (find_type_object_(type_name_, &type_information, type_identifier, type_object))
     {
         dynamic_type = TypeObjectFactory::get_instance()->build_dynamic_type(type_name_, type_identifier, type_object);
     }
@@ -148,9 +147,11 @@ void DynTypesParticipant::on_type_information_received(
     if (!dynamic_type)
     {
         std::function<void(const std::string&, const DynamicType_ptr)> callback(
-            [this]
-                (const std::string& /* type_name */, const DynamicType_ptr type)
+            [this, type_information]
+                (const std::string& remote_type_name, const DynamicType_ptr type)
             {
+                // Type objects received are registered in the factory, so they can be cached from there
+                this->cache_type_object_(remote_type_name, &type_information);
                 this->internal_notify_type_object_(type);
             });
         // Registering type and creating reader
@@ -161,10 +162,81 @@ void DynTypesParticipant::on_type_information_received(
     }
     else
     {
+        cache_type_object_(type_name_, &type_information);
         internal_notify_type_object_(dynamic_type);
     }
 }
 
+bool DynTypesParticipant::find_type_object_(
+        const std::string& type_name,
+        const TypeInformation* type_information,
+        const TypeIdentifier*& type_identifier,
+        const TypeObject*& type_object) const
+{
+    // Check complete identifier first, then minimal
+    for (bool complete : {true, false})
+    {
+        type_identifier = TypeObjectFactory::get_instance()->get_type_identifier(type_name, complete);
+        if (!type_identifier)
+        {
+            continue;
+        }
+
+        // A type with the same name but another definition (e.g. cached before the type changed) is not valid
+        if (type_information && !TypeObjectCache::is_valid(*type_identifier, *type_information))
+        {
+            logInfo(DDSPIPE_DYNTYPES_PARTICIPANT,
+                    "Participant " << this->id() << " ignoring type object " << type_name <<
+                    " registered with a definition different from the one discovered.");
+            continue;
+        }
+
+        type_object = TypeObjectFactory::get_instance()->get_type_object(type_name, complete);
+        if (type_object)
+        {
+            return true;
+        }
+    }
+
+    type_identifier = nullptr;
+    type_object = nullptr;
+    return false;
+}
+
+void DynTypesParticipant::cache_type_object_(
+        const std::string& type_name,
+        const TypeInformation* type_information)
+{
+    if (!type_cache_)
+    {
+        return;
+    }
+
+    if (type_information)
+    {
+        // Look up by identifier, as the factory keeps the first type registered with each name
+        for (const TypeIdentifier* type_identifier : {
+                    &type_information->complete().typeid_with_size().type_id(),
+                    &type_information->minimal().typeid_with_size().type_id()})
+        {
+            const TypeObject* type_object = TypeObjectFactory::get_instance()->get_type_object(type_identifier);
+            if (type_object)
+            {
+                type_cache_->store_with_dependencies(type_name, *type_identifier, *type_object);
+                return;
+            }
+        }
+    }
+
+    const TypeIdentifier* type_identifier = nullptr;
+    const TypeObject* type_object = nullptr;
+
+    if (find_type_object_(type_name, nullptr, type_identifier, type_object))
+    {
+        type_cache_->store_with_dependencies(type_name, *type_identifier, *type_object);
+    }
+}
+
 void DynTypesParticipant::internal_notify_type_object_(
         DynamicType_ptr dynamic_type)
 {
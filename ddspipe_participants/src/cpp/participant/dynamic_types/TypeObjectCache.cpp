@@ -0,0 +1,384 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TypeObjectCache.cpp
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/Exception.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/participant/dynamic_types/TypeObjectCache.hpp>
+
+namespace eprosima {
+namespace ddspipe {
+namespace participants {
+
+using namespace eprosima::fastrtps::types;
+
+constexpr const char* TypeObjectCache::FILE_MAGIC;
+constexpr uint32_t TypeObjectCache::FILE_VERSION;
+
+namespace {
+
+//! Append \c value in little endian, so files can be read in any platform
+void append_uint32(
+        std::vector<char>& buffer,
+        uint32_t value)
+{
+    for (unsigned int i = 0; i < sizeof(value); i++)
+    {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+//! Read a value appended with \c append_uint32 at \c position , advancing it. False if not enough bytes.
+bool read_uint32(
+        const std::vector<char>& buffer,
+        std::size_t& position,
+        uint32_t& value)
+{
+    if (buffer.size() - position < sizeof(value))
+    {
+        return false;
+    }
+
+    value = 0;
+    for (unsigned int i = 0; i < sizeof(value); i++)
+    {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(buffer[position + i])) << (8 * i);
+    }
+    position += sizeof(value);
+    return true;
+}
+
+//! Append \c size and \c size bytes of \c data
+void append_block(
+        std::vector<char>& buffer,
+        const char* data,
+        std::size_t size)
+{
+    append_uint32(buffer, static_cast<uint32_t>(size));
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+//! Read a block appended with \c append_block at \c position , advancing it. False if not enough bytes.
+bool read_block(
+        const std::vector<char>& buffer,
+        std::size_t& position,
+        const char*& data,
+        uint32_t& size)
+{
+    if (!read_uint32(buffer, position, size) || buffer.size() - position < size)
+    {
+        return false;
+    }
+
+    data = buffer.data() + position;
+    position += size;
+    return true;
+}
+
+//! Append \c value serialized in CDR (with encapsulation, so it is read in any endianness)
+template <typename T>
+void append_serialized(
+        std::vector<char>& buffer,
+        const T& value)
+{
+    eprosima::fastcdr::FastBuffer fast_buffer;
+    eprosima::fastcdr::Cdr cdr(fast_buffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+    cdr.serialize_encapsulation();
+    value.serialize(cdr);
+
+    append_block(buffer, fast_buffer.getBuffer(), cdr.getSerializedDataLength());
+}
+
+//! Deserialize \c value from a block appended with \c append_serialized . False if it is not valid.
+template <typename T>
+bool read_serialized(
+        const std::vector<char>& buffer,
+        std::size_t& position,
+        T& value)
+{
+    const char* data = nullptr;
+    uint32_t size = 0;
+    if (!read_block(buffer, position, data, size))
+    {
+        return false;
+    }
+
+    // Deserialization does not modify the buffer
+    eprosima::fastcdr::FastBuffer fast_buffer(const_cast<char*>(data), size);
+    eprosima::fastcdr::Cdr cdr(fast_buffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+    try
+    {
+        cdr.read_encapsulation();
+        value.deserialize(cdr);
+    }
+    catch (const eprosima::fastcdr::exception::Exception&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+TypeObjectCache::TypeObjectCache(
+        const std::string& file_path)
+    : file_path_(file_path)
+{
+}
+
+unsigned int TypeObjectCache::load()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::ifstream file(file_path_, std::ios::binary);
+    if (!file.is_open())
+    {
+        logInfo(DDSPIPE_TYPE_OBJECT_CACHE, "Type object cache " << file_path_ << " not found. Starting empty.");
+        return 0;
+    }
+
+    // The whole file is read at once, records are registered from memory
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    std::size_t valid_size = 0;
+    unsigned int loaded = load_records_(content, valid_size);
+    file.close();
+
+    // Records are appended, so anything after an invalid record must be removed for the new ones to be read
+    if (valid_size < content.size())
+    {
+        std::ofstream truncated(file_path_, std::ios::binary | std::ios::trunc);
+        truncated.write(content.data(), valid_size);
+        truncated.flush();
+
+        if (!truncated)
+        {
+            logWarning(DDSPIPE_TYPE_OBJECT_CACHE,
+                    "Error removing the invalid records of type object cache " << file_path_ << ".");
+        }
+    }
+
+    logInfo(DDSPIPE_TYPE_OBJECT_CACHE, "Loaded " << loaded << " type objects from cache " << file_path_ << ".");
+
+    return loaded;
+}
+
+bool TypeObjectCache::store(
+        const std::string& type_name,
+        const TypeIdentifier& identifier,
+        const TypeObject& object)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TypeKey key(type_name, identifier._d());
+    auto it = identifiers_.find(key);
+    if (it != identifiers_.end() && it->second == identifier)
+    {
+        return false;
+    }
+
+    std::vector<char> record;
+
+    // Header only in a new file
+    std::ifstream existing(file_path_, std::ios::binary | std::ios::ate);
+    if (!existing.is_open() || existing.tellg() <= 0)
+    {
+        record.insert(record.end(), FILE_MAGIC, FILE_MAGIC + std::strlen(FILE_MAGIC));
+        append_uint32(record, FILE_VERSION);
+    }
+    existing.close();
+
+    append_block(record, type_name.data(), type_name.size());
+    append_serialized(record, identifier);
+    append_serialized(record, object);
+
+    // A single write per record, so a record is only truncated if the process dies while writing it
+    std::ofstream file(file_path_, std::ios::binary | std::ios::app);
+    file.write(record.data(), record.size());
+    file.flush();
+
+    if (!file)
+    {
+        logWarning(DDSPIPE_TYPE_OBJECT_CACHE,
+                "Error storing type object " << type_name << " in cache " << file_path_ << ".");
+        return false;
+    }
+
+    identifiers_[key] = identifier;
+
+    logDebug(DDSPIPE_TYPE_OBJECT_CACHE, "Type object " << type_name << " stored in cache " << file_path_ << ".");
+
+    return true;
+}
+
+unsigned int TypeObjectCache::store_with_dependencies(
+        const std::string& type_name,
+        const TypeIdentifier& identifier,
+        const TypeObject& object)
+{
+    unsigned int stored = store(type_name, identifier, object) ? 1 : 0;
+
+    for (const TypeIdentifier& dependency : dependencies_(identifier))
+    {
+        const TypeObject* dependency_object = TypeObjectFactory::get_instance()->get_type_object(&dependency);
+        std::string dependency_name = TypeObjectFactory::get_instance()->get_type_name(&dependency);
+
+        if (!dependency_object || dependency_name.empty())
+        {
+            logDebug(DDSPIPE_TYPE_OBJECT_CACHE,
+                    "Dependency of type object " << type_name << " not registered. Not storing it in cache " <<
+                    file_path_ << ".");
+            continue;
+        }
+
+        if (store(dependency_name, dependency, *dependency_object))
+        {
+            stored++;
+        }
+    }
+
+    return stored;
+}
+
+std::size_t TypeObjectCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return identifiers_.size();
+}
+
+bool TypeObjectCache::is_valid(
+        const TypeIdentifier& identifier,
+        const TypeInformation& type_information)
+{
+    const TypeIdentifier& expected = (identifier._d() == EK_COMPLETE) ?
+            type_information.complete().typeid_with_size().type_id() :
+            type_information.minimal().typeid_with_size().type_id();
+
+    if (expected._d() == TK_NONE)
+    {
+        return true;
+    }
+
+    return expected == identifier;
+}
+
+std::vector<TypeIdentifier> TypeObjectCache::dependencies_(
+        const TypeIdentifier& identifier)
+{
+    std::vector<TypeIdentifier> result;
+
+    // Dependencies of the dependencies are looked up until no new one is found, in case the factory only returns
+    // the direct ones
+    TypeIdentifierSeq pending{identifier};
+    while (!pending.empty())
+    {
+        OctetSeq continuation_point;
+        TypeIdentifierWithSizeSeq dependencies = TypeObjectFactory::get_instance()->typelookup_get_type_dependencies(
+            pending, OctetSeq(), continuation_point, std::numeric_limits<uint16_t>::max());
+
+        pending.clear();
+        for (const TypeIdentifierWithSize& dependency : dependencies)
+        {
+            const TypeIdentifier& dependency_identifier = dependency.type_id();
+            if (dependency_identifier == identifier ||
+                    std::find(result.begin(), result.end(), dependency_identifier) != result.end())
+            {
+                continue;
+            }
+
+            result.push_back(dependency_identifier);
+            pending.push_back(dependency_identifier);
+        }
+    }
+
+    return result;
+}
+
+unsigned int TypeObjectCache::load_records_(
+        const std::vector<char>& content,
+        std::size_t& valid_size)
+{
+    std::size_t magic_size = std::strlen(FILE_MAGIC);
+    std::size_t position = magic_size;
+    uint32_t version = 0;
+
+    // Files that are not a cache are not modified
+    valid_size = content.size();
+
+    if (content.size() < magic_size || std::memcmp(content.data(), FILE_MAGIC, magic_size) != 0 ||
+            !read_uint32(content, position, version) || version != FILE_VERSION)
+    {
+        logWarning(DDSPIPE_TYPE_OBJECT_CACHE,
+                "File " << file_path_ << " is not a type object cache of version " << FILE_VERSION << ". Ignoring it.");
+        return 0;
+    }
+
+    valid_size = position;
+
+    // Later records of a type replace the previous ones, as the factory keeps the first type registered
+    std::map<TypeKey, std::pair<TypeIdentifier, TypeObject>> records;
+
+    while (position < content.size())
+    {
+        const char* name_data = nullptr;
+        uint32_t name_size = 0;
+        TypeIdentifier identifier;
+        TypeObject object;
+
+        if (!read_block(content, position, name_data, name_size) ||
+                !read_serialized(content, position, identifier) ||
+                !read_serialized(content, position, object))
+        {
+            logWarning(DDSPIPE_TYPE_OBJECT_CACHE,
+                    "Type object cache " << file_path_ << " truncated. Discarding the types after the first " <<
+                    records.size() << ".");
+            break;
+        }
+
+        records[TypeKey(std::string(name_data, name_size), identifier._d())] = {identifier, object};
+        valid_size = position;
+    }
+
+    unsigned int loaded = 0;
+
+    for (const auto& record : records)
+    {
+        identifiers_[record.first] = record.second.first;
+        TypeObjectFactory::get_instance()->add_type_object(
+            record.first.first, &record.second.first, &record.second.second);
+        loaded++;
+    }
+
+    return loaded;
+}
+
+} /* namespace participants */
+} /* namespace ddspipe */
+} /* namespace eprosima */
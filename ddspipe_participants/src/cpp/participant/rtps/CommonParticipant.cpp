@@ -314,6 +314,11 @@ bool CommonParticipant::is_repeater() const noexcept
     return configuration_->is_repeater;
 }
 
+bool CommonParticipant::reports_discovery() const noexcept
+{
+    return true;
+}
+
 core::types::ParticipantId CommonParticipant::id() const noexcept
 {
     return configuration_->id;
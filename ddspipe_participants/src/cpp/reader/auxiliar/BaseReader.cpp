@@ -112,6 +112,29 @@ utils::ReturnCode BaseReader::take(
     }
 }
 
+utils::ReturnCode BaseReader::take_batch(
+        unsigned int max_samples,
+        std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    if (enabled_.load())
+    {
+        return take_batch_nts_(max_samples, data);
+    }
+    else
+    {
+        logDevError(DDSPIPE_BASEREADER,
+                "Attempt to take data from disabled Reader in Participant " << participant_id_);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+}
+
+uint64_t BaseReader::rejected_samples() const noexcept
+{
+    return rejected_samples_.load();
+}
+
 core::types::ParticipantId BaseReader::participant_id() const noexcept
 {
     return participant_id_;
@@ -130,6 +153,31 @@ void BaseReader::on_data_available_() const noexcept
     }
 }
 
+utils::ReturnCode BaseReader::take_batch_nts_(
+        unsigned int max_samples,
+        std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    utils::ReturnCode ret = utils::ReturnCode::RETCODE_NO_DATA;
+    unsigned int n_taken = 0;
+
+    while (n_taken < max_samples)
+    {
+        std::unique_ptr<core::IRoutingData> sample;
+        ret = take_nts_(sample);
+
+        if (!ret)
+        {
+            break;
+        }
+
+        data.push_back(std::move(sample));
+        n_taken++;
+    }
+
+    // If some data has been taken, the batch is correct even if the last take failed
+    return n_taken > 0 ? utils::ReturnCode::RETCODE_OK : ret;
+}
+
 void BaseReader::enable_nts_() noexcept
 {
     // It does nothing. Override this method so it has functionality.
@@ -43,6 +43,18 @@ utils::ReturnCode BlankReader::take(
     return utils::ReturnCode::RETCODE_NO_DATA;
 }
 
+utils::ReturnCode BlankReader::take_batch(
+        unsigned int /* max_samples */,
+        std::vector<std::unique_ptr<core::IRoutingData>>& /* data */) noexcept
+{
+    return utils::ReturnCode::RETCODE_NO_DATA;
+}
+
+uint64_t BlankReader::rejected_samples() const noexcept
+{
+    return 0;
+}
+
 core::types::Guid BlankReader::guid() const
 {
     throw utils::UnsupportedException("guid method not allowed for non RTPS readers.");
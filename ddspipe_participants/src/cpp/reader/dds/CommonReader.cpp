@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/math/math_extension.hpp>
@@ -69,10 +71,20 @@ void CommonReader::init()
     // Create CommonReader
     // Listener must be set in creation as no callbacks should be missed
     // It is safe to do so here as object is already created and callbacks do not require anything set in this method
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+    // Reserve the payloads of the history in the pipe pool, so they are loaned instead of copied (see TopicDataType)
+    reader_ = dds_subscriber_->create_datareader(
+        dds_topic_,
+        reckon_reader_qos_(),
+        nullptr,
+        fastdds::dds::StatusMask::all(),
+        payload_pool_);
+#else
     reader_ = dds_subscriber_->create_datareader(
         dds_topic_,
         reckon_reader_qos_(),
         nullptr);
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
 
     if (!reader_)
     {
@@ -223,6 +235,17 @@ fastdds::dds::DataReaderQos CommonReader::reckon_reader_qos_() const
         qos.history().depth = topic_.topic_qos.history_depth;
     }
 
+    if (topic_.topic_qos.adaptive_history)
+    {
+        // Start small, the history reserves more samples only when the backlog requires them
+        qos.endpoint().history_memory_policy =
+                eprosima::fastrtps::rtps::MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        qos.resource_limits().allocated_samples = static_cast<int32_t>(
+            topic_.topic_qos.history_depth > 0 ?
+            std::min(topic_.topic_qos.history_depth, core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES) :
+            core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES);
+    }
+
     return qos;
 }
 
@@ -235,6 +258,8 @@ void CommonReader::fill_received_data_(
     data_to_fill.source_guid = detail::guid_from_instance_handle(info.publication_handle);
     // Get source timestamp
     data_to_fill.source_timestamp = info.source_timestamp;
+    // Get reception timestamp
+    data_to_fill.reception_timestamp = info.reception_timestamp;
     // Get Participant receiver
     data_to_fill.participant_receiver = participant_id_;
 
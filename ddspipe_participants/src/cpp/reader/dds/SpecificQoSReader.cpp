@@ -50,6 +50,7 @@ void SpecificQoSReader::fill_received_data_(
     try
     {
         data_to_fill.writer_qos = detail::specific_qos_of_writer_(*discovery_database_, data_to_fill.source_guid);
+        data_to_fill.writer_qos_hash = data_to_fill.writer_qos.hash();
         logDebug(
             DDSPIPE_SpecificQoSReader,
             "Set QoS " << data_to_fill.writer_qos << " for data from " << data_to_fill.source_guid << ".");
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
 
@@ -47,6 +49,7 @@ CommonReader::CommonReader(
     , topic_(topic)
     , rtps_reader_(nullptr)
     , rtps_history_(nullptr)
+    , history_peak_(0)
     , history_attributes_(history_attributes)
     , reader_attributes_(reader_attributes)
     , topic_attributes_(topic_attributes)
@@ -150,6 +153,25 @@ uint64_t CommonReader::get_unread_count() const noexcept
     return rtps_reader_->get_unread_count();
 }
 
+core::HistoryMetricsSnapshot CommonReader::history_metrics() const noexcept
+{
+    core::HistoryMetricsSnapshot metrics;
+
+    if (!rtps_reader_)
+    {
+        return metrics;
+    }
+
+    metrics.backlog = rtps_reader_->get_unread_count();
+    metrics.max_caches = history_attributes_.maximumReservedCaches;
+
+    // The pool of the history never releases its changes, so its size is the highest history size reached
+    metrics.reserved_caches = std::max<uint64_t>(history_attributes_.initialReservedCaches, history_peak_);
+    metrics.footprint_bytes = metrics.reserved_caches * sizeof(fastrtps::rtps::CacheChange_t);
+
+    return metrics;
+}
+
 core::types::DdsTopic CommonReader::topic() const noexcept
 {
     return topic_;
@@ -194,6 +216,16 @@ utils::ReturnCode CommonReader::take_nts_(
     return utils::ReturnCode::RETCODE_OK;
 }
 
+utils::ReturnCode CommonReader::take_batch_nts_(
+        unsigned int max_samples,
+        std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    // Take the RTPS Reader mutex only once for the whole batch
+    std::lock_guard<eprosima::fastrtps::RecursiveTimedMutex> lock(get_rtps_mutex());
+
+    return BaseReader::take_batch_nts_(max_samples, data);
+}
+
 RtpsPayloadData* CommonReader::create_data_(
         const fastrtps::rtps::CacheChange_t& received_change) const noexcept
 {
@@ -209,6 +241,8 @@ void CommonReader::fill_received_data_(
     data_to_fill.source_guid = received_change.writerGUID;
     // Get source timestamp
     data_to_fill.source_timestamp = received_change.sourceTimestamp;
+    // Get reception timestamp
+    data_to_fill.reception_timestamp = received_change.reception_timestamp;
     // Get Participant receiver
     data_to_fill.participant_receiver = participant_id_;
 
@@ -313,6 +347,14 @@ fastrtps::rtps::HistoryAttributes CommonReader::reckon_history_attributes_(
 
     att.maximumReservedCaches = topic.topic_qos.history_depth;
 
+    if (topic.topic_qos.adaptive_history)
+    {
+        // Start small, the history reserves more changes only when the backlog requires them
+        att.initialReservedCaches = topic.topic_qos.history_depth > 0 ?
+                std::min(topic.topic_qos.history_depth, core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES) :
+                core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES;
+    }
+
     return att;
 }
 
@@ -404,6 +446,13 @@ void CommonReader::onNewCacheChangeAdded(
         fastrtps::rtps::RTPSReader* reader,
         const fastrtps::rtps::CacheChange_t* const change) noexcept
 {
+    // Called with the reader mutex taken, so the peak cannot be raised by another thread meanwhile
+    uint64_t history_size = reader->getHistory()->getHistorySize();
+    if (history_size > history_peak_)
+    {
+        history_peak_ = history_size;
+    }
+
     if (accept_change_(change))
     {
         // Do not remove previous received changes so they can be read when the reader is enabled
@@ -432,6 +481,8 @@ void CommonReader::onNewCacheChangeAdded(
             DDSPIPE_RTPS_COMMONREADER_LISTENER,
             "Rejected received data in reader " << *this << ".");
 
+        rejected_samples_.increment();
+
         // Change rejected, do not send it forward and remove it
         // TODO: do this more elegant
         reader->getHistory()->remove_change((fastrtps::rtps::CacheChange_t*)change);
@@ -26,6 +26,28 @@ namespace dds {
 
 using eprosima::ddspipe::core::types::operator <<;
 
+namespace {
+
+//! Pool that owns \c payload , if the version of Fast DDS records it in the payload
+template <typename PayloadT>
+auto payload_owner(
+        const PayloadT& payload,
+        int) -> decltype(payload.payload_owner)
+{
+    return payload.payload_owner;
+}
+
+//! Fast DDS does not record the pool that owns the payload, so it is unknown
+template <typename PayloadT>
+eprosima::fastrtps::rtps::IPayloadPool* payload_owner(
+        const PayloadT&,
+        long)
+{
+    return nullptr;
+}
+
+} /* namespace */
+
 TopicDataType::TopicDataType(
         const std::string& type_name,
         const bool keyed,
@@ -57,7 +79,38 @@ bool TopicDataType::serialize(
 
     logDebug(DDSPIPE_DDS_TYPESUPPORT, "Serializing data " << *src_payload << ".");
 
-    // TODO: this could be done when we have access to Fast DDS PayloadPool
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+    // The DataWriter reserves its payloads in the pipe pool, so a payload of the pool is loaned instead of copied
+    if (src_payload->payload_owner == payload_pool_.get() &&
+            payload_owner(*target_payload, 0) == payload_pool_.get())
+    {
+        // Take the new reference first, so the payload of the DataWriter is left untouched if it fails
+        core::types::Payload loaned_payload;
+        eprosima::fastrtps::rtps::IPayloadPool* owner = payload_pool_.get();
+        if (!payload_pool_->get_payload(src_payload->payload, owner, loaned_payload))
+        {
+            logWarning(DDSPIPE_DDS_TYPESUPPORT, "Error loaning payload of data " << *src_payload << ".");
+            return false;
+        }
+
+        // Release the payload just reserved by the DataWriter and hand the reference over to it
+        if (!payload_pool_->release_payload(*target_payload))
+        {
+            payload_pool_->release_payload(loaned_payload);
+            logWarning(DDSPIPE_DDS_TYPESUPPORT, "Error releasing payload reserved for data " << *src_payload << ".");
+            return false;
+        }
+
+        target_payload->data = loaned_payload.data;
+        target_payload->length = loaned_payload.length;
+        target_payload->max_size = loaned_payload.max_size;
+        target_payload->encapsulation = src_payload->payload.encapsulation;
+        loaned_payload.data = nullptr;
+
+        return true;
+    }
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+
     // Copy each variable
     target_payload->copy(&src_payload->payload);
 
@@ -72,9 +125,21 @@ bool TopicDataType::deserialize(
 
     DataType* target_payload = static_cast<DataType*>(data);
 
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+    // The DataReader reserves its payloads in the pipe pool, so the payload is referenced instead of copied.
+    // A payload of any other pool (e.g. with data sharing), or whose pool is unknown, is copied.
+    eprosima::fastrtps::rtps::IPayloadPool* owner =
+            payload_owner(*src_payload, 0) == payload_pool_.get() ? payload_pool_.get() : nullptr;
+#else
     // Get data and store it in PayloadPool
-    eprosima::fastrtps::rtps::IPayloadPool* _ = nullptr;
-    payload_pool_->get_payload(*src_payload, _, target_payload->payload);
+    eprosima::fastrtps::rtps::IPayloadPool* owner = nullptr;
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+
+    if (!payload_pool_->get_payload(*src_payload, owner, target_payload->payload))
+    {
+        logWarning(DDSPIPE_DDS_TYPESUPPORT, "Error storing data " << *src_payload << " in payload pool.");
+        return false;
+    }
     target_payload->payload_owner = payload_pool_.get();
 
     return true;
@@ -73,6 +73,23 @@ utils::ReturnCode BaseWriter::write(
     }
 }
 
+utils::ReturnCode BaseWriter::write_batch(
+        const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    if (enabled_.load())
+    {
+        return write_batch_nts_(data);
+    }
+    else
+    {
+        logDevError(DDSPIPE_BASEWRITER,
+                "Attempt to write data from disabled Writer in topic in Participant " << participant_id_);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+}
+
 void BaseWriter::enable_() noexcept
 {
     // It does nothing. Override this method so it has functionality.
@@ -83,6 +100,24 @@ void BaseWriter::disable_() noexcept
     // It does nothing. Override this method so it has functionality.
 }
 
+utils::ReturnCode BaseWriter::write_batch_nts_(
+        const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    utils::ReturnCode ret = utils::ReturnCode::RETCODE_OK;
+
+    for (const auto& sample : data)
+    {
+        utils::ReturnCode sample_ret = write_nts_(*sample);
+
+        if (!sample_ret)
+        {
+            ret = sample_ret;
+        }
+    }
+
+    return ret;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const BaseWriter& writer)
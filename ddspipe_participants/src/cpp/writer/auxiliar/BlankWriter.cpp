@@ -33,6 +33,12 @@ utils::ReturnCode BlankWriter::write(
     return utils::ReturnCode::RETCODE_OK;
 }
 
+utils::ReturnCode BlankWriter::write_batch(
+        const std::vector<std::unique_ptr<core::IRoutingData>>& /* data */) noexcept
+{
+    return utils::ReturnCode::RETCODE_OK;
+}
+
 } /* namespace participants */
 } /* namespace ddspipe */
 } /* namespace eprosima */
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 
+#include <algorithm>
+
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
 #include <fastrtps/rtps/common/CacheChange.h>
@@ -23,6 +25,7 @@
 
 #include <ddspipe_participants/efficiency/cache_change/CacheChangePool.hpp>
 #include <ddspipe_participants/writer/dds/CommonWriter.hpp>
+#include <ddspipe_participants/types/dds/TopicDataType.hpp>
 #include <ddspipe_participants/types/dds/RouterCacheChange.hpp>
 
 namespace eprosima {
@@ -69,10 +72,20 @@ void CommonWriter::init()
                       participant_id_ << " in topic " << topic_ << ".");
     }
 
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+    // Reserve the payloads of the history in the pipe pool, so they are loaned instead of copied (see TopicDataType)
+    writer_ = dds_publisher_->create_datawriter(
+        dds_topic_,
+        reckon_writer_qos_(),
+        nullptr,
+        fastdds::dds::StatusMask::all(),
+        payload_pool_);
+#else
     writer_ = dds_publisher_->create_datawriter(
         dds_topic_,
         reckon_writer_qos_(),
         nullptr);
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
 
     if (!writer_)
     {
@@ -170,6 +183,17 @@ fastdds::dds::DataWriterQos CommonWriter::reckon_writer_qos_() const noexcept
         qos.history().depth = topic_.topic_qos.history_depth;
     }
 
+    if (topic_.topic_qos.adaptive_history)
+    {
+        // Start small, the history reserves more samples only when the backlog requires them
+        qos.endpoint().history_memory_policy =
+                eprosima::fastrtps::rtps::MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+        qos.resource_limits().allocated_samples = static_cast<int32_t>(
+            topic_.topic_qos.history_depth > 0 ?
+            std::min(topic_.topic_qos.history_depth, core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES) :
+            core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES);
+    }
+
     // Set minimum deadline so it matches with everything
     qos.deadline().period = eprosima::fastrtps::Duration_t(0);
 
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
@@ -21,6 +22,7 @@
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/time/time_utils.hpp>
 
+#include <ddspipe_participants/efficiency/cache_change/AdaptiveCacheChangePool.hpp>
 #include <ddspipe_participants/efficiency/cache_change/CacheChangePool.hpp>
 #include <ddspipe_participants/writer/rtps/CommonWriter.hpp>
 #include <ddspipe_participants/writer/rtps/filter/RepeaterDataFilter.hpp>
@@ -55,6 +57,7 @@ CommonWriter::CommonWriter(
     , payload_pool_(payload_pool)
     , rtps_writer_(nullptr)
     , rtps_history_(nullptr)
+    , history_peak_(0)
     , history_attributes_(history_attributes)
     , writer_attributes_(writer_attributes)
     , topic_attributes_(topic_attributes)
@@ -104,6 +107,18 @@ void CommonWriter::init()
         pool_configuration_);
 }
 
+void CommonWriter::onWriterChangeReceivedByAll(
+        fastrtps::rtps::RTPSWriter*,
+        fastrtps::rtps::CacheChange_t* change) noexcept
+{
+    // Volatile readers will never ask again for an acknowledged change, so it can be released right away
+    // and the history only holds the changes still unacknowledged
+    if (topic_.topic_qos.adaptive_history && !topic_.topic_qos.is_transient_local())
+    {
+        rtps_history_->remove_change(change);
+    }
+}
+
 void CommonWriter::onWriterMatched(
         fastrtps::rtps::RTPSWriter*,
         fastrtps::rtps::MatchingInfo& info) noexcept
@@ -181,6 +196,13 @@ utils::ReturnCode CommonWriter::write_nts_(
     // Send data by adding it to CommonWriter History
     rtps_history_->add_change(new_change, write_params);
 
+    // Only this method adds changes, so the peak cannot be raised by another thread meanwhile
+    uint64_t history_size = rtps_history_->getHistorySize();
+    if (history_size > history_peak_)
+    {
+        history_peak_ = history_size;
+    }
+
     // At this point, write params is now the output of adding change
     fill_sent_data_(write_params, rtps_data);
 
@@ -199,6 +221,66 @@ utils::ReturnCode CommonWriter::write_nts_(
     return utils::ReturnCode::RETCODE_OK;
 }
 
+utils::ReturnCode CommonWriter::write_batch_nts_(
+        const std::vector<std::unique_ptr<core::IRoutingData>>& data) noexcept
+{
+    // Take the RTPS Writer mutex only once for the whole batch
+    std::lock_guard<eprosima::fastrtps::RecursiveTimedMutex> lock(rtps_writer_->getMutex());
+
+    return BaseWriter::write_batch_nts_(data);
+}
+
+core::HistoryMetricsSnapshot CommonWriter::history_metrics() const noexcept
+{
+    core::HistoryMetricsSnapshot metrics;
+
+    if (!rtps_writer_)
+    {
+        return metrics;
+    }
+
+    {
+        std::lock_guard<eprosima::fastrtps::RecursiveTimedMutex> lock(rtps_writer_->getMutex());
+        metrics.backlog = rtps_history_->getHistorySize();
+    }
+
+    metrics.max_caches = history_attributes_.maximumReservedCaches;
+
+    if (adaptive_pool_)
+    {
+        metrics.reserved_caches = adaptive_pool_->reserved();
+        metrics.footprint_bytes = metrics.reserved_caches * adaptive_pool_->element_size();
+    }
+    else
+    {
+        // The pool never releases its changes, so its size is the highest history size reached
+        uint64_t initial_size =
+                repeater_ ? pool_configuration_.initial_size : history_attributes_.initialReservedCaches;
+        metrics.reserved_caches = std::max<uint64_t>(initial_size, history_peak_);
+        metrics.footprint_bytes = metrics.reserved_caches *
+                (repeater_ ? sizeof(core::types::RouterCacheChange) : sizeof(fastrtps::rtps::CacheChange_t));
+    }
+
+    return metrics;
+}
+
+bool CommonWriter::drop_oldest() noexcept
+{
+    if (!rtps_writer_)
+    {
+        return false;
+    }
+
+    std::lock_guard<eprosima::fastrtps::RecursiveTimedMutex> lock(rtps_writer_->getMutex());
+
+    if (rtps_history_->getHistorySize() == 0)
+    {
+        return false;
+    }
+
+    return rtps_history_->remove_min_change();
+}
+
 utils::ReturnCode CommonWriter::fill_to_send_data_(
         fastrtps::rtps::CacheChange_t* to_send_change_to_fill,
         eprosima::fastrtps::rtps::WriteParams& to_send_params,
@@ -263,6 +345,15 @@ void CommonWriter::internal_entities_creation_(
     // Create History
     rtps_history_ = new fastrtps::rtps::WriterHistory(history_attributes);
 
+    // Create a pool that follows the backlog of the history if it is adaptive
+    if (topic_.topic_qos.adaptive_history)
+    {
+        adaptive_pool_ = std::make_shared<core::AdaptiveCacheChangePool>(
+            history_attributes.initialReservedCaches,
+            static_cast<unsigned int>(std::max(history_attributes.maximumReservedCaches, 0)),
+            repeater_);
+    }
+
     // Create CommonWriter
     // Listener must be set in creation as no callbacks should be missed
     // It is safe to do so here as object is already created and callbacks do not require anything set in this method
@@ -270,11 +361,31 @@ void CommonWriter::internal_entities_creation_(
     {
         logDebug(DDSPIPE_RTPS_COMMONWRITER, "CommonWriter created with repeater filter");
 
+        std::shared_ptr<fastrtps::rtps::IChangePool> change_pool;
+        if (adaptive_pool_)
+        {
+            change_pool = adaptive_pool_;
+        }
+        else
+        {
+            change_pool = std::make_shared<core::CacheChangePool>(pool_configuration);
+        }
+
         rtps_writer_ = fastrtps::rtps::RTPSDomain::createRTPSWriter(
             rtps_participant_,
             non_const_writer_attributes,
             payload_pool_,
-            std::make_shared<core::CacheChangePool>(pool_configuration),
+            change_pool,
+            rtps_history_,
+            this);
+    }
+    else if (adaptive_pool_)
+    {
+        rtps_writer_ = fastrtps::rtps::RTPSDomain::createRTPSWriter(
+            rtps_participant_,
+            non_const_writer_attributes,
+            payload_pool_,
+            adaptive_pool_,
             rtps_history_,
             this);
     }
@@ -334,6 +445,14 @@ fastrtps::rtps::HistoryAttributes CommonWriter::reckon_history_attributes_(
 
     att.maximumReservedCaches = topic.topic_qos.history_depth;
 
+    if (topic.topic_qos.adaptive_history)
+    {
+        // Start small, the pool grows and shrinks with the backlog
+        att.initialReservedCaches = topic.topic_qos.history_depth > 0 ?
+                std::min(topic.topic_qos.history_depth, core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES) :
+                core::types::TopicQoS::ADAPTIVE_HISTORY_INITIAL_CACHES;
+    }
+
     return att;
 }
 
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 
+#include <iterator>
+
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
 #include <fastrtps/rtps/common/CacheChange.h>
@@ -66,6 +68,33 @@ MultiWriter::~MultiWriter()
             participant_id_ << " for topic " << topic_);
 }
 
+bool MultiWriter::drop_oldest() noexcept
+{
+    std::shared_lock<WritersMapType> lock(writers_map_);
+
+    if (writers_map_.empty())
+    {
+        return false;
+    }
+
+    auto it = std::next(writers_map_.begin(), next_drop_writer_++ % writers_map_.size());
+
+    for (std::size_t i = 0; i < writers_map_.size(); i++)
+    {
+        if (it->second->drop_oldest())
+        {
+            return true;
+        }
+
+        if (++it == writers_map_.end())
+        {
+            it = writers_map_.begin();
+        }
+    }
+
+    return false;
+}
+
 void MultiWriter::enable_() noexcept
 {
     std::shared_lock<WritersMapType> lock(writers_map_);
@@ -92,13 +121,32 @@ bool MultiWriter::exist_partition_(
 }
 
 QoSSpecificWriter* MultiWriter::get_writer_or_create_(
-        const core::types::SpecificEndpointQoS& data_qos)
+        const core::types::SpecificEndpointQoS& data_qos,
+        std::size_t data_qos_hash)
 {
+    // Get it from the cache without locking
+    QoSSpecificWriter* writer = writers_cache_.find(data_qos_hash, data_qos);
+    if (writer)
+    {
+        return writer;
+    }
+
+    // Get it from the map, as it may not fit in the cache
+    {
+        std::shared_lock<WritersMapType> lock(writers_map_);
+
+        auto it = writers_map_.find(data_qos);
+        if (it != writers_map_.end())
+        {
+            return it->second;
+        }
+    }
+
     // NOTE: it uses unique lock because it may change the database, and there is no way
     // to do so if taking share and unique must be done.
     std::unique_lock<WritersMapType> lock(writers_map_);
 
-    // Get if it exists
+    // Get if it has been created meanwhile
     auto it = writers_map_.find(data_qos);
     if (it != writers_map_.end())
     {
@@ -108,7 +156,10 @@ QoSSpecificWriter* MultiWriter::get_writer_or_create_(
     // Create Writer
     QoSSpecificWriter* new_writer = create_writer_nts_(data_qos);
     // Add it to map
-    writers_map_[data_qos] = new_writer;
+    auto inserted = writers_map_.emplace(data_qos, new_writer);
+
+    // Add it to the cache, referencing the QoS of the map as it outlives the cache entry
+    writers_cache_.insert(data_qos_hash, inserted.first->first, new_writer);
 
     // If this is enabled, enable writer
     if (enabled_)
@@ -150,7 +201,10 @@ utils::ReturnCode MultiWriter::write_nts_(
             rtps_data.source_guid);
 
     // Take Writer
-    auto this_qos_writer = get_writer_or_create_(rtps_data.writer_qos);
+    // Use the hash computed when received, if any
+    std::size_t writer_qos_hash =
+            rtps_data.writer_qos_hash != 0 ? rtps_data.writer_qos_hash : rtps_data.writer_qos.hash();
+    auto this_qos_writer = get_writer_or_create_(rtps_data.writer_qos, writer_qos_hash);
 
     logDebug(
         DDSPIPE_MULTIWRITER,
@@ -0,0 +1,193 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_participants/efficiency/cache_change/AdaptiveCacheChangePool.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::core;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 4;
+constexpr const unsigned int N_ITERATIONS = 1000;
+
+//! Reserve \c n changes from \c pool , asserting that every reservation succeeds
+std::vector<fastrtps::rtps::CacheChange_t*> reserve_changes(
+        AdaptiveCacheChangePool& pool,
+        unsigned int n)
+{
+    std::vector<fastrtps::rtps::CacheChange_t*> changes;
+    for (unsigned int i = 0; i < n; i++)
+    {
+        fastrtps::rtps::CacheChange_t* change = nullptr;
+        EXPECT_TRUE(pool.reserve_cache(change));
+        changes.push_back(change);
+    }
+    return changes;
+}
+
+//! Release every change of \c changes to \c pool
+void release_changes(
+        AdaptiveCacheChangePool& pool,
+        std::vector<fastrtps::rtps::CacheChange_t*>& changes)
+{
+    for (auto change : changes)
+    {
+        pool.release_cache(change);
+    }
+    changes.clear();
+}
+
+} // test
+
+/**
+ * Reserve changes over the initial ones and check that they are created on demand until the maximum is in use.
+ *
+ * CASES:
+ *  the initial changes are reused
+ *  new changes are created while there are less than the maximum in use
+ *  a released change is reused
+ */
+TEST(AdaptiveCacheChangePoolTest, reserve_on_demand)
+{
+    AdaptiveCacheChangePool pool(2, 10);
+    ASSERT_EQ(pool.reserved(), 2u);
+
+    auto changes = test::reserve_changes(pool, 2);
+    ASSERT_EQ(pool.reserved(), 2u);
+
+    auto more_changes = test::reserve_changes(pool, 8);
+    ASSERT_EQ(pool.reserved(), 10u);
+
+    fastrtps::rtps::CacheChange_t* change = nullptr;
+    ASSERT_FALSE(pool.reserve_cache(change));
+    ASSERT_EQ(pool.reserved(), 10u);
+
+    pool.release_cache(more_changes.back());
+    more_changes.pop_back();
+    ASSERT_TRUE(pool.reserve_cache(change));
+    more_changes.push_back(change);
+    ASSERT_EQ(pool.reserved(), 10u);
+
+    test::release_changes(pool, changes);
+    test::release_changes(pool, more_changes);
+}
+
+/**
+ * Reserve a burst of changes, then keep a smaller backlog for more than two windows of operations, and check that
+ * the free changes over twice the new peak are destroyed.
+ *
+ * CASES:
+ *  the changes of the burst are kept while its peak is within the last windows
+ *  the changes over twice the recent peak are destroyed once the burst is forgotten
+ *  the initial changes are always kept
+ */
+TEST(AdaptiveCacheChangePoolTest, shrink_after_burst)
+{
+    AdaptiveCacheChangePool pool(5, 0);
+
+    auto changes = test::reserve_changes(pool, 100);
+    test::release_changes(pool, changes);
+    ASSERT_EQ(pool.reserved(), 100u);
+
+    // Backlog of 10 changes until the peak of the burst is forgotten
+    for (unsigned int i = 0; i < AdaptiveCacheChangePool::PEAK_WINDOW; i++)
+    {
+        changes = test::reserve_changes(pool, 10);
+        test::release_changes(pool, changes);
+    }
+    ASSERT_EQ(pool.reserved(), 20u);
+
+    // Backlog of 1 change, lower than the initial changes
+    for (unsigned int i = 0; i < 2 * AdaptiveCacheChangePool::PEAK_WINDOW; i++)
+    {
+        changes = test::reserve_changes(pool, 1);
+        test::release_changes(pool, changes);
+    }
+    ASSERT_EQ(pool.reserved(), 5u);
+}
+
+/**
+ * Reserve and release changes from several threads and check that there are never more changes in use than the
+ * maximum.
+ */
+TEST(AdaptiveCacheChangePoolTest, never_over_maximum)
+{
+    constexpr const unsigned int MAXIMUM = 8;
+    AdaptiveCacheChangePool pool(1, MAXIMUM);
+
+    std::atomic<unsigned int> in_use(0);
+    std::atomic<unsigned int> peak_in_use(0);
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < test::N_THREADS; t++)
+    {
+        threads.emplace_back([&]()
+                {
+                    std::vector<fastrtps::rtps::CacheChange_t*> changes;
+                    for (unsigned int i = 0; i < test::N_ITERATIONS; i++)
+                    {
+                        // Each thread tries to hold the maximum, so they exceed it together
+                        while (changes.size() < MAXIMUM)
+                        {
+                            fastrtps::rtps::CacheChange_t* change = nullptr;
+                            if (!pool.reserve_cache(change))
+                            {
+                                break;
+                            }
+
+                            changes.push_back(change);
+                            unsigned int current = ++in_use;
+                            unsigned int peak = peak_in_use.load();
+                            while (current > peak && !peak_in_use.compare_exchange_weak(peak, current))
+                            {
+                            }
+                        }
+
+                        in_use -= static_cast<unsigned int>(changes.size());
+                        test::release_changes(pool, changes);
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_LE(peak_in_use.load(), MAXIMUM);
+    ASSERT_LE(pool.reserved(), MAXIMUM);
+
+    // Every change is free again, so the maximum can be reserved but not more
+    auto changes = test::reserve_changes(pool, MAXIMUM);
+    fastrtps::rtps::CacheChange_t* change = nullptr;
+    ASSERT_FALSE(pool.reserve_cache(change));
+    test::release_changes(pool, changes);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <functional>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -21,6 +24,7 @@
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 #include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/WorkStealingThreadPool.hpp>
 #include <ddspipe_core/testing/random_values.hpp>
 
 #include <ddspipe_participants/testing/entities/mock_entities.hpp>
@@ -44,6 +48,69 @@ participants::testing::MockRoutingData new_data(
     return new_data;
 }
 
+//! MockParticipant that reports its discovery, so its Readers can be created lazily
+class LazyMockParticipant : public participants::testing::MockParticipant
+{
+public:
+
+    using participants::testing::MockParticipant::MockParticipant;
+
+    bool reports_discovery() const noexcept override
+    {
+        return true;
+    }
+
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override
+    {
+        readers_created++;
+        return participants::testing::MockParticipant::create_reader(topic);
+    }
+
+    //! Number of calls to create_reader
+    std::atomic<unsigned int> readers_created{0};
+};
+
+//! MockParticipant that runs a callback before creating a writer, to interleave events with the Bridge creation
+class HookedMockParticipant : public participants::testing::MockParticipant
+{
+public:
+
+    using participants::testing::MockParticipant::MockParticipant;
+
+    std::shared_ptr<core::IWriter> create_writer(
+            const core::ITopic& topic) override
+    {
+        if (before_create_writer)
+        {
+            // Run it only once
+            auto callback = std::move(before_create_writer);
+            before_create_writer = nullptr;
+            callback();
+        }
+
+        return participants::testing::MockParticipant::create_writer(topic);
+    }
+
+    //! Callback run before the next call to create_writer
+    std::function<void()> before_create_writer;
+};
+
+//! Active reader endpoint in \c topic discovered by participant \c participant_id
+core::types::Endpoint reader_endpoint(
+        const core::types::DdsTopic& topic,
+        const core::types::ParticipantId& participant_id,
+        unsigned int seed)
+{
+    core::types::Endpoint endpoint = core::testing::random_endpoint(seed);
+    endpoint.active = true;
+    endpoint.kind = core::types::EndpointKind::reader;
+    endpoint.topic = topic;
+    endpoint.topic.m_topic_discoverer = participant_id;
+    endpoint.discoverer_participant_id = participant_id;
+    return endpoint;
+}
+
 } // test
 
 /**
@@ -99,6 +166,320 @@ TEST(DdsPipeCommunicationMockTest, mock_communication_trivial)
     }
 }
 
+/**
+ * Test a DDS Pipe execution with mock participants in a topic with batch size greater than 1
+ *
+ * CASES:
+ * - number of messages smaller than batch size
+ * - number of messages not multiple of batch size
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_batch)
+{
+    // Topic to send data in batches
+    core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.type_name = "type1";
+    topic_1.m_internal_type_discriminator = participants::testing::INTERNAL_TOPIC_TYPE_MOCK_TEST;
+    topic_1.topic_qos.batch_size = 4;
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic_1 =
+            eprosima::utils::Heritable<core::types::DdsTopic>::make_heritable(topic_1);
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<participants::testing::MockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<participants::testing::MockParticipant>(part_2_id);
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS),
+        {htopic_1},
+        true
+        );
+
+    // Look for the reader in participant 1 and writer in participant 2
+    auto reader_1 = part_1->get_reader(topic_1);
+    auto writer_2 = part_2->get_writer(topic_1);
+    ASSERT_NE(reader_1, nullptr);
+    ASSERT_NE(writer_2, nullptr);
+
+    // Less messages than batch size
+    {
+        for (unsigned int i = 0; i < 2; i++)
+        {
+            reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+        }
+
+        for (unsigned int i = 0; i < 2; i++)
+        {
+            auto received_data = writer_2->wait_data();
+            ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+        }
+    }
+
+    // Number of messages not multiple of batch size (all must arrive and in order)
+    {
+        for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+        {
+            reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+        }
+
+        for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+        {
+            auto received_data = writer_2->wait_data();
+            ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+        }
+    }
+}
+
+/**
+ * Test a DDS Pipe execution with mock participants in a topic whose writers are written in parallel
+ *
+ * STEPS:
+ * - Send N messages from participant 1
+ * - Wait for N messages in order in every other participant
+ * - Check that no message has been dropped from the writer queues
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_fanout)
+{
+    // Topic to send data with a queue for each writer
+    core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.type_name = "type1";
+    topic_1.m_internal_type_discriminator = participants::testing::INTERNAL_TOPIC_TYPE_MOCK_TEST;
+    topic_1.topic_qos.fanout_queue_size = test::N_MESSAGES * 3;
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic_1 =
+            eprosima::utils::Heritable<core::types::DdsTopic>::make_heritable(topic_1);
+
+    // Create Participants
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    std::vector<core::types::ParticipantId> part_ids;
+    std::vector<std::shared_ptr<participants::testing::MockParticipant>> parts;
+    for (unsigned int i = 0; i < test::N_PARTICIPANTS; i++)
+    {
+        core::types::ParticipantId part_id("Participant_" + std::to_string(i));
+        auto part = std::make_shared<participants::testing::MockParticipant>(part_id);
+        part_db->add_participant(part_id, part);
+        part_ids.push_back(part_id);
+        parts.push_back(part);
+    }
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS),
+        {htopic_1},
+        true
+        );
+
+    auto reader_0 = parts[0]->get_reader(topic_1);
+    ASSERT_NE(reader_0, nullptr);
+
+    // Send N messages
+    for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+    {
+        reader_0->simulate_data_reception(test::new_data(part_ids[0], i));
+    }
+
+    // Every writer receives every message, in order
+    for (unsigned int p = 1; p < test::N_PARTICIPANTS; p++)
+    {
+        auto writer = parts[p]->get_writer(topic_1);
+        ASSERT_NE(writer, nullptr);
+
+        for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+        {
+            auto received_data = writer->wait_data();
+            ASSERT_EQ(received_data, test::new_data(part_ids[0], i));
+        }
+    }
+
+    // Queues are big enough to hold every message, so none is dropped
+    for (const auto& track_metrics : ddspipe.metrics())
+    {
+        if (track_metrics.reader_participant_id == part_ids[0])
+        {
+            for (const auto& writer_it : track_metrics.writers)
+            {
+                ASSERT_EQ(writer_it.second.dropped, 0u);
+            }
+        }
+    }
+}
+
+/**
+ * Test a DDS Pipe execution with mock participants scheduled by a work stealing thread pool
+ *
+ * The budget of messages per turn is smaller than the messages sent, so the Tracks yield their thread
+ * several times before finishing the transmission.
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_work_stealing)
+{
+    // Topics to send data
+    std::vector<participants::testing::MockTopic> topics;
+    std::set<eprosima::utils::Heritable<core::types::DistributedTopic>> htopics;
+    for (unsigned int t = 0; t < test::N_TOPICS; t++)
+    {
+        participants::testing::MockTopic topic;
+        topic.m_topic_name = "topic" + std::to_string(t);
+        topics.push_back(topic);
+        htopics.insert(eprosima::utils::Heritable<participants::testing::MockTopic>::make_heritable(topic));
+    }
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<participants::testing::MockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<participants::testing::MockParticipant>(part_2_id);
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<core::WorkStealingThreadPool>(test::N_THREADS, 2),
+        htopics,
+        true
+        );
+
+    // Send N messages in every topic
+    for (const auto& topic : topics)
+    {
+        auto reader_1 = part_1->get_reader(topic);
+        ASSERT_NE(reader_1, nullptr);
+
+        for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+        {
+            reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+        }
+    }
+
+    // Every message arrives, in order
+    for (const auto& topic : topics)
+    {
+        auto writer_2 = part_2->get_writer(topic);
+        ASSERT_NE(writer_2, nullptr);
+
+        for (unsigned int i = 0; i < test::N_MESSAGES * 3; i++)
+        {
+            auto received_data = writer_2->wait_data();
+            ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+        }
+    }
+}
+
+/**
+ * Test the metrics of the Tracks of a DDS Pipe execution with mock participants
+ *
+ * STEPS:
+ * - Send N messages from participant 1
+ * - Wait for N messages in participant 2
+ * - Check the counters of the Track of participant 1 (and that the other Track has not transmitted)
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_metrics)
+{
+    // Topic to send data
+    participants::testing::MockTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic_1 =
+            eprosima::utils::Heritable<participants::testing::MockTopic>::make_heritable(topic_1);
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<participants::testing::MockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<participants::testing::MockParticipant>(part_2_id);
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS),
+        {htopic_1},
+        true
+        );
+
+    auto reader_1 = part_1->get_reader(topic_1);
+    auto writer_2 = part_2->get_writer(topic_1);
+    ASSERT_NE(reader_1, nullptr);
+    ASSERT_NE(writer_2, nullptr);
+
+    // Send and receive N messages
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+    }
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        writer_2->wait_data();
+    }
+
+    // Counters are updated right after the write, so wait for them to be updated
+    core::TrackMetricsSnapshot track_1_metrics;
+    core::TrackMetricsSnapshot track_2_metrics;
+    for (unsigned int retry = 0; retry < 100; retry++)
+    {
+        std::vector<core::TrackMetricsSnapshot> metrics = ddspipe.metrics();
+        ASSERT_EQ(metrics.size(), 2u);
+
+        for (const auto& track_metrics : metrics)
+        {
+            if (track_metrics.reader_participant_id == part_1_id)
+            {
+                track_1_metrics = track_metrics;
+            }
+            else
+            {
+                track_2_metrics = track_metrics;
+            }
+        }
+
+        if (track_1_metrics.writers[part_2_id].written == test::N_MESSAGES)
+        {
+            break;
+        }
+        eprosima::utils::sleep_for(10);
+    }
+
+    ASSERT_EQ(track_1_metrics.taken, test::N_MESSAGES);
+    ASSERT_EQ(track_1_metrics.rejected, 0u);
+    ASSERT_EQ(track_1_metrics.writers[part_2_id].written, test::N_MESSAGES);
+    ASSERT_EQ(track_1_metrics.writers[part_2_id].write_errors, 0u);
+
+    // Mock data has no timestamps, so no latency is recorded
+    ASSERT_EQ(track_1_metrics.source_latency.count, 0u);
+    ASSERT_EQ(track_1_metrics.pipe_latency.count, 0u);
+
+    ASSERT_EQ(track_2_metrics.reader_participant_id, part_2_id);
+    ASSERT_EQ(track_2_metrics.taken, 0u);
+    ASSERT_EQ(track_2_metrics.writers[part_1_id].written, 0u);
+}
+
 /**
  * Test a DDS Pipe execution with mock participants when sending messages before enabling the pipe.
  * Also test it disabling, sending data and enabling again.
@@ -451,6 +832,198 @@ TEST(DdsPipeCommunicationMockTest, mock_communication_multiple_participant_topic
     }
 }
 
+/**
+ * Test a DDS Pipe execution with lazy readers, that are only created while their participant discovers an active
+ * writer in the topic, and destroyed after the idle timeout without them.
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_lazy_readers)
+{
+    // Topic to send data
+    core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.type_name = "type1";
+    topic_1.m_internal_type_discriminator = participants::testing::INTERNAL_TOPIC_TYPE_MOCK_TEST;
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic_1 =
+            eprosima::utils::Heritable<core::types::DdsTopic>::make_heritable(topic_1);
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<test::LazyMockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<test::LazyMockParticipant>(part_2_id);
+
+    auto disc_db = std::make_shared<core::DiscoveryDatabase>();
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    core::DdsPipeConfiguration configuration;
+    configuration.lazy_readers = true;
+    configuration.lazy_readers_idle_timeout = 50;
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        disc_db,
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<core::WorkStealingThreadPool>(test::N_THREADS),
+        {htopic_1},
+        true,
+        configuration
+        );
+
+    // The writers are created, but not the readers as there are no remote writers yet
+    ASSERT_EQ(part_1->n_readers(), 0);
+    ASSERT_EQ(part_1->n_writers(), 1);
+    ASSERT_EQ(part_2->n_readers(), 0);
+    ASSERT_EQ(part_2->n_writers(), 1);
+
+    // Simulate a remote writer discovered by participant 1
+    core::types::Endpoint endpoint = core::testing::random_endpoint();
+    endpoint.active = true;
+    endpoint.kind = core::types::EndpointKind::writer;
+    endpoint.topic = topic_1;
+    endpoint.discoverer_participant_id = part_1_id;
+    disc_db->add_endpoint(endpoint);
+
+    // Wait for the reader to be created
+    utils::sleep_for(100);
+
+    ASSERT_EQ(part_1->readers_created, 1u);
+    ASSERT_EQ(part_2->readers_created, 0u);
+
+    auto reader_1 = part_1->get_reader(topic_1);
+    auto writer_2 = part_2->get_writer(topic_1);
+    ASSERT_NE(reader_1, nullptr);
+    ASSERT_NE(writer_2, nullptr);
+
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+    }
+
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        auto received_data = writer_2->wait_data();
+        ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+    }
+
+    // Remove the remote writer, and wait longer than the idle timeout so the reader is destroyed
+    disc_db->erase_endpoint(endpoint);
+    utils::sleep_for(200);
+
+    // Discover it again, so the reader is created again
+    disc_db->add_endpoint(endpoint);
+    utils::sleep_for(100);
+
+    ASSERT_EQ(part_1->readers_created, 2u);
+    ASSERT_EQ(part_2->readers_created, 0u);
+
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+    }
+
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        auto received_data = writer_2->wait_data();
+        ASSERT_EQ(received_data, test::new_data(part_1_id, i));
+    }
+}
+
+/**
+ * Test that a topic discovered by a participant while a reload creates its Bridge gets the writers of every
+ * participant that discovered it, without another Bridge being created.
+ *
+ * STEPS:
+ * - discover a reader in participant 1 of a blocked topic
+ * - allow the topic, discovering a reader in participant 2 while its Bridge is being created
+ * - check data is sent to the writers of both participants
+ */
+TEST(DdsPipeCommunicationMockTest, mock_communication_discovery_while_reloading)
+{
+    // Topic to send data
+    core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.type_name = "type1";
+    topic_1.m_internal_type_discriminator = participants::testing::INTERNAL_TOPIC_TYPE_MOCK_TEST;
+
+    // Create Participants
+    core::types::ParticipantId part_1_id("Participant_1");
+    auto part_1 = std::make_shared<test::HookedMockParticipant>(part_1_id);
+
+    core::types::ParticipantId part_2_id("Participant_2");
+    auto part_2 = std::make_shared<participants::testing::MockParticipant>(part_2_id);
+
+    auto disc_db = std::make_shared<core::DiscoveryDatabase>();
+
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+    part_db->add_participant(part_1_id, part_1);
+    part_db->add_participant(part_2_id, part_2);
+
+    // Blocks all topics
+    utils::Heritable<core::types::IFilterTopic> filter_topic =
+            utils::Heritable<participants::testing::MockFilterAllTopic>::make_heritable();
+    std::shared_ptr<core::AllowedTopicList> atl(new core::AllowedTopicList({}, {filter_topic}));
+
+    core::DdsPipeConfiguration configuration;
+    configuration.remove_unused_entities = true;
+
+    // Create DDS Pipe
+    core::DdsPipe ddspipe(
+        atl,
+        disc_db,
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<eprosima::utils::SlotThreadPool>(test::N_THREADS),
+        {},
+        true,
+        configuration
+        );
+
+    // Discover the topic in participant 1, without creating its Bridge as it is blocked
+    disc_db->add_endpoint(test::reader_endpoint(topic_1, part_1_id, 1));
+    utils::sleep_for(50);
+
+    ASSERT_EQ(part_1->n_writers(), 0u);
+    ASSERT_EQ(part_2->n_writers(), 0u);
+
+    // Discover the topic in participant 2 while the reload creates the Bridge, and give time to process it
+    part_1->before_create_writer = [&]()
+            {
+                disc_db->add_endpoint(test::reader_endpoint(topic_1, part_2_id, 3));
+                utils::sleep_for(100);
+            };
+
+    // Allow topic (empty allowed list allows everything)
+    ddspipe.reload_allowed_topics(std::make_shared<core::AllowedTopicList>());
+
+    auto reader_1 = part_1->get_reader(topic_1);
+    auto reader_2 = part_2->get_reader(topic_1);
+    auto writer_1 = part_1->get_writer(topic_1);
+    auto writer_2 = part_2->get_writer(topic_1);
+    ASSERT_NE(reader_1, nullptr);
+    ASSERT_NE(reader_2, nullptr);
+    ASSERT_NE(writer_1, nullptr);
+    ASSERT_NE(writer_2, nullptr);
+
+    // Data flows in both directions
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        reader_1->simulate_data_reception(test::new_data(part_1_id, i));
+        reader_2->simulate_data_reception(test::new_data(part_2_id, i));
+    }
+
+    for (unsigned int i = 0; i < test::N_MESSAGES; i++)
+    {
+        ASSERT_EQ(writer_2->wait_data(), test::new_data(part_1_id, i));
+        ASSERT_EQ(writer_1->wait_data(), test::new_data(part_2_id, i));
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,161 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/core/DdsPipe.hpp>
+#include <ddspipe_core/dynamic/AllowedTopicList.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
+
+#include <ddspipe_participants/testing/entities/mock_entities.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 2;
+constexpr const unsigned int N_PARTICIPANTS = 4;
+constexpr const unsigned int N_TOPICS = 500;
+constexpr const std::chrono::microseconds ENTITY_CREATION_TIME(100);
+const std::vector<unsigned int> BRIDGE_CREATION_THREADS_TO_TEST = {1, 4, 16};
+
+/**
+ * @brief MockParticipant that takes some time to create each entity, as a participant creating RTPS entities.
+ */
+class SlowMockParticipant : public participants::testing::MockParticipant
+{
+public:
+
+    using participants::testing::MockParticipant::MockParticipant;
+
+    std::shared_ptr<core::IWriter> create_writer(
+            const core::ITopic& topic) override
+    {
+        std::this_thread::sleep_for(ENTITY_CREATION_TIME);
+        return participants::testing::MockParticipant::create_writer(topic);
+    }
+
+    std::shared_ptr<core::IReader> create_reader(
+            const core::ITopic& topic) override
+    {
+        std::this_thread::sleep_for(ENTITY_CREATION_TIME);
+        return participants::testing::MockParticipant::create_reader(topic);
+    }
+};
+
+/**
+ * @brief Create a DdsPipe with \c N_TOPICS builtin topics and \c N_PARTICIPANTS participants.
+ *
+ * @return milliseconds from the creation of the DdsPipe until it is ready
+ */
+double run_startup_workload(
+        unsigned int bridge_creation_threads)
+{
+    std::vector<std::shared_ptr<SlowMockParticipant>> participants;
+    auto part_db = std::make_shared<core::ParticipantsDatabase>();
+
+    for (unsigned int i = 0; i < N_PARTICIPANTS; i++)
+    {
+        core::types::ParticipantId id("Participant_" + std::to_string(i));
+        participants.push_back(std::make_shared<SlowMockParticipant>(id));
+        part_db->add_participant(id, participants.back());
+    }
+
+    std::set<utils::Heritable<core::types::DistributedTopic>> builtin_topics;
+    for (unsigned int i = 0; i < N_TOPICS; i++)
+    {
+        core::types::DdsTopic topic;
+        topic.m_topic_name = "topic_" + std::to_string(i);
+        topic.type_name = "type";
+        topic.m_internal_type_discriminator = participants::testing::INTERNAL_TOPIC_TYPE_MOCK_TEST;
+        builtin_topics.insert(utils::Heritable<core::types::DdsTopic>::make_heritable(topic));
+    }
+
+    core::DdsPipeConfiguration configuration;
+    configuration.bridge_creation_threads = bridge_creation_threads;
+
+    auto start = std::chrono::steady_clock::now();
+
+    core::DdsPipe ddspipe(
+        std::make_shared<core::AllowedTopicList>(),
+        std::make_shared<core::DiscoveryDatabase>(),
+        std::make_shared<core::FastPayloadPool>(),
+        part_db,
+        std::make_shared<core::FifoThreadPool>(N_THREADS),
+        builtin_topics,
+        true,
+        configuration);
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Every Bridge has a Reader and a Writer in each participant
+    for (const auto& participant : participants)
+    {
+        EXPECT_EQ(participant->n_readers(), N_TOPICS);
+        EXPECT_EQ(participant->n_writers(), N_TOPICS);
+    }
+
+    // Every Bridge has a Track for the Reader of each participant, forwarding to the other participants
+    std::vector<core::TrackMetricsSnapshot> metrics = ddspipe.metrics();
+    EXPECT_EQ(metrics.size(), N_TOPICS * N_PARTICIPANTS);
+
+    std::set<std::string> topics;
+    for (const auto& track_metrics : metrics)
+    {
+        topics.insert(track_metrics.topic);
+        EXPECT_EQ(track_metrics.writers.size(), N_PARTICIPANTS - 1);
+    }
+    EXPECT_EQ(topics.size(), N_TOPICS);
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / 1000.0;
+}
+
+} // test
+
+/**
+ * Measure the time to start a DdsPipe with many builtin topics, creating their Bridges with 1, 4 and 16 threads.
+ *
+ * It prints the cold start time of each case.
+ * Timing depends on the machine, so it only asserts that every entity and Track is created.
+ */
+TEST(DdsPipeStartupBenchmarkTest, bridge_creation_threads)
+{
+    std::cout << "bridge creation threads | startup ms" << std::endl;
+
+    for (unsigned int bridge_creation_threads : test::BRIDGE_CREATION_THREADS_TO_TEST)
+    {
+        double startup_ms = test::run_startup_workload(bridge_creation_threads);
+
+        std::cout << bridge_creation_threads << " | " << startup_ms << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
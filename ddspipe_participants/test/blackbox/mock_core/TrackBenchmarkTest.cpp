@@ -0,0 +1,176 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/communication/dds/Track.hpp>
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/efficiency/thread_pool/FifoThreadPool.hpp>
+
+#include <ddspipe_participants/testing/entities/mock_entities.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+
+namespace test {
+
+constexpr const unsigned int N_THREADS = 2;
+constexpr const unsigned int N_MESSAGES = 2000;
+const std::vector<unsigned int> WRITERS_TO_TEST = {1, 4, 16};
+
+/**
+ * @brief Forward \c N_MESSAGES through a Track with \c n_writers Writers and wait for all of them to arrive.
+ *
+ * If \c churn is set, another thread adds and removes a Writer in the Track continuously meanwhile,
+ * as it happens with discovery events.
+ *
+ * @return nanoseconds per message forwarded
+ */
+double run_track_workload(
+        unsigned int n_writers,
+        bool churn)
+{
+    participants::testing::MockTopic topic;
+    topic.m_topic_name = "topic";
+    eprosima::utils::Heritable<core::types::DistributedTopic> htopic =
+            eprosima::utils::Heritable<participants::testing::MockTopic>::make_heritable(topic);
+
+    auto reader = std::make_shared<participants::testing::MockReader>("Reader");
+
+    std::map<core::types::ParticipantId, std::shared_ptr<core::IWriter>> writers;
+    std::vector<std::shared_ptr<participants::testing::MockWriter>> mock_writers;
+    for (unsigned int i = 0; i < n_writers; i++)
+    {
+        core::types::ParticipantId id("Writer_" + std::to_string(i));
+        auto writer = std::make_shared<participants::testing::MockWriter>(id);
+        mock_writers.push_back(writer);
+        writers[id] = writer;
+    }
+
+    auto thread_pool = std::make_shared<core::FifoThreadPool>(N_THREADS);
+    thread_pool->enable();
+
+    double result = 0;
+    {
+        core::Track track(
+            htopic,
+            "Reader",
+            reader,
+            std::move(writers),
+            std::make_shared<core::FastPayloadPool>(),
+            thread_pool);
+        track.enable();
+
+        std::atomic<bool> stop(false);
+        std::thread churn_thread;
+        if (churn)
+        {
+            churn_thread = std::thread(
+                [&track, &stop]()
+                {
+                    auto writer = std::make_shared<participants::testing::MockWriter>("Churn");
+                    while (!stop)
+                    {
+                        track.add_writer("Churn", writer);
+                        track.remove_writer("Churn");
+                    }
+                });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned int i = 0; i < N_MESSAGES; i++)
+        {
+            participants::testing::MockRoutingData data;
+            data.data = std::to_string(i);
+            reader->simulate_data_reception(std::move(data));
+        }
+
+        // Every Writer receives every message, in the order they were received
+        for (auto& writer : mock_writers)
+        {
+            for (unsigned int i = 0; i < N_MESSAGES; i++)
+            {
+                EXPECT_EQ(writer->wait_data().data, std::to_string(i));
+            }
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        result = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() /
+                static_cast<double>(N_MESSAGES);
+
+        stop = true;
+        if (churn_thread.joinable())
+        {
+            churn_thread.join();
+        }
+
+        track.disable();
+
+        // No message is forwarded twice nor lost
+        core::TrackMetricsSnapshot metrics = track.metrics();
+        EXPECT_EQ(metrics.taken, N_MESSAGES);
+        for (unsigned int i = 0; i < n_writers; i++)
+        {
+            const core::WriterMetricsSnapshot& writer_metrics = metrics.writers["Writer_" + std::to_string(i)];
+            EXPECT_EQ(writer_metrics.written, N_MESSAGES);
+            EXPECT_EQ(writer_metrics.write_errors, 0u);
+            EXPECT_EQ(mock_writers[i]->n_to_send_data(), 0u);
+        }
+    }
+
+    thread_pool->disable();
+    return result;
+}
+
+} // test
+
+/**
+ * Measure the time to forward messages through a Track with 1, 4 and 16 Writers, with and without Writers
+ * being added and removed at the same time.
+ *
+ * As the Writers of the Track are loaded without any mutex, the churn should not stall the forwarding.
+ * It prints the time per message of each case.
+ * Timing depends on the machine, so it only asserts that every Writer receives every message once and in order.
+ */
+TEST(TrackBenchmarkTest, writers_churn)
+{
+    std::cout << "writers | ns/msg | ns/msg with writers churn" << std::endl;
+
+    for (unsigned int n_writers : test::WRITERS_TO_TEST)
+    {
+        double quiet_ns = test::run_track_workload(n_writers, false);
+        double churn_ns = test::run_track_workload(n_writers, true);
+
+        std::cout << n_writers << " | " << quiet_ns << " | " << churn_ns << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
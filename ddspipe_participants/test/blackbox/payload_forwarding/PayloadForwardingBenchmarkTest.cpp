@@ -0,0 +1,201 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/types/dds/TopicDataType.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const unsigned int ITERATIONS = 500;
+constexpr const double BYTES_PER_MB = 1024.0 * 1024.0;
+const std::vector<uint32_t> PAYLOAD_SIZES = {1024, 64 * 1024, 1024 * 1024};
+
+//! Layer of Fast DDS a Participant of the pipe is built on
+enum class Layer
+{
+    rtps,
+    dds
+};
+
+/**
+ * @brief Take in \c data a sample received from the network by a Reader of \c layer , as the pipe does.
+ *
+ * RTPS Readers (and DDS Readers with \c DDSPIPE_DDS_PAYLOAD_POOL_LOANS ) receive it in a history whose payloads
+ * are reserved in the pipe pool.
+ * Otherwise, Fast DDS receives it in a history of its own and the type support stores it in the pipe pool.
+ *
+ * @return whether every step succeeded
+ */
+bool take(
+        Layer layer,
+        core::PayloadPool& pool,
+        participants::dds::TopicDataType& type,
+        const Payload& received,
+        RtpsPayloadData& data)
+{
+    fastrtps::rtps::IPayloadPool* received_owner = nullptr;
+
+    if (layer == Layer::rtps)
+    {
+        data.payload_owner = &pool;
+        return pool.get_payload(received, received_owner, data.payload);
+    }
+
+    Payload history_payload;
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+    bool ok = pool.get_payload(received, received_owner, history_payload);
+    ok = type.deserialize(&history_payload, &data) && ok;
+    ok = pool.release_payload(history_payload) && ok;
+    return ok;
+#else
+    history_payload.copy(&received, false);
+    return type.deserialize(&history_payload, &data);
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+}
+
+/**
+ * @brief Write \c data with a Writer of \c layer , and remove it from its history as once it is acknowledged.
+ *
+ * RTPS Writers reference the payload of the pipe pool in their history.
+ * DDS Writers reserve a payload in their history (in the pipe pool with \c DDSPIPE_DDS_PAYLOAD_POOL_LOANS )
+ * and the type support serializes the data in it.
+ *
+ * @return whether every step succeeded and the payload in the history of the Writer is equal to \c expected
+ */
+bool write(
+        Layer layer,
+        core::PayloadPool& pool,
+        participants::dds::TopicDataType& type,
+        RtpsPayloadData& data,
+        const Payload& expected)
+{
+    Payload history_payload;
+    bool ok = true;
+
+    if (layer == Layer::rtps)
+    {
+        fastrtps::rtps::IPayloadPool* data_owner = &pool;
+        ok = pool.get_payload(data.payload, data_owner, history_payload);
+    }
+    else
+    {
+        uint32_t size = type.getSerializedSizeProvider(&data)();
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+        ok = pool.get_payload(size, history_payload);
+#else
+        history_payload.reserve(size);
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+        ok = type.serialize(&data, &history_payload) && ok;
+    }
+
+    ok = ok && history_payload.length == expected.length &&
+            std::memcmp(history_payload.data, expected.data, expected.length) == 0;
+
+    if (layer == Layer::rtps || DDSPIPE_DDS_PAYLOAD_POOL_LOANS)
+    {
+        ok = pool.release_payload(history_payload) && ok;
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Forward \c ITERATIONS samples of \c size bytes from a Reader of \c reader_layer to a Writer of
+ * \c writer_layer .
+ *
+ * @return nanoseconds per MB forwarded
+ */
+double run_forwarding_workload(
+        Layer reader_layer,
+        Layer writer_layer,
+        uint32_t size)
+{
+    auto pool = std::make_shared<core::FastPayloadPool>();
+    participants::dds::TopicDataType type("type", false, pool);
+
+    Payload received(size);
+    std::memset(received.data, 0x42, size);
+    received.length = size;
+
+    unsigned int failures = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < ITERATIONS; i++)
+    {
+        RtpsPayloadData data;
+        if (!take(reader_layer, *pool, type, received, data) ||
+                !write(writer_layer, *pool, type, data, received))
+        {
+            failures++;
+        }
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(failures, 0u);
+    EXPECT_TRUE(pool->is_clean());
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() /
+           (static_cast<double>(ITERATIONS) * size / BYTES_PER_MB);
+}
+
+} // test
+
+/**
+ * Compare the cost of forwarding a sample from a Reader to a Writer of each Fast DDS layer: RTPS to RTPS,
+ * RTPS to DDS and DDS to DDS, for different payload sizes.
+ *
+ * It only measures the handling of the payloads by the pipe and its type support, not the network.
+ * It prints the time per MB forwarded of each case.
+ * Timing depends on the machine, so it only asserts that every sample is forwarded unchanged and the pool ends clean.
+ */
+TEST(PayloadForwardingBenchmarkTest, forwarding_cost_per_mb)
+{
+    std::cout << "DDS payload pool loans: " << (DDSPIPE_DDS_PAYLOAD_POOL_LOANS ? "enabled" : "disabled") << std::endl;
+    std::cout << "payload bytes | RTPS->RTPS ns/MB | RTPS->DDS ns/MB | DDS->DDS ns/MB" << std::endl;
+
+    for (uint32_t size : test::PAYLOAD_SIZES)
+    {
+        double rtps_rtps_ns = test::run_forwarding_workload(test::Layer::rtps, test::Layer::rtps, size);
+        double rtps_dds_ns = test::run_forwarding_workload(test::Layer::rtps, test::Layer::dds, size);
+        double dds_dds_ns = test::run_forwarding_workload(test::Layer::dds, test::Layer::dds, size);
+
+        std::cout << size << " | " << rtps_rtps_ns << " | " << rtps_dds_ns << " | " << dds_dds_ns << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,168 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstring>
+#include <memory>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddspipe_participants/types/dds/TopicDataType.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+constexpr const fastdds::dds::DomainId_t DOMAIN = 42;
+constexpr const uint32_t PAYLOAD_SIZE = 1024;
+constexpr const char* TYPE_NAME = "TopicDataTypeTestType";
+
+//! Store in \c data a payload of \c PAYLOAD_SIZE bytes of value \c value reserved in \c pool
+void fill_data(
+        core::PayloadPool& pool,
+        RtpsPayloadData& data,
+        unsigned char value)
+{
+    pool.get_payload(PAYLOAD_SIZE, data.payload);
+    std::memset(data.payload.data, value, PAYLOAD_SIZE);
+    data.payload.length = PAYLOAD_SIZE;
+    data.payload_owner = &pool;
+}
+
+} // test
+
+/**
+ * Write a sample with a DataWriter and take it with a DataReader, both with their histories in the pipe pool
+ * (with \c DDSPIPE_DDS_PAYLOAD_POOL_LOANS ), and check that the data arrives unchanged and the pool ends clean.
+ */
+TEST(TopicDataTypeTest, dds_round_trip)
+{
+    auto pool = std::make_shared<core::FastPayloadPool>();
+
+    {
+        fastdds::dds::DomainParticipant* participant =
+                fastdds::dds::DomainParticipantFactory::get_instance()->create_participant(
+            test::DOMAIN, fastdds::dds::PARTICIPANT_QOS_DEFAULT);
+        ASSERT_NE(participant, nullptr);
+
+        fastdds::dds::TypeSupport type(new participants::dds::TopicDataType(test::TYPE_NAME, false, pool));
+        ASSERT_EQ(type.register_type(participant), fastrtps::types::ReturnCode_t::RETCODE_OK);
+
+        fastdds::dds::Topic* topic = participant->create_topic(
+            "TopicDataTypeTestTopic", test::TYPE_NAME, fastdds::dds::TOPIC_QOS_DEFAULT);
+        fastdds::dds::Publisher* publisher = participant->create_publisher(fastdds::dds::PUBLISHER_QOS_DEFAULT);
+        fastdds::dds::Subscriber* subscriber = participant->create_subscriber(fastdds::dds::SUBSCRIBER_QOS_DEFAULT);
+
+        // Data sharing reserves the payloads in its own pool, so it is disabled to use the pipe pool
+        fastdds::dds::DataWriterQos writer_qos = fastdds::dds::DATAWRITER_QOS_DEFAULT;
+        writer_qos.reliability().kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+        writer_qos.durability().kind = fastdds::dds::TRANSIENT_LOCAL_DURABILITY_QOS;
+        writer_qos.data_sharing().off();
+
+        fastdds::dds::DataReaderQos reader_qos = fastdds::dds::DATAREADER_QOS_DEFAULT;
+        reader_qos.reliability().kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+        reader_qos.durability().kind = fastdds::dds::TRANSIENT_LOCAL_DURABILITY_QOS;
+        reader_qos.data_sharing().off();
+
+#if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+        fastdds::dds::DataWriter* writer = publisher->create_datawriter(
+            topic, writer_qos, nullptr, fastdds::dds::StatusMask::all(), pool);
+        fastdds::dds::DataReader* reader = subscriber->create_datareader(
+            topic, reader_qos, nullptr, fastdds::dds::StatusMask::all(), pool);
+#else
+        fastdds::dds::DataWriter* writer = publisher->create_datawriter(topic, writer_qos);
+        fastdds::dds::DataReader* reader = subscriber->create_datareader(topic, reader_qos);
+#endif // if DDSPIPE_DDS_PAYLOAD_POOL_LOANS
+        ASSERT_NE(writer, nullptr);
+        ASSERT_NE(reader, nullptr);
+
+        {
+            RtpsPayloadData data;
+            test::fill_data(*pool, data, 0x42);
+            ASSERT_TRUE(writer->write(&data));
+        }
+
+        ASSERT_TRUE(reader->wait_for_unread_message(fastrtps::Duration_t(5, 0)));
+
+        {
+            RtpsPayloadData data;
+            fastdds::dds::SampleInfo info;
+            ASSERT_EQ(reader->take_next_sample(&data, &info), fastrtps::types::ReturnCode_t::RETCODE_OK);
+
+            ASSERT_EQ(data.payload.length, test::PAYLOAD_SIZE);
+            ASSERT_EQ(data.payload_owner, pool.get());
+            for (uint32_t i = 0; i < test::PAYLOAD_SIZE; i++)
+            {
+                ASSERT_EQ(data.payload.data[i], 0x42);
+            }
+        }
+
+        ASSERT_EQ(participant->delete_contained_entities(), fastrtps::types::ReturnCode_t::RETCODE_OK);
+        ASSERT_EQ(
+            fastdds::dds::DomainParticipantFactory::get_instance()->delete_participant(participant),
+            fastrtps::types::ReturnCode_t::RETCODE_OK);
+    }
+
+    ASSERT_TRUE(pool->is_clean());
+}
+
+/**
+ * Deserialize a payload that does not belong to the pipe pool and check that it is copied in the pool,
+ * instead of referenced.
+ */
+TEST(TopicDataTypeTest, foreign_payload_copied)
+{
+    auto pool = std::make_shared<core::FastPayloadPool>();
+    participants::dds::TopicDataType type(test::TYPE_NAME, false, pool);
+
+    {
+        Payload foreign_payload(test::PAYLOAD_SIZE);
+        std::memset(foreign_payload.data, 0x24, test::PAYLOAD_SIZE);
+        foreign_payload.length = test::PAYLOAD_SIZE;
+
+        RtpsPayloadData data;
+        ASSERT_TRUE(type.deserialize(&foreign_payload, &data));
+
+        ASSERT_NE(data.payload.data, foreign_payload.data);
+        ASSERT_EQ(data.payload.length, test::PAYLOAD_SIZE);
+        ASSERT_EQ(data.payload_owner, pool.get());
+        ASSERT_EQ(std::memcmp(data.payload.data, foreign_payload.data, test::PAYLOAD_SIZE), 0);
+    }
+
+    ASSERT_TRUE(pool->is_clean());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,320 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/dds/SpecificEndpointQoS.hpp>
+
+#include <ddspipe_participants/writer/auxiliar/QoSWriterCache.hpp>
+#include <ddspipe_participants/writer/rtps/MultiWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::participants;
+
+namespace test {
+
+constexpr const unsigned int N_READERS = 4;
+
+//! Dummy Writer stored in the caches
+struct Writer
+{
+    unsigned int id;
+};
+
+//! \c n QoS that differ in their ownership strength
+std::vector<core::types::SpecificEndpointQoS> different_qos(
+        unsigned int n)
+{
+    std::vector<core::types::SpecificEndpointQoS> qos(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        qos[i].ownership_strength.value = i;
+    }
+    return qos;
+}
+
+//! \c n dummy Writers with consecutive ids
+std::vector<Writer> writers(
+        unsigned int n)
+{
+    std::vector<Writer> result(n);
+    for (unsigned int i = 0; i < n; i++)
+    {
+        result[i].id = i;
+    }
+    return result;
+}
+
+/**
+ * MultiWriter that gives access to its Writers lookup.
+ *
+ * Its Writers are registered as \c get_writer_or_create_ does, but they are dummy pointers, as creating
+ * real ones requires an RTPS Participant. They are removed before the MultiWriter destroys them.
+ */
+class TestMultiWriter : public rtps::MultiWriter
+{
+public:
+
+    using rtps::MultiWriter::WritersMapType;
+
+    TestMultiWriter(
+            const std::shared_ptr<core::PayloadPool>& payload_pool)
+        : rtps::MultiWriter("TestParticipant", core::types::DdsTopic(), payload_pool, nullptr)
+    {
+    }
+
+    ~TestMultiWriter()
+    {
+        std::unique_lock<WritersMapType> lock(writers_map_);
+        writers_map_.clear();
+    }
+
+    //! Register \c writer for \c qos and return whether it fits in the cache
+    bool add_writer(
+            const core::types::SpecificEndpointQoS& qos,
+            rtps::QoSSpecificWriter* writer)
+    {
+        std::unique_lock<WritersMapType> lock(writers_map_);
+        auto inserted = writers_map_.emplace(qos, writer);
+        return writers_cache_.insert(qos.hash(), inserted.first->first, writer);
+    }
+
+    rtps::QoSSpecificWriter* get_writer(
+            const core::types::SpecificEndpointQoS& qos)
+    {
+        return get_writer_or_create_(qos, qos.hash());
+    }
+
+    WritersMapType& writers_map()
+    {
+        return writers_map_;
+    }
+
+    unsigned int cache_size() const
+    {
+        return writers_cache_.size();
+    }
+};
+
+} // test
+
+/**
+ * Insert QoS with the same hash, and with hashes whose probing wraps around the end of the table,
+ * and check that each one finds its own Writer and that QoS not inserted are not found.
+ */
+TEST(QoSWriterCacheTest, colliding_hashes)
+{
+    constexpr const unsigned int CAPACITY = 16;
+    constexpr const std::size_t LAST_SLOT_HASH = CAPACITY - 1;
+
+    auto qos = test::different_qos(8);
+    auto writers = test::writers(8);
+    QoSWriterCache<test::Writer> cache(CAPACITY);
+
+    // Same hash, different QoS
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(cache.insert(1, qos[i], &writers[i]));
+    }
+
+    // Hashes of the last slot (one of them only differs in the bits over the slot index), so probing wraps around
+    ASSERT_TRUE(cache.insert(LAST_SLOT_HASH, qos[4], &writers[4]));
+    ASSERT_TRUE(cache.insert(LAST_SLOT_HASH + CAPACITY, qos[5], &writers[5]));
+    ASSERT_TRUE(cache.insert(LAST_SLOT_HASH, qos[6], &writers[6]));
+
+    ASSERT_EQ(cache.size(), 7u);
+
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        ASSERT_EQ(cache.find(1, qos[i]), &writers[i]);
+    }
+    ASSERT_EQ(cache.find(LAST_SLOT_HASH, qos[4]), &writers[4]);
+    ASSERT_EQ(cache.find(LAST_SLOT_HASH + CAPACITY, qos[5]), &writers[5]);
+    ASSERT_EQ(cache.find(LAST_SLOT_HASH, qos[6]), &writers[6]);
+
+    // Same hash as inserted ones but a QoS not inserted
+    ASSERT_EQ(cache.find(1, qos[7]), nullptr);
+    ASSERT_EQ(cache.find(LAST_SLOT_HASH, qos[7]), nullptr);
+
+    // Inserted QoS with a hash it was not inserted with
+    ASSERT_EQ(cache.find(LAST_SLOT_HASH, qos[5]), nullptr);
+    ASSERT_EQ(cache.find(2, qos[0]), nullptr);
+}
+
+/**
+ * Fill the cache and check that it refuses new entries once 3/4 of it are used, keeping the ones it has.
+ */
+TEST(QoSWriterCacheTest, refuse_over_three_quarters)
+{
+    constexpr const unsigned int CAPACITY = 16;
+    constexpr const unsigned int MAX_ENTRIES = CAPACITY * 3 / 4;
+
+    auto qos = test::different_qos(MAX_ENTRIES + 1);
+    auto writers = test::writers(MAX_ENTRIES + 1);
+    QoSWriterCache<test::Writer> cache(CAPACITY);
+
+    for (unsigned int i = 0; i < MAX_ENTRIES; i++)
+    {
+        ASSERT_TRUE(cache.insert(qos[i].hash(), qos[i], &writers[i]));
+    }
+
+    ASSERT_FALSE(cache.insert(qos[MAX_ENTRIES].hash(), qos[MAX_ENTRIES], &writers[MAX_ENTRIES]));
+    ASSERT_EQ(cache.size(), MAX_ENTRIES);
+    ASSERT_EQ(cache.find(qos[MAX_ENTRIES].hash(), qos[MAX_ENTRIES]), nullptr);
+
+    for (unsigned int i = 0; i < MAX_ENTRIES; i++)
+    {
+        ASSERT_EQ(cache.find(qos[i].hash(), qos[i]), &writers[i]);
+    }
+}
+
+/**
+ * Register in a MultiWriter more QoS than fit in its cache, and check that the Writers that are not in the
+ * cache are found in its map while another thread holds a shared lock of it (so only a shared lock is taken).
+ */
+TEST(QoSWriterCacheTest, multiwriter_falls_back_to_map)
+{
+    constexpr const unsigned int MAX_ENTRIES = QoSWriterCache<rtps::QoSSpecificWriter>::DEFAULT_CAPACITY * 3 / 4;
+    constexpr const unsigned int N_QOS = MAX_ENTRIES + 8;
+
+    std::shared_ptr<core::PayloadPool> payload_pool = std::make_shared<core::FastPayloadPool>();
+    test::TestMultiWriter multi_writer(payload_pool);
+
+    // Dummy Writers, never dereferenced
+    std::vector<char> storage(N_QOS);
+    auto dummy_writer = [&storage](unsigned int i)
+            {
+                return reinterpret_cast<rtps::QoSSpecificWriter*>(&storage[i]);
+            };
+
+    auto qos = test::different_qos(N_QOS);
+    unsigned int not_cached = 0;
+    for (unsigned int i = 0; i < N_QOS; i++)
+    {
+        if (!multi_writer.add_writer(qos[i], dummy_writer(i)))
+        {
+            not_cached++;
+        }
+    }
+    ASSERT_EQ(multi_writer.cache_size(), MAX_ENTRIES);
+    ASSERT_EQ(not_cached, N_QOS - MAX_ENTRIES);
+
+    std::shared_lock<test::TestMultiWriter::WritersMapType> lock(multi_writer.writers_map());
+
+    auto lookup = std::async(std::launch::async, [&]()
+                    {
+                        for (unsigned int i = 0; i < N_QOS; i++)
+                        {
+                            if (multi_writer.get_writer(qos[i]) != dummy_writer(i))
+                            {
+                                return false;
+                            }
+                        }
+                        return true;
+                    });
+
+    // It would block if it took the exclusive lock (i.e. if it tried to create a Writer)
+    bool finished = lookup.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    lock.unlock();
+
+    ASSERT_TRUE(finished);
+    ASSERT_TRUE(lookup.get());
+}
+
+/**
+ * Look up every QoS from several threads while another one inserts them, with many colliding hashes,
+ * and check that a lookup only returns the Writer of its QoS, and always does once it has been inserted.
+ */
+TEST(QoSWriterCacheTest, find_while_inserting)
+{
+    constexpr const unsigned int CAPACITY = 1024;
+    constexpr const unsigned int N_QOS = 600;
+    constexpr const unsigned int N_HASHES = 32;
+
+    auto qos = test::different_qos(N_QOS);
+    auto writers = test::writers(N_QOS);
+    QoSWriterCache<test::Writer> cache(CAPACITY);
+
+    // Few hashes, starting near the end of the table, so probing is long and wraps around
+    auto hash = [](unsigned int i)
+            {
+                return static_cast<std::size_t>(CAPACITY - N_HASHES / 2 + i % N_HASHES);
+            };
+
+    std::atomic<unsigned int> inserted(0);
+    std::atomic<unsigned int> wrong_writers(0);
+    std::atomic<unsigned int> missing_writers(0);
+
+    std::vector<std::thread> readers;
+    for (unsigned int r = 0; r < test::N_READERS; r++)
+    {
+        readers.emplace_back([&]()
+                {
+                    while (inserted < N_QOS)
+                    {
+                        for (unsigned int i = 0; i < N_QOS; i++)
+                        {
+                            bool already_inserted = i < inserted;
+                            test::Writer* writer = cache.find(hash(i), qos[i]);
+
+                            if (writer != nullptr && writer != &writers[i])
+                            {
+                                wrong_writers++;
+                            }
+                            else if (writer == nullptr && already_inserted)
+                            {
+                                missing_writers++;
+                            }
+                        }
+                    }
+                });
+    }
+
+    for (unsigned int i = 0; i < N_QOS; i++)
+    {
+        EXPECT_TRUE(cache.insert(hash(i), qos[i], &writers[i]));
+        inserted++;
+    }
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_EQ(wrong_writers.load(), 0u);
+    ASSERT_EQ(missing_writers.load(), 0u);
+
+    for (unsigned int i = 0; i < N_QOS; i++)
+    {
+        ASSERT_EQ(cache.find(hash(i), qos[i]), &writers[i]);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,315 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/DynamicTypeBuilderPtr.h>
+#include <fastrtps/types/TypeObjectFactory.h>
+
+#include <ddspipe_participants/participant/dynamic_types/TypeObjectCache.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe::participants;
+using namespace eprosima::fastrtps::types;
+
+namespace test {
+
+//! Type identifier and object of a struct
+struct TestType
+{
+    TypeIdentifier identifier;
+    TypeObject object;
+};
+
+//! Build (and register in the factory) a struct \c type_name with \c n_members members
+TestType build_type(
+        const std::string& type_name,
+        unsigned int n_members)
+{
+    DynamicTypeBuilder_ptr builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    for (unsigned int i = 0; i < n_members; i++)
+    {
+        builder->add_member(
+            i, "member_" + std::to_string(i), DynamicTypeBuilderFactory::get_instance()->create_int32_type());
+    }
+    builder->set_name(type_name);
+    DynamicType_ptr dynamic_type = builder->build();
+
+    TestType result;
+    DynamicTypeBuilderFactory::get_instance()->build_type_object(dynamic_type, result.object, true);
+    result.identifier = *TypeObjectFactory::get_instance()->get_type_identifier(type_name, true);
+    return result;
+}
+
+//! Build (and register in the factory, with its member) a struct \c type_name with a struct member \c member_name
+TestType build_nested_type(
+        const std::string& type_name,
+        const std::string& member_name)
+{
+    DynamicTypeBuilder_ptr member_builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    member_builder->add_member(0, "value", DynamicTypeBuilderFactory::get_instance()->create_int32_type());
+    member_builder->set_name(member_name);
+
+    DynamicTypeBuilder_ptr builder = DynamicTypeBuilderFactory::get_instance()->create_struct_builder();
+    builder->add_member(0, "nested", member_builder->build());
+    builder->set_name(type_name);
+    DynamicType_ptr dynamic_type = builder->build();
+
+    TestType result;
+    DynamicTypeBuilderFactory::get_instance()->build_type_object(dynamic_type, result.object, true);
+    result.identifier = *TypeObjectFactory::get_instance()->get_type_identifier(type_name, true);
+    return result;
+}
+
+//! Name of a cache file for \c test_name , removed if it already exists
+std::string cache_file(
+        const std::string& test_name)
+{
+    std::string file_path = "TypeObjectCacheTest_" + test_name + ".cache";
+    std::remove(file_path.c_str());
+    return file_path;
+}
+
+//! Bytes of file \c file_path
+std::vector<char> read_file(
+        const std::string& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+//! Replace the content of file \c file_path
+void write_file(
+        const std::string& file_path,
+        const std::vector<char>& content)
+{
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size());
+}
+
+} // test
+
+/**
+ * Store a type and check that it is loaded by a new cache of the same file.
+ *
+ * CASES:
+ *  a type already stored is not stored again
+ *  a type loaded is not stored again
+ */
+TEST(TypeObjectCacheTest, store_and_load)
+{
+    std::string file_path = test::cache_file("store_and_load");
+    test::TestType type = test::build_type("StoreAndLoadType", 2);
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.load(), 0u);
+        ASSERT_TRUE(cache.store("StoreAndLoadType", type.identifier, type.object));
+        ASSERT_FALSE(cache.store("StoreAndLoadType", type.identifier, type.object));
+        ASSERT_EQ(cache.size(), 1u);
+    }
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.load(), 1u);
+        ASSERT_EQ(cache.size(), 1u);
+        ASSERT_FALSE(cache.store("StoreAndLoadType", type.identifier, type.object));
+    }
+}
+
+/**
+ * Store a struct with a struct member and check that both are loaded by a new cache of the same file, and that
+ * the struct can be built from the types loaded.
+ *
+ * CASES:
+ *  the member type is stored with the struct
+ *  types already stored are not stored again
+ */
+TEST(TypeObjectCacheTest, store_and_load_dependencies)
+{
+    std::string file_path = test::cache_file("store_and_load_dependencies");
+    test::TestType type = test::build_nested_type("OuterNestedType", "InnerNestedType");
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.store_with_dependencies("OuterNestedType", type.identifier, type.object), 2u);
+        ASSERT_EQ(cache.store_with_dependencies("OuterNestedType", type.identifier, type.object), 0u);
+        ASSERT_EQ(cache.size(), 2u);
+    }
+
+    std::vector<char> content = test::read_file(file_path);
+    std::string inner_name = "InnerNestedType";
+    ASSERT_NE(std::search(content.begin(), content.end(), inner_name.begin(), inner_name.end()), content.end());
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.load(), 2u);
+        ASSERT_EQ(cache.store_with_dependencies("OuterNestedType", type.identifier, type.object), 0u);
+    }
+
+    DynamicType_ptr dynamic_type = TypeObjectFactory::get_instance()->build_dynamic_type(
+        "OuterNestedType", &type.identifier, &type.object);
+    ASSERT_TRUE(dynamic_type);
+    ASSERT_EQ(dynamic_type->get_members_count(), 1u);
+}
+
+/**
+ * Store a type twice with different definitions and check that only the last one is loaded.
+ */
+TEST(TypeObjectCacheTest, load_last_record_of_type)
+{
+    std::string file_path = test::cache_file("load_last_record_of_type");
+    test::TestType old_type = test::build_type("OldDefinitionType", 1);
+    test::TestType new_type = test::build_type("NewDefinitionType", 3);
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_TRUE(cache.store("ChangedType", old_type.identifier, old_type.object));
+        ASSERT_TRUE(cache.store("ChangedType", new_type.identifier, new_type.object));
+        ASSERT_EQ(cache.size(), 1u);
+    }
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.load(), 1u);
+        ASSERT_FALSE(cache.store("ChangedType", new_type.identifier, new_type.object));
+        ASSERT_TRUE(cache.store("ChangedType", old_type.identifier, old_type.object));
+    }
+}
+
+/**
+ * Cut the last record of a cache file (as if the process was killed while storing it) and check that the
+ * previous records are loaded.
+ */
+TEST(TypeObjectCacheTest, ignore_truncated_record)
+{
+    std::string file_path = test::cache_file("ignore_truncated_record");
+    test::TestType first_type = test::build_type("FirstStoredType", 1);
+    test::TestType second_type = test::build_type("SecondStoredType", 2);
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_TRUE(cache.store("FirstStoredType", first_type.identifier, first_type.object));
+        ASSERT_TRUE(cache.store("SecondStoredType", second_type.identifier, second_type.object));
+    }
+
+    std::vector<char> content = test::read_file(file_path);
+    content.resize(content.size() - 3);
+    test::write_file(file_path, content);
+
+    TypeObjectCache cache(file_path);
+    ASSERT_EQ(cache.load(), 1u);
+}
+
+/**
+ * Leave a partial record at the end of a cache file (as if the process was killed while storing it) and check that
+ * the types stored after loading it are read afterwards.
+ */
+TEST(TypeObjectCacheTest, store_after_truncated_record)
+{
+    std::string file_path = test::cache_file("store_after_truncated_record");
+    test::TestType first_type = test::build_type("FirstStoredTypeBeforeTruncated", 1);
+    test::TestType truncated_type = test::build_type("TruncatedType", 2);
+    test::TestType last_type = test::build_type("LastStoredTypeAfterTruncated", 3);
+
+    std::vector<char> valid_content;
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_TRUE(cache.store("FirstStoredTypeBeforeTruncated", first_type.identifier, first_type.object));
+        valid_content = test::read_file(file_path);
+        ASSERT_TRUE(cache.store("TruncatedType", truncated_type.identifier, truncated_type.object));
+    }
+
+    std::vector<char> content = test::read_file(file_path);
+    content.resize(content.size() - 3);
+    test::write_file(file_path, content);
+
+    {
+        TypeObjectCache cache(file_path);
+        ASSERT_EQ(cache.load(), 1u);
+
+        // The partial record is removed from the file
+        ASSERT_EQ(test::read_file(file_path), valid_content);
+
+        ASSERT_TRUE(cache.store("LastStoredTypeAfterTruncated", last_type.identifier, last_type.object));
+    }
+
+    TypeObjectCache cache(file_path);
+    ASSERT_EQ(cache.load(), 2u);
+    ASSERT_EQ(cache.size(), 2u);
+}
+
+/**
+ * Check that a file that is not a cache is ignored.
+ */
+TEST(TypeObjectCacheTest, ignore_other_files)
+{
+    std::string file_path = test::cache_file("ignore_other_files");
+    std::string content = "participants:\n  - name: participant\n";
+    test::write_file(file_path, std::vector<char>(content.begin(), content.end()));
+
+    TypeObjectCache cache(file_path);
+    ASSERT_EQ(cache.load(), 0u);
+    ASSERT_EQ(cache.size(), 0u);
+}
+
+/**
+ * Check the validation of a type identifier against the type information discovered.
+ *
+ * CASES:
+ *  type information without identifiers
+ *  type information with the same identifier
+ *  type information with another identifier
+ */
+TEST(TypeObjectCacheTest, validate_type_information)
+{
+    test::TestType type = test::build_type("ValidatedType", 2);
+    test::TestType other_type = test::build_type("OtherValidatedType", 4);
+
+    {
+        TypeInformation type_information;
+        ASSERT_TRUE(TypeObjectCache::is_valid(type.identifier, type_information));
+    }
+
+    {
+        TypeInformation type_information;
+        type_information.complete().typeid_with_size().type_id(type.identifier);
+        ASSERT_TRUE(TypeObjectCache::is_valid(type.identifier, type_information));
+    }
+
+    {
+        TypeInformation type_information;
+        type_information.complete().typeid_with_size().type_id(other_type.identifier);
+        ASSERT_FALSE(TypeObjectCache::is_valid(type.identifier, type_information));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -45,6 +45,11 @@ constexpr const char* QOS_OWNERSHIP_TAG("ownership"); //! The Endpoints of that
 constexpr const char* QOS_KEYED_TAG("keyed"); //! Kind of a topic (with or without key)
 constexpr const char* QOS_DOWNSAMPLING_TAG("downsampling"); //! Topic specific downsampling factor
 constexpr const char* QOS_MAX_RECEPTION_RATE_TAG("max-reception-rate"); //! Topic specific max reception rate
+constexpr const char* QOS_BATCH_SIZE_TAG("batch-size"); //! Topic specific max number of samples transmitted at once
+constexpr const char* QOS_FANOUT_QUEUE_SIZE_TAG("fanout-queue-size"); //! Topic specific size of the writer queues to write in parallel
+constexpr const char* QOS_PRIORITY_TAG("priority"); //! Topic specific priority class of its transmission tasks
+constexpr const char* QOS_ADAPTIVE_HISTORY_TAG("adaptive-history"); //! Topic specific adaptive sizing of the histories
+constexpr const char* QOS_MEMORY_BUDGET_TAG("memory-budget"); //! Topic specific maximum bytes of payloads held
 
 // Participant related tags
 constexpr const char* PARTICIPANT_KIND_TAG("kind");   //! Participant Kind
@@ -79,6 +84,9 @@ constexpr const char* IGNORE_PARTICIPANT_FLAGS_DIFFERENT_AND_SAME_PROCESS_TAG("f
 // Simple RTPS related tags
 constexpr const char* DOMAIN_ID_TAG("domain"); //! Domain Id of the participant
 
+// Dynamic types related tags
+constexpr const char* TYPE_CACHE_FILE_TAG("type-cache-file"); //! File where discovered types are cached
+
 // Discovery Server related tags
 constexpr const char* DISCOVERY_SERVER_GUID_PREFIX_TAG("discovery-server-guid"); //! TODO: add comment
 constexpr const char* LISTENING_ADDRESSES_TAG("listening-addresses"); //! TODO: add comment
@@ -131,11 +139,32 @@ constexpr const char* TOPIC_ROUTES_TAG("topic-routes"); // Topic specific forwar
 // Advanced configuration
 constexpr const char* SPECS_TAG("specs"); //! Specs options for DDS Router configuration
 constexpr const char* NUMBER_THREADS_TAG("threads"); //! Number of threads to configure the thread pool
+constexpr const char* THREAD_POOL_SCHEDULER_TAG("scheduler"); //! Scheduling policy of the thread pool
+constexpr const char* THREAD_POOL_SCHEDULER_FIFO_TAG("fifo"); //! One queue of tasks shared by every thread (default)
+constexpr const char* THREAD_POOL_SCHEDULER_WORK_STEALING_TAG("work-stealing"); //! One queue of tasks per thread with work stealing
+constexpr const char* MESSAGES_PER_TURN_TAG("messages-per-turn"); //! Transmit up to *messages_per_turn* samples before yielding the thread to other tasks
+constexpr const char* THREAD_POOL_SCHEDULER_PRIORITY_TAG("priority"); //! One queue of tasks per priority class, higher classes first
+constexpr const char* PRIORITY_CLASSES_TAG("priority-classes"); //! Number of priority classes (only with priority scheduler)
+constexpr const char* STARVATION_TIMEOUT_TAG("starvation-timeout"); //! Execute a task ahead of higher classes after waiting *starvation_timeout* ms (only with priority scheduler)
+constexpr const char* CPU_PINNING_TAG("cpu-pinning"); //! Pin each thread of the thread pool to a CPU core (only with work-stealing scheduler)
 constexpr const char* MAX_HISTORY_DEPTH_TAG("max-depth"); //! Maximum size (number of stored cache changes) for RTPS History instances
 constexpr const char* DOWNSAMPLING_TAG("downsampling"); //! Keep 1 out of every *downsampling* samples received
 constexpr const char* MAX_RECEPTION_RATE_TAG("max-reception-rate"); //! Process up to *max_reception_rate* samples in a 1 second bin
+constexpr const char* FANOUT_QUEUE_SIZE_TAG("fanout-queue-size"); //! Write each writer of a Track in parallel, queueing up to *fanout_queue_size* samples per writer
+constexpr const char* PRIORITY_TAG("priority"); //! Priority class of the transmission tasks of the Tracks
+constexpr const char* ADAPTIVE_HISTORY_TAG("adaptive-history"); //! Reserve a few cache changes per history and grow (or shrink) them with the backlog
+constexpr const char* MEMORY_BUDGET_TAG("memory-budget"); //! Memory budget of the payloads held by the pipe
+constexpr const char* MEMORY_BUDGET_MAX_BYTES_TAG("max-bytes"); //! Maximum bytes of payloads held by the pipe (0 for unlimited)
+constexpr const char* MEMORY_BUDGET_POLICY_TAG("policy"); //! Reaction when a memory budget is exceeded
+constexpr const char* MEMORY_BUDGET_POLICY_DROP_OLDEST_TAG("drop-oldest"); //! Remove the oldest samples of the topic from the Writers histories (default)
+constexpr const char* MEMORY_BUDGET_POLICY_REJECT_TAG("reject"); //! Discard the new samples of the topic
+constexpr const char* MEMORY_BUDGET_POLICY_DOWNSAMPLE_TAG("downsample"); //! Keep 1 out of every *downsampling* new samples of the topic
 constexpr const char* WAIT_ALL_ACKED_TIMEOUT_TAG("wait-all-acked-timeout"); //! Wait for a maximum of *wait-all-acked-timeout* ms until all msgs sent by reliable writers are acknowledged by their matched readers
 constexpr const char* REMOVE_UNUSED_ENTITIES_TAG("remove-unused-entities"); //! Dynamically create and delete entities and tracks.
+constexpr const char* BRIDGE_CREATION_THREADS_TAG("bridge-creation-threads"); //! Create up to *bridge_creation_threads* Bridges (and their entities) concurrently
+constexpr const char* LAZY_READERS_TAG("lazy-readers"); //! Create each Reader only while its Participant discovers active Writers in the topic
+constexpr const char* LAZY_READERS_IDLE_TIMEOUT_TAG("lazy-readers-idle-timeout"); //! Destroy a lazy Reader after *lazy_readers_idle_timeout* ms without active Writers
+constexpr const char* RPC_REQUEST_EXPIRY_TAG("rpc-request-expiry"); //! Forget a service request without reply after *rpc_request_expiry* ms (0 for never)
 
 // XML configuration tags
 constexpr const char* XML_TAG("xml"); //! Tag to read xml configuration
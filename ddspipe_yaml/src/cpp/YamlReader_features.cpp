@@ -15,7 +15,9 @@
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/memory/Heritable.hpp>
 
+#include <ddspipe_core/configuration/MemoryBudgetConfiguration.hpp>
 #include <ddspipe_core/configuration/RoutesConfiguration.hpp>
+#include <ddspipe_core/configuration/ThreadPoolConfiguration.hpp>
 #include <ddspipe_core/configuration/TopicRoutesConfiguration.hpp>
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/topic/dds/DistributedTopic.hpp>
@@ -209,6 +211,120 @@ core::TopicRoutesConfiguration YamlReader::get(
     return object;
 }
 
+/******************************
+* Thread Pool Configuration   *
+******************************/
+
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        core::ThreadPoolConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional number of threads
+    if (is_tag_present(yml, NUMBER_THREADS_TAG))
+    {
+        object.n_threads = get_positive_int(yml, NUMBER_THREADS_TAG);
+    }
+
+    // Optional scheduler
+    if (is_tag_present(yml, THREAD_POOL_SCHEDULER_TAG))
+    {
+        object.kind = get_enumeration<core::ThreadPoolKind>(
+            yml,
+            THREAD_POOL_SCHEDULER_TAG,
+                    {
+                        {THREAD_POOL_SCHEDULER_FIFO_TAG, core::ThreadPoolKind::fifo},
+                        {THREAD_POOL_SCHEDULER_WORK_STEALING_TAG, core::ThreadPoolKind::work_stealing},
+                        {THREAD_POOL_SCHEDULER_PRIORITY_TAG, core::ThreadPoolKind::priority},
+                    });
+    }
+
+    // Optional messages per turn
+    if (is_tag_present(yml, MESSAGES_PER_TURN_TAG))
+    {
+        object.messages_per_turn = get_nonnegative_int(yml, MESSAGES_PER_TURN_TAG);
+    }
+
+    // Optional CPU pinning
+    if (is_tag_present(yml, CPU_PINNING_TAG))
+    {
+        object.cpu_pinning = get<bool>(yml, CPU_PINNING_TAG, version);
+    }
+
+    // Optional number of priority classes
+    if (is_tag_present(yml, PRIORITY_CLASSES_TAG))
+    {
+        object.priority_classes = get_positive_int(yml, PRIORITY_CLASSES_TAG);
+    }
+
+    // Optional starvation timeout
+    if (is_tag_present(yml, STARVATION_TIMEOUT_TAG))
+    {
+        object.starvation_timeout = get_nonnegative_int(yml, STARVATION_TIMEOUT_TAG);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+core::ThreadPoolConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    core::ThreadPoolConfiguration object;
+    fill<core::ThreadPoolConfiguration>(object, yml, version);
+    return object;
+}
+
+/******************************
+* Memory Budget Configuration *
+******************************/
+
+template <>
+DDSPIPE_YAML_DllAPI
+void YamlReader::fill(
+        core::MemoryBudgetConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional maximum bytes
+    if (is_tag_present(yml, MEMORY_BUDGET_MAX_BYTES_TAG))
+    {
+        object.max_bytes = get<uint64_t>(yml, MEMORY_BUDGET_MAX_BYTES_TAG, version);
+    }
+
+    // Optional policy
+    if (is_tag_present(yml, MEMORY_BUDGET_POLICY_TAG))
+    {
+        object.policy = get_enumeration<core::MemoryBudgetPolicy>(
+            yml,
+            MEMORY_BUDGET_POLICY_TAG,
+                    {
+                        {MEMORY_BUDGET_POLICY_DROP_OLDEST_TAG, core::MemoryBudgetPolicy::drop_oldest},
+                        {MEMORY_BUDGET_POLICY_REJECT_TAG, core::MemoryBudgetPolicy::reject},
+                        {MEMORY_BUDGET_POLICY_DOWNSAMPLE_TAG, core::MemoryBudgetPolicy::downsample},
+                    });
+    }
+
+    // Optional downsampling factor
+    if (is_tag_present(yml, DOWNSAMPLING_TAG))
+    {
+        object.downsampling = get_positive_int(yml, DOWNSAMPLING_TAG);
+    }
+}
+
+template <>
+DDSPIPE_YAML_DllAPI
+core::MemoryBudgetConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    core::MemoryBudgetConfiguration object;
+    fill<core::MemoryBudgetConfiguration>(object, yml, version);
+    return object;
+}
+
 } /* namespace yaml */
 } /* namespace ddspipe */
 } /* namespace eprosima */
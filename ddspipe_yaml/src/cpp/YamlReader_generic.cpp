@@ -104,6 +104,15 @@ unsigned int YamlReader::get<unsigned int>(
     return get_scalar<unsigned int>(yml);
 }
 
+template <>
+DDSPIPE_YAML_DllAPI
+uint64_t YamlReader::get<uint64_t>(
+        const Yaml& yml,
+        const YamlReaderVersion version /* version */)
+{
+    return get_scalar<uint64_t>(yml);
+}
+
 unsigned int YamlReader::get_nonnegative_int(
         const Yaml& yml,
         const TagType& tag)
@@ -160,6 +160,12 @@ void YamlReader::fill(
     {
         object.ignore_participant_flags = core::types::IgnoreParticipantFlags::no_filter;
     }
+
+    // Optional type cache file
+    if (YamlReader::is_tag_present(yml, TYPE_CACHE_FILE_TAG))
+    {
+        object.type_cache_file = get<std::string>(yml, TYPE_CACHE_FILE_TAG, version);
+    }
 }
 
 template <>
@@ -417,6 +417,36 @@ void YamlReader::fill(
     {
         object.max_reception_rate = get<unsigned int>(yml, QOS_MAX_RECEPTION_RATE_TAG, version);
     }
+
+    // Batch size optional
+    if (is_tag_present(yml, QOS_BATCH_SIZE_TAG))
+    {
+        object.batch_size = get_positive_int(yml, QOS_BATCH_SIZE_TAG);
+    }
+
+    // Fan-out queue size optional
+    if (is_tag_present(yml, QOS_FANOUT_QUEUE_SIZE_TAG))
+    {
+        object.fanout_queue_size = get<unsigned int>(yml, QOS_FANOUT_QUEUE_SIZE_TAG, version);
+    }
+
+    // Priority optional
+    if (is_tag_present(yml, QOS_PRIORITY_TAG))
+    {
+        object.priority = get_nonnegative_int(yml, QOS_PRIORITY_TAG);
+    }
+
+    // Adaptive history optional
+    if (is_tag_present(yml, QOS_ADAPTIVE_HISTORY_TAG))
+    {
+        object.adaptive_history = get<bool>(yml, QOS_ADAPTIVE_HISTORY_TAG, version);
+    }
+
+    // Memory budget optional
+    if (is_tag_present(yml, QOS_MEMORY_BUDGET_TAG))
+    {
+        object.memory_budget = get<uint64_t>(yml, QOS_MEMORY_BUDGET_TAG, version);
+    }
 }
 
 /************************
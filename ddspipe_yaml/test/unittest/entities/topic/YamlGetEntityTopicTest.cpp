@@ -135,6 +135,86 @@ TEST(YamlGetEntityTopicTest, get_real_topic)
     }
 }
 
+/**
+ * Test read the adaptive history QoS of a core::types::DdsTopic from yaml
+ *
+ * CASES:
+ * - Not set: disabled by default
+ * - Set to true
+ */
+TEST(YamlGetEntityTopicTest, get_real_topic_adaptive_history)
+{
+    // Not set
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = test::TOPIC_NAME;
+        yml["topic"][TOPIC_TYPE_NAME_TAG] = test::TOPIC_TYPE;
+
+        core::types::DdsTopic topic = YamlReader::get<core::types::DdsTopic>(yml, "topic", LATEST);
+
+        ASSERT_FALSE(topic.topic_qos.adaptive_history);
+    }
+
+    // Set to true
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = test::TOPIC_NAME;
+        yml["topic"][TOPIC_TYPE_NAME_TAG] = test::TOPIC_TYPE;
+        yml["topic"][TOPIC_QOS_TAG][QOS_ADAPTIVE_HISTORY_TAG] = true;
+
+        core::types::DdsTopic topic = YamlReader::get<core::types::DdsTopic>(yml, "topic", LATEST);
+
+        ASSERT_TRUE(topic.topic_qos.adaptive_history);
+        test::compare_topic(topic, test::TOPIC_NAME, test::TOPIC_TYPE);
+    }
+}
+
+/**
+ * Test read the batch size of a core::types::DdsTopic from yaml
+ *
+ * CASES:
+ * - Not set: no batching by default
+ * - Set to 8
+ * - Set to 0: not valid
+ */
+TEST(YamlGetEntityTopicTest, get_real_topic_batch_size)
+{
+    // Not set
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = test::TOPIC_NAME;
+        yml["topic"][TOPIC_TYPE_NAME_TAG] = test::TOPIC_TYPE;
+
+        core::types::DdsTopic topic = YamlReader::get<core::types::DdsTopic>(yml, "topic", LATEST);
+
+        ASSERT_EQ(topic.topic_qos.batch_size, 1u);
+    }
+
+    // Set to 8
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = test::TOPIC_NAME;
+        yml["topic"][TOPIC_TYPE_NAME_TAG] = test::TOPIC_TYPE;
+        yml["topic"][TOPIC_QOS_TAG][QOS_BATCH_SIZE_TAG] = 8;
+
+        core::types::DdsTopic topic = YamlReader::get<core::types::DdsTopic>(yml, "topic", LATEST);
+
+        ASSERT_EQ(topic.topic_qos.batch_size, 8u);
+        test::compare_topic(topic, test::TOPIC_NAME, test::TOPIC_TYPE);
+    }
+
+    // Set to 0
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = test::TOPIC_NAME;
+        yml["topic"][TOPIC_TYPE_NAME_TAG] = test::TOPIC_TYPE;
+        yml["topic"][TOPIC_QOS_TAG][QOS_BATCH_SIZE_TAG] = 0;
+
+        ASSERT_THROW(YamlReader::get<core::types::DdsTopic>(yml, "topic",
+                LATEST), eprosima::utils::ConfigurationException);
+    }
+}
+
 /**
  * Test read core::types::DdsTopic from yaml in negative cases
  * CASES:
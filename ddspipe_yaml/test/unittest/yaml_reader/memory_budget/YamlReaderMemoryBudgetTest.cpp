@@ -0,0 +1,153 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+
+#include <ddspipe_yaml/YamlReader.hpp>
+#include <ddspipe_yaml/yaml_configuration_tags.hpp>
+
+#include <ddspipe_core/configuration/MemoryBudgetConfiguration.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::yaml;
+
+/**
+ * Check the get function for MemoryBudgetConfiguration.
+ *
+ * CASES:
+ *  Check that a memory budget section without tags gives an unlimited budget with the drop oldest policy.
+ */
+TEST(YamlReaderMemoryBudgetTest, default_values)
+{
+    const char* yml_str =
+            R"(
+            max-depth: 100
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::MemoryBudgetConfiguration conf =
+            YamlReader::get<core::MemoryBudgetConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    ASSERT_EQ(conf.max_bytes, 0u);
+    ASSERT_EQ(conf.policy, core::MemoryBudgetPolicy::drop_oldest);
+    ASSERT_EQ(conf.downsampling, 2u);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+}
+
+/**
+ * Check the get function for MemoryBudgetConfiguration.
+ *
+ * CASES:
+ *  Check that every memory budget tag is read, with a budget over 4 GB.
+ */
+TEST(YamlReaderMemoryBudgetTest, all_tags)
+{
+    const char* yml_str =
+            R"(
+            max-bytes: 8589934592
+            policy: downsample
+            downsampling: 5
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::MemoryBudgetConfiguration conf =
+            YamlReader::get<core::MemoryBudgetConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    ASSERT_EQ(conf.max_bytes, 8589934592u);
+    ASSERT_EQ(conf.policy, core::MemoryBudgetPolicy::downsample);
+    ASSERT_EQ(conf.downsampling, 5u);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+}
+
+/**
+ * Check the get function for MemoryBudgetConfiguration.
+ *
+ * CASES:
+ *  Check that an exception is thrown when the policy is not known.
+ */
+TEST(YamlReaderMemoryBudgetTest, throw_exception_when_unknown_policy)
+{
+    const char* yml_str =
+            R"(
+            policy: drop-newest
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    ASSERT_THROW(
+        YamlReader::get<core::MemoryBudgetConfiguration>(yml, YamlReaderVersion::LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+/**
+ * Check the get function for MemoryBudgetConfiguration.
+ *
+ * CASES:
+ *  Check that an exception is thrown when the downsampling factor is 0.
+ */
+TEST(YamlReaderMemoryBudgetTest, throw_exception_when_zero_downsampling)
+{
+    const char* yml_str =
+            R"(
+            policy: downsample
+            downsampling: 0
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    ASSERT_THROW(
+        YamlReader::get<core::MemoryBudgetConfiguration>(yml, YamlReaderVersion::LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+/**
+ * Check the fill function for TopicQoS.
+ *
+ * CASES:
+ *  Check that the memory budget of a topic is read.
+ */
+TEST(YamlReaderMemoryBudgetTest, topic_memory_budget)
+{
+    const char* yml_str =
+            R"(
+            depth: 10
+            memory-budget: 1048576
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::types::TopicQoS qos;
+    YamlReader::fill<core::types::TopicQoS>(qos, yml, YamlReaderVersion::LATEST);
+
+    ASSERT_EQ(qos.memory_budget, 1048576u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,184 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+
+#include <ddspipe_yaml/YamlReader.hpp>
+#include <ddspipe_yaml/yaml_configuration_tags.hpp>
+
+#include <ddspipe_core/configuration/ThreadPoolConfiguration.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddspipe;
+using namespace eprosima::ddspipe::yaml;
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that a specs section without thread pool tags gives the default FIFO configuration.
+ */
+TEST(YamlReaderThreadPoolTest, default_values)
+{
+    const char* yml_str =
+            R"(
+            max-depth: 100
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::ThreadPoolConfiguration conf =
+            YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    core::ThreadPoolConfiguration default_conf;
+    ASSERT_EQ(conf.kind, core::ThreadPoolKind::fifo);
+    ASSERT_EQ(conf.n_threads, default_conf.n_threads);
+    ASSERT_EQ(conf.messages_per_turn, 0u);
+    ASSERT_FALSE(conf.cpu_pinning);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+}
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that every thread pool tag is read with the work stealing scheduler.
+ */
+TEST(YamlReaderThreadPoolTest, work_stealing_scheduler)
+{
+    const char* yml_str =
+            R"(
+            threads: 32
+            scheduler: work-stealing
+            messages-per-turn: 50
+            cpu-pinning: true
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::ThreadPoolConfiguration conf =
+            YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    ASSERT_EQ(conf.kind, core::ThreadPoolKind::work_stealing);
+    ASSERT_EQ(conf.n_threads, 32u);
+    ASSERT_EQ(conf.messages_per_turn, 50u);
+    ASSERT_TRUE(conf.cpu_pinning);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+}
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that the priority scheduler tags are read.
+ */
+TEST(YamlReaderThreadPoolTest, priority_scheduler)
+{
+    const char* yml_str =
+            R"(
+            scheduler: priority
+            priority-classes: 5
+            starvation-timeout: 250
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::ThreadPoolConfiguration conf =
+            YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    ASSERT_EQ(conf.kind, core::ThreadPoolKind::priority);
+    ASSERT_EQ(conf.priority_classes, 5u);
+    ASSERT_EQ(conf.starvation_timeout, 250u);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(conf.is_valid(error_msg));
+}
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that an exception is thrown when the scheduler is not known.
+ */
+TEST(YamlReaderThreadPoolTest, throw_exception_when_unknown_scheduler)
+{
+    const char* yml_str =
+            R"(
+            scheduler: round-robin
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    ASSERT_THROW(
+        YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that an exception is thrown when the number of threads is 0.
+ */
+TEST(YamlReaderThreadPoolTest, throw_exception_when_zero_threads)
+{
+    const char* yml_str =
+            R"(
+            threads: 0
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    ASSERT_THROW(
+        YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+/**
+ * Check the get function for ThreadPoolConfiguration.
+ *
+ * CASES:
+ *  Check that CPU pinning with the FIFO scheduler is not a valid configuration.
+ */
+TEST(YamlReaderThreadPoolTest, cpu_pinning_requires_work_stealing)
+{
+    const char* yml_str =
+            R"(
+            scheduler: fifo
+            cpu-pinning: true
+        )";
+
+    Yaml yml = YAML::Load(yml_str);
+
+    core::ThreadPoolConfiguration conf =
+            YamlReader::get<core::ThreadPoolConfiguration>(yml, YamlReaderVersion::LATEST);
+
+    utils::Formatter error_msg;
+    ASSERT_FALSE(conf.is_valid(error_msg));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}